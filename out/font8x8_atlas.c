@@ -0,0 +1,475 @@
+// Generated file. Do not edit manually.
+
+#include <stdint.h>
+
+#include "font8x8.h"
+
+#define font8x8_atlas_width 256
+#define font8x8_atlas_height 512
+#define font8x8_glyph_width 16
+#define font8x8_glyph_height 16
+#define font8x8_glyph_count 342
+
+static Font8x8AtlasRect const font8x8_atlas_rects[font8x8_glyph_count] = {
+    {1, 1, 16, 16, 0.00390625f, 0.001953125f, 0.06640625f, 0.033203125f}, // U+0020
+    {18, 1, 16, 16, 0.0703125f, 0.001953125f, 0.1328125f, 0.033203125f}, // U+0021
+    {35, 1, 16, 16, 0.13671875f, 0.001953125f, 0.19921875f, 0.033203125f}, // U+0022
+    {52, 1, 16, 16, 0.203125f, 0.001953125f, 0.265625f, 0.033203125f}, // U+0023
+    {69, 1, 16, 16, 0.26953125f, 0.001953125f, 0.33203125f, 0.033203125f}, // U+0024
+    {86, 1, 16, 16, 0.3359375f, 0.001953125f, 0.3984375f, 0.033203125f}, // U+0025
+    {103, 1, 16, 16, 0.40234375f, 0.001953125f, 0.46484375f, 0.033203125f}, // U+0026
+    {120, 1, 16, 16, 0.46875f, 0.001953125f, 0.53125f, 0.033203125f}, // U+0027
+    {137, 1, 16, 16, 0.53515625f, 0.001953125f, 0.59765625f, 0.033203125f}, // U+0028
+    {154, 1, 16, 16, 0.6015625f, 0.001953125f, 0.6640625f, 0.033203125f}, // U+0029
+    {171, 1, 16, 16, 0.66796875f, 0.001953125f, 0.73046875f, 0.033203125f}, // U+002A
+    {188, 1, 16, 16, 0.734375f, 0.001953125f, 0.796875f, 0.033203125f}, // U+002B
+    {205, 1, 16, 16, 0.80078125f, 0.001953125f, 0.86328125f, 0.033203125f}, // U+002C
+    {205, 1, 16, 16, 0.80078125f, 0.001953125f, 0.86328125f, 0.033203125f}, // U+002C
+    {222, 1, 16, 16, 0.8671875f, 0.001953125f, 0.9296875f, 0.033203125f}, // U+002D
+    {239, 1, 16, 16, 0.93359375f, 0.001953125f, 0.99609375f, 0.033203125f}, // U+002E
+    {1, 18, 16, 16, 0.00390625f, 0.03515625f, 0.06640625f, 0.06640625f}, // U+002F
+    {18, 18, 16, 16, 0.0703125f, 0.03515625f, 0.1328125f, 0.06640625f}, // U+0030
+    {35, 18, 16, 16, 0.13671875f, 0.03515625f, 0.19921875f, 0.06640625f}, // U+0031
+    {52, 18, 16, 16, 0.203125f, 0.03515625f, 0.265625f, 0.06640625f}, // U+0032
+    {69, 18, 16, 16, 0.26953125f, 0.03515625f, 0.33203125f, 0.06640625f}, // U+0033
+    {86, 18, 16, 16, 0.3359375f, 0.03515625f, 0.3984375f, 0.06640625f}, // U+0034
+    {103, 18, 16, 16, 0.40234375f, 0.03515625f, 0.46484375f, 0.06640625f}, // U+0035
+    {120, 18, 16, 16, 0.46875f, 0.03515625f, 0.53125f, 0.06640625f}, // U+0036
+    {137, 18, 16, 16, 0.53515625f, 0.03515625f, 0.59765625f, 0.06640625f}, // U+0037
+    {154, 18, 16, 16, 0.6015625f, 0.03515625f, 0.6640625f, 0.06640625f}, // U+0038
+    {171, 18, 16, 16, 0.66796875f, 0.03515625f, 0.73046875f, 0.06640625f}, // U+0039
+    {188, 18, 16, 16, 0.734375f, 0.03515625f, 0.796875f, 0.06640625f}, // U+003A
+    {205, 18, 16, 16, 0.80078125f, 0.03515625f, 0.86328125f, 0.06640625f}, // U+003B
+    {222, 18, 16, 16, 0.8671875f, 0.03515625f, 0.9296875f, 0.06640625f}, // U+003C
+    {239, 18, 16, 16, 0.93359375f, 0.03515625f, 0.99609375f, 0.06640625f}, // U+003D
+    {1, 35, 16, 16, 0.00390625f, 0.068359375f, 0.06640625f, 0.099609375f}, // U+003E
+    {18, 35, 16, 16, 0.0703125f, 0.068359375f, 0.1328125f, 0.099609375f}, // U+003F
+    {35, 35, 16, 16, 0.13671875f, 0.068359375f, 0.19921875f, 0.099609375f}, // U+0040
+    {52, 35, 16, 16, 0.203125f, 0.068359375f, 0.265625f, 0.099609375f}, // U+0041
+    {69, 35, 16, 16, 0.26953125f, 0.068359375f, 0.33203125f, 0.099609375f}, // U+0042
+    {86, 35, 16, 16, 0.3359375f, 0.068359375f, 0.3984375f, 0.099609375f}, // U+0043
+    {103, 35, 16, 16, 0.40234375f, 0.068359375f, 0.46484375f, 0.099609375f}, // U+0044
+    {120, 35, 16, 16, 0.46875f, 0.068359375f, 0.53125f, 0.099609375f}, // U+0045
+    {137, 35, 16, 16, 0.53515625f, 0.068359375f, 0.59765625f, 0.099609375f}, // U+0046
+    {154, 35, 16, 16, 0.6015625f, 0.068359375f, 0.6640625f, 0.099609375f}, // U+0047
+    {171, 35, 16, 16, 0.66796875f, 0.068359375f, 0.73046875f, 0.099609375f}, // U+0048
+    {188, 35, 16, 16, 0.734375f, 0.068359375f, 0.796875f, 0.099609375f}, // U+0049
+    {205, 35, 16, 16, 0.80078125f, 0.068359375f, 0.86328125f, 0.099609375f}, // U+004A
+    {222, 35, 16, 16, 0.8671875f, 0.068359375f, 0.9296875f, 0.099609375f}, // U+004B
+    {239, 35, 16, 16, 0.93359375f, 0.068359375f, 0.99609375f, 0.099609375f}, // U+004C
+    {1, 52, 16, 16, 0.00390625f, 0.1015625f, 0.06640625f, 0.1328125f}, // U+004D
+    {18, 52, 16, 16, 0.0703125f, 0.1015625f, 0.1328125f, 0.1328125f}, // U+004E
+    {35, 52, 16, 16, 0.13671875f, 0.1015625f, 0.19921875f, 0.1328125f}, // U+004F
+    {52, 52, 16, 16, 0.203125f, 0.1015625f, 0.265625f, 0.1328125f}, // U+0050
+    {69, 52, 16, 16, 0.26953125f, 0.1015625f, 0.33203125f, 0.1328125f}, // U+0051
+    {86, 52, 16, 16, 0.3359375f, 0.1015625f, 0.3984375f, 0.1328125f}, // U+0052
+    {103, 52, 16, 16, 0.40234375f, 0.1015625f, 0.46484375f, 0.1328125f}, // U+0053
+    {120, 52, 16, 16, 0.46875f, 0.1015625f, 0.53125f, 0.1328125f}, // U+0054
+    {137, 52, 16, 16, 0.53515625f, 0.1015625f, 0.59765625f, 0.1328125f}, // U+0055
+    {154, 52, 16, 16, 0.6015625f, 0.1015625f, 0.6640625f, 0.1328125f}, // U+0056
+    {171, 52, 16, 16, 0.66796875f, 0.1015625f, 0.73046875f, 0.1328125f}, // U+0057
+    {188, 52, 16, 16, 0.734375f, 0.1015625f, 0.796875f, 0.1328125f}, // U+0058
+    {205, 52, 16, 16, 0.80078125f, 0.1015625f, 0.86328125f, 0.1328125f}, // U+0059
+    {222, 52, 16, 16, 0.8671875f, 0.1015625f, 0.9296875f, 0.1328125f}, // U+005A
+    {239, 52, 16, 16, 0.93359375f, 0.1015625f, 0.99609375f, 0.1328125f}, // U+005B
+    {1, 69, 16, 16, 0.00390625f, 0.134765625f, 0.06640625f, 0.166015625f}, // U+005C
+    {18, 69, 16, 16, 0.0703125f, 0.134765625f, 0.1328125f, 0.166015625f}, // U+005D
+    {35, 69, 16, 16, 0.13671875f, 0.134765625f, 0.19921875f, 0.166015625f}, // U+005E
+    {52, 69, 16, 16, 0.203125f, 0.134765625f, 0.265625f, 0.166015625f}, // U+005F
+    {69, 69, 16, 16, 0.26953125f, 0.134765625f, 0.33203125f, 0.166015625f}, // U+0060
+    {86, 69, 16, 16, 0.3359375f, 0.134765625f, 0.3984375f, 0.166015625f}, // U+0061
+    {103, 69, 16, 16, 0.40234375f, 0.134765625f, 0.46484375f, 0.166015625f}, // U+0062
+    {120, 69, 16, 16, 0.46875f, 0.134765625f, 0.53125f, 0.166015625f}, // U+0063
+    {137, 69, 16, 16, 0.53515625f, 0.134765625f, 0.59765625f, 0.166015625f}, // U+0064
+    {154, 69, 16, 16, 0.6015625f, 0.134765625f, 0.6640625f, 0.166015625f}, // U+0065
+    {171, 69, 16, 16, 0.66796875f, 0.134765625f, 0.73046875f, 0.166015625f}, // U+0066
+    {188, 69, 16, 16, 0.734375f, 0.134765625f, 0.796875f, 0.166015625f}, // U+0067
+    {205, 69, 16, 16, 0.80078125f, 0.134765625f, 0.86328125f, 0.166015625f}, // U+0068
+    {222, 69, 16, 16, 0.8671875f, 0.134765625f, 0.9296875f, 0.166015625f}, // U+0069
+    {239, 69, 16, 16, 0.93359375f, 0.134765625f, 0.99609375f, 0.166015625f}, // U+006A
+    {1, 86, 16, 16, 0.00390625f, 0.16796875f, 0.06640625f, 0.19921875f}, // U+006B
+    {18, 86, 16, 16, 0.0703125f, 0.16796875f, 0.1328125f, 0.19921875f}, // U+006C
+    {35, 86, 16, 16, 0.13671875f, 0.16796875f, 0.19921875f, 0.19921875f}, // U+006D
+    {52, 86, 16, 16, 0.203125f, 0.16796875f, 0.265625f, 0.19921875f}, // U+006E
+    {69, 86, 16, 16, 0.26953125f, 0.16796875f, 0.33203125f, 0.19921875f}, // U+006F
+    {86, 86, 16, 16, 0.3359375f, 0.16796875f, 0.3984375f, 0.19921875f}, // U+0070
+    {103, 86, 16, 16, 0.40234375f, 0.16796875f, 0.46484375f, 0.19921875f}, // U+0071
+    {120, 86, 16, 16, 0.46875f, 0.16796875f, 0.53125f, 0.19921875f}, // U+0072
+    {137, 86, 16, 16, 0.53515625f, 0.16796875f, 0.59765625f, 0.19921875f}, // U+0073
+    {154, 86, 16, 16, 0.6015625f, 0.16796875f, 0.6640625f, 0.19921875f}, // U+0074
+    {171, 86, 16, 16, 0.66796875f, 0.16796875f, 0.73046875f, 0.19921875f}, // U+0075
+    {188, 86, 16, 16, 0.734375f, 0.16796875f, 0.796875f, 0.19921875f}, // U+0076
+    {205, 86, 16, 16, 0.80078125f, 0.16796875f, 0.86328125f, 0.19921875f}, // U+0077
+    {222, 86, 16, 16, 0.8671875f, 0.16796875f, 0.9296875f, 0.19921875f}, // U+0078
+    {239, 86, 16, 16, 0.93359375f, 0.16796875f, 0.99609375f, 0.19921875f}, // U+0079
+    {1, 103, 16, 16, 0.00390625f, 0.201171875f, 0.06640625f, 0.232421875f}, // U+007A
+    {18, 103, 16, 16, 0.0703125f, 0.201171875f, 0.1328125f, 0.232421875f}, // U+007B
+    {35, 103, 16, 16, 0.13671875f, 0.201171875f, 0.19921875f, 0.232421875f}, // U+007C
+    {52, 103, 16, 16, 0.203125f, 0.201171875f, 0.265625f, 0.232421875f}, // U+007D
+    {69, 103, 16, 16, 0.26953125f, 0.201171875f, 0.33203125f, 0.232421875f}, // U+007E
+    {86, 103, 16, 16, 0.3359375f, 0.201171875f, 0.3984375f, 0.232421875f}, // U+00A7
+    {103, 103, 16, 16, 0.40234375f, 0.201171875f, 0.46484375f, 0.232421875f}, // U+00A9
+    {120, 103, 16, 16, 0.46875f, 0.201171875f, 0.53125f, 0.232421875f}, // U+00AB
+    {137, 103, 16, 16, 0.53515625f, 0.201171875f, 0.59765625f, 0.232421875f}, // U+00AC
+    {154, 103, 16, 16, 0.6015625f, 0.201171875f, 0.6640625f, 0.232421875f}, // U+00AE
+    {171, 103, 16, 16, 0.66796875f, 0.201171875f, 0.73046875f, 0.232421875f}, // U+00B0
+    {188, 103, 16, 16, 0.734375f, 0.201171875f, 0.796875f, 0.232421875f}, // U+00B1
+    {205, 103, 16, 16, 0.80078125f, 0.201171875f, 0.86328125f, 0.232421875f}, // U+00B6
+    {222, 103, 16, 16, 0.8671875f, 0.201171875f, 0.9296875f, 0.232421875f}, // U+00B7
+    {239, 103, 16, 16, 0.93359375f, 0.201171875f, 0.99609375f, 0.232421875f}, // U+00BB
+    {1, 120, 16, 16, 0.00390625f, 0.234375f, 0.06640625f, 0.265625f}, // U+00D7
+    {18, 120, 16, 16, 0.0703125f, 0.234375f, 0.1328125f, 0.265625f}, // U+00F7
+    {52, 35, 16, 16, 0.203125f, 0.068359375f, 0.265625f, 0.099609375f}, // U+0391
+    {69, 35, 16, 16, 0.26953125f, 0.068359375f, 0.33203125f, 0.099609375f}, // U+0392
+    {35, 120, 16, 16, 0.13671875f, 0.234375f, 0.19921875f, 0.265625f}, // U+0393
+    {52, 120, 16, 16, 0.203125f, 0.234375f, 0.265625f, 0.265625f}, // U+0394
+    {120, 35, 16, 16, 0.46875f, 0.068359375f, 0.53125f, 0.099609375f}, // U+0395
+    {69, 120, 16, 16, 0.26953125f, 0.234375f, 0.33203125f, 0.265625f}, // U+0396
+    {171, 35, 16, 16, 0.66796875f, 0.068359375f, 0.73046875f, 0.099609375f}, // U+0397
+    {86, 120, 16, 16, 0.3359375f, 0.234375f, 0.3984375f, 0.265625f}, // U+0398
+    {188, 35, 16, 16, 0.734375f, 0.068359375f, 0.796875f, 0.099609375f}, // U+0399
+    {222, 35, 16, 16, 0.8671875f, 0.068359375f, 0.9296875f, 0.099609375f}, // U+039A
+    {103, 120, 16, 16, 0.40234375f, 0.234375f, 0.46484375f, 0.265625f}, // U+039B
+    {1, 52, 16, 16, 0.00390625f, 0.1015625f, 0.06640625f, 0.1328125f}, // U+039C
+    {18, 52, 16, 16, 0.0703125f, 0.1015625f, 0.1328125f, 0.1328125f}, // U+039D
+    {120, 120, 16, 16, 0.46875f, 0.234375f, 0.53125f, 0.265625f}, // U+039E
+    {35, 52, 16, 16, 0.13671875f, 0.1015625f, 0.19921875f, 0.1328125f}, // U+039F
+    {137, 120, 16, 16, 0.53515625f, 0.234375f, 0.59765625f, 0.265625f}, // U+03A0
+    {154, 120, 16, 16, 0.6015625f, 0.234375f, 0.6640625f, 0.265625f}, // U+03A1
+    {171, 120, 16, 16, 0.66796875f, 0.234375f, 0.73046875f, 0.265625f}, // U+03A3
+    {188, 120, 16, 16, 0.734375f, 0.234375f, 0.796875f, 0.265625f}, // U+03A4
+    {205, 52, 16, 16, 0.80078125f, 0.1015625f, 0.86328125f, 0.1328125f}, // U+03A5
+    {205, 120, 16, 16, 0.80078125f, 0.234375f, 0.86328125f, 0.265625f}, // U+03A6
+    {188, 52, 16, 16, 0.734375f, 0.1015625f, 0.796875f, 0.1328125f}, // U+03A7
+    {222, 120, 16, 16, 0.8671875f, 0.234375f, 0.9296875f, 0.265625f}, // U+03A8
+    {239, 120, 16, 16, 0.93359375f, 0.234375f, 0.99609375f, 0.265625f}, // U+03A9
+    {1, 137, 16, 16, 0.00390625f, 0.267578125f, 0.06640625f, 0.298828125f}, // U+03B1
+    {18, 137, 16, 16, 0.0703125f, 0.267578125f, 0.1328125f, 0.298828125f}, // U+03B2
+    {35, 137, 16, 16, 0.13671875f, 0.267578125f, 0.19921875f, 0.298828125f}, // U+03B3
+    {52, 137, 16, 16, 0.203125f, 0.267578125f, 0.265625f, 0.298828125f}, // U+03B4
+    {69, 137, 16, 16, 0.26953125f, 0.267578125f, 0.33203125f, 0.298828125f}, // U+03B5
+    {86, 137, 16, 16, 0.3359375f, 0.267578125f, 0.3984375f, 0.298828125f}, // U+03B6
+    {103, 137, 16, 16, 0.40234375f, 0.267578125f, 0.46484375f, 0.298828125f}, // U+03B7
+    {120, 137, 16, 16, 0.46875f, 0.267578125f, 0.53125f, 0.298828125f}, // U+03B8
+    {137, 137, 16, 16, 0.53515625f, 0.267578125f, 0.59765625f, 0.298828125f}, // U+03B9
+    {154, 137, 16, 16, 0.6015625f, 0.267578125f, 0.6640625f, 0.298828125f}, // U+03BA
+    {171, 137, 16, 16, 0.66796875f, 0.267578125f, 0.73046875f, 0.298828125f}, // U+03BB
+    {188, 137, 16, 16, 0.734375f, 0.267578125f, 0.796875f, 0.298828125f}, // U+03BC
+    {205, 137, 16, 16, 0.80078125f, 0.267578125f, 0.86328125f, 0.298828125f}, // U+03BD
+    {222, 137, 16, 16, 0.8671875f, 0.267578125f, 0.9296875f, 0.298828125f}, // U+03BE
+    {239, 137, 16, 16, 0.93359375f, 0.267578125f, 0.99609375f, 0.298828125f}, // U+03BF
+    {1, 154, 16, 16, 0.00390625f, 0.30078125f, 0.06640625f, 0.33203125f}, // U+03C0
+    {18, 154, 16, 16, 0.0703125f, 0.30078125f, 0.1328125f, 0.33203125f}, // U+03C1
+    {35, 154, 16, 16, 0.13671875f, 0.30078125f, 0.19921875f, 0.33203125f}, // U+03C2
+    {52, 154, 16, 16, 0.203125f, 0.30078125f, 0.265625f, 0.33203125f}, // U+03C3
+    {69, 154, 16, 16, 0.26953125f, 0.30078125f, 0.33203125f, 0.33203125f}, // U+03C4
+    {86, 154, 16, 16, 0.3359375f, 0.30078125f, 0.3984375f, 0.33203125f}, // U+03C5
+    {103, 154, 16, 16, 0.40234375f, 0.30078125f, 0.46484375f, 0.33203125f}, // U+03C6
+    {120, 154, 16, 16, 0.46875f, 0.30078125f, 0.53125f, 0.33203125f}, // U+03C7
+    {137, 154, 16, 16, 0.53515625f, 0.30078125f, 0.59765625f, 0.33203125f}, // U+03C8
+    {154, 154, 16, 16, 0.6015625f, 0.30078125f, 0.6640625f, 0.33203125f}, // U+03C9
+    {171, 154, 16, 16, 0.66796875f, 0.30078125f, 0.73046875f, 0.33203125f}, // U+0401
+    {52, 35, 16, 16, 0.203125f, 0.068359375f, 0.265625f, 0.099609375f}, // U+0410
+    {188, 154, 16, 16, 0.734375f, 0.30078125f, 0.796875f, 0.33203125f}, // U+0411
+    {69, 35, 16, 16, 0.26953125f, 0.068359375f, 0.33203125f, 0.099609375f}, // U+0412
+    {205, 154, 16, 16, 0.80078125f, 0.30078125f, 0.86328125f, 0.33203125f}, // U+0413
+    {222, 154, 16, 16, 0.8671875f, 0.30078125f, 0.9296875f, 0.33203125f}, // U+0414
+    {120, 35, 16, 16, 0.46875f, 0.068359375f, 0.53125f, 0.099609375f}, // U+0415
+    {239, 154, 16, 16, 0.93359375f, 0.30078125f, 0.99609375f, 0.33203125f}, // U+0416
+    {1, 171, 16, 16, 0.00390625f, 0.333984375f, 0.06640625f, 0.365234375f}, // U+0417
+    {18, 171, 16, 16, 0.0703125f, 0.333984375f, 0.1328125f, 0.365234375f}, // U+0418
+    {35, 171, 16, 16, 0.13671875f, 0.333984375f, 0.19921875f, 0.365234375f}, // U+0419
+    {222, 35, 16, 16, 0.8671875f, 0.068359375f, 0.9296875f, 0.099609375f}, // U+041A
+    {52, 171, 16, 16, 0.203125f, 0.333984375f, 0.265625f, 0.365234375f}, // U+041B
+    {1, 52, 16, 16, 0.00390625f, 0.1015625f, 0.06640625f, 0.1328125f}, // U+041C
+    {171, 35, 16, 16, 0.66796875f, 0.068359375f, 0.73046875f, 0.099609375f}, // U+041D
+    {35, 52, 16, 16, 0.13671875f, 0.1015625f, 0.19921875f, 0.1328125f}, // U+041E
+    {137, 120, 16, 16, 0.53515625f, 0.234375f, 0.59765625f, 0.265625f}, // U+041F
+    {52, 52, 16, 16, 0.203125f, 0.1015625f, 0.265625f, 0.1328125f}, // U+0420
+    {86, 35, 16, 16, 0.3359375f, 0.068359375f, 0.3984375f, 0.099609375f}, // U+0421
+    {120, 52, 16, 16, 0.46875f, 0.1015625f, 0.53125f, 0.1328125f}, // U+0422
+    {69, 171, 16, 16, 0.26953125f, 0.333984375f, 0.33203125f, 0.365234375f}, // U+0423
+    {205, 120, 16, 16, 0.80078125f, 0.234375f, 0.86328125f, 0.265625f}, // U+0424
+    {188, 52, 16, 16, 0.734375f, 0.1015625f, 0.796875f, 0.1328125f}, // U+0425
+    {86, 171, 16, 16, 0.3359375f, 0.333984375f, 0.3984375f, 0.365234375f}, // U+0426
+    {103, 171, 16, 16, 0.40234375f, 0.333984375f, 0.46484375f, 0.365234375f}, // U+0427
+    {120, 171, 16, 16, 0.46875f, 0.333984375f, 0.53125f, 0.365234375f}, // U+0428
+    {137, 171, 16, 16, 0.53515625f, 0.333984375f, 0.59765625f, 0.365234375f}, // U+0429
+    {154, 171, 16, 16, 0.6015625f, 0.333984375f, 0.6640625f, 0.365234375f}, // U+042A
+    {171, 171, 16, 16, 0.66796875f, 0.333984375f, 0.73046875f, 0.365234375f}, // U+042B
+    {188, 171, 16, 16, 0.734375f, 0.333984375f, 0.796875f, 0.365234375f}, // U+042C
+    {205, 171, 16, 16, 0.80078125f, 0.333984375f, 0.86328125f, 0.365234375f}, // U+042D
+    {222, 171, 16, 16, 0.8671875f, 0.333984375f, 0.9296875f, 0.365234375f}, // U+042E
+    {239, 171, 16, 16, 0.93359375f, 0.333984375f, 0.99609375f, 0.365234375f}, // U+042F
+    {86, 69, 16, 16, 0.3359375f, 0.134765625f, 0.3984375f, 0.166015625f}, // U+0430
+    {1, 188, 16, 16, 0.00390625f, 0.3671875f, 0.06640625f, 0.3984375f}, // U+0431
+    {18, 188, 16, 16, 0.0703125f, 0.3671875f, 0.1328125f, 0.3984375f}, // U+0432
+    {35, 188, 16, 16, 0.13671875f, 0.3671875f, 0.19921875f, 0.3984375f}, // U+0433
+    {52, 188, 16, 16, 0.203125f, 0.3671875f, 0.265625f, 0.3984375f}, // U+0434
+    {154, 69, 16, 16, 0.6015625f, 0.134765625f, 0.6640625f, 0.166015625f}, // U+0435
+    {69, 188, 16, 16, 0.26953125f, 0.3671875f, 0.33203125f, 0.3984375f}, // U+0436
+    {86, 188, 16, 16, 0.3359375f, 0.3671875f, 0.3984375f, 0.3984375f}, // U+0437
+    {103, 188, 16, 16, 0.40234375f, 0.3671875f, 0.46484375f, 0.3984375f}, // U+0438
+    {120, 188, 16, 16, 0.46875f, 0.3671875f, 0.53125f, 0.3984375f}, // U+0439
+    {154, 137, 16, 16, 0.6015625f, 0.267578125f, 0.6640625f, 0.298828125f}, // U+043A
+    {137, 188, 16, 16, 0.53515625f, 0.3671875f, 0.59765625f, 0.3984375f}, // U+043B
+    {154, 188, 16, 16, 0.6015625f, 0.3671875f, 0.6640625f, 0.3984375f}, // U+043C
+    {171, 188, 16, 16, 0.66796875f, 0.3671875f, 0.73046875f, 0.3984375f}, // U+043D
+    {69, 86, 16, 16, 0.26953125f, 0.16796875f, 0.33203125f, 0.19921875f}, // U+043E
+    {188, 188, 16, 16, 0.734375f, 0.3671875f, 0.796875f, 0.3984375f}, // U+043F
+    {86, 86, 16, 16, 0.3359375f, 0.16796875f, 0.3984375f, 0.19921875f}, // U+0440
+    {120, 69, 16, 16, 0.46875f, 0.134765625f, 0.53125f, 0.166015625f}, // U+0441
+    {205, 188, 16, 16, 0.80078125f, 0.3671875f, 0.86328125f, 0.3984375f}, // U+0442
+    {239, 86, 16, 16, 0.93359375f, 0.16796875f, 0.99609375f, 0.19921875f}, // U+0443
+    {222, 188, 16, 16, 0.8671875f, 0.3671875f, 0.9296875f, 0.3984375f}, // U+0444
+    {222, 86, 16, 16, 0.8671875f, 0.16796875f, 0.9296875f, 0.19921875f}, // U+0445
+    {239, 188, 16, 16, 0.93359375f, 0.3671875f, 0.99609375f, 0.3984375f}, // U+0446
+    {1, 205, 16, 16, 0.00390625f, 0.400390625f, 0.06640625f, 0.431640625f}, // U+0447
+    {18, 205, 16, 16, 0.0703125f, 0.400390625f, 0.1328125f, 0.431640625f}, // U+0448
+    {35, 205, 16, 16, 0.13671875f, 0.400390625f, 0.19921875f, 0.431640625f}, // U+0449
+    {52, 205, 16, 16, 0.203125f, 0.400390625f, 0.265625f, 0.431640625f}, // U+044A
+    {69, 205, 16, 16, 0.26953125f, 0.400390625f, 0.33203125f, 0.431640625f}, // U+044B
+    {86, 205, 16, 16, 0.3359375f, 0.400390625f, 0.3984375f, 0.431640625f}, // U+044C
+    {103, 205, 16, 16, 0.40234375f, 0.400390625f, 0.46484375f, 0.431640625f}, // U+044D
+    {120, 205, 16, 16, 0.46875f, 0.400390625f, 0.53125f, 0.431640625f}, // U+044E
+    {137, 205, 16, 16, 0.53515625f, 0.400390625f, 0.59765625f, 0.431640625f}, // U+044F
+    {154, 205, 16, 16, 0.6015625f, 0.400390625f, 0.6640625f, 0.431640625f}, // U+0451
+    {171, 205, 16, 16, 0.66796875f, 0.400390625f, 0.73046875f, 0.431640625f}, // U+2014
+    {188, 205, 16, 16, 0.734375f, 0.400390625f, 0.796875f, 0.431640625f}, // U+2018
+    {205, 205, 16, 16, 0.80078125f, 0.400390625f, 0.86328125f, 0.431640625f}, // U+2019
+    {222, 205, 16, 16, 0.8671875f, 0.400390625f, 0.9296875f, 0.431640625f}, // U+201C
+    {239, 205, 16, 16, 0.93359375f, 0.400390625f, 0.99609375f, 0.431640625f}, // U+201D
+    {1, 222, 16, 16, 0.00390625f, 0.43359375f, 0.06640625f, 0.46484375f}, // U+201E
+    {18, 222, 16, 16, 0.0703125f, 0.43359375f, 0.1328125f, 0.46484375f}, // U+2022
+    {35, 222, 16, 16, 0.13671875f, 0.43359375f, 0.19921875f, 0.46484375f}, // U+2023
+    {52, 222, 16, 16, 0.203125f, 0.43359375f, 0.265625f, 0.46484375f}, // U+2026
+    {69, 222, 16, 16, 0.26953125f, 0.43359375f, 0.33203125f, 0.46484375f}, // U+2190
+    {86, 222, 16, 16, 0.3359375f, 0.43359375f, 0.3984375f, 0.46484375f}, // U+2191
+    {103, 222, 16, 16, 0.40234375f, 0.43359375f, 0.46484375f, 0.46484375f}, // U+2192
+    {120, 222, 16, 16, 0.46875f, 0.43359375f, 0.53125f, 0.46484375f}, // U+2193
+    {137, 222, 16, 16, 0.53515625f, 0.43359375f, 0.59765625f, 0.46484375f}, // U+2196
+    {154, 222, 16, 16, 0.6015625f, 0.43359375f, 0.6640625f, 0.46484375f}, // U+2197
+    {171, 222, 16, 16, 0.66796875f, 0.43359375f, 0.73046875f, 0.46484375f}, // U+2198
+    {188, 222, 16, 16, 0.734375f, 0.43359375f, 0.796875f, 0.46484375f}, // U+2199
+    {205, 222, 16, 16, 0.80078125f, 0.43359375f, 0.86328125f, 0.46484375f}, // U+21B0
+    {222, 222, 16, 16, 0.8671875f, 0.43359375f, 0.9296875f, 0.46484375f}, // U+21B1
+    {239, 222, 16, 16, 0.93359375f, 0.43359375f, 0.99609375f, 0.46484375f}, // U+21B2
+    {1, 239, 16, 16, 0.00390625f, 0.466796875f, 0.06640625f, 0.498046875f}, // U+21B3
+    {18, 239, 16, 16, 0.0703125f, 0.466796875f, 0.1328125f, 0.498046875f}, // U+21B4
+    {35, 239, 16, 16, 0.13671875f, 0.466796875f, 0.19921875f, 0.498046875f}, // U+2200
+    {52, 239, 16, 16, 0.203125f, 0.466796875f, 0.265625f, 0.498046875f}, // U+2202
+    {69, 239, 16, 16, 0.26953125f, 0.466796875f, 0.33203125f, 0.498046875f}, // U+2203
+    {86, 239, 16, 16, 0.3359375f, 0.466796875f, 0.3984375f, 0.498046875f}, // U+2204
+    {103, 239, 16, 16, 0.40234375f, 0.466796875f, 0.46484375f, 0.498046875f}, // U+2205
+    {120, 239, 16, 16, 0.46875f, 0.466796875f, 0.53125f, 0.498046875f}, // U+2206
+    {137, 239, 16, 16, 0.53515625f, 0.466796875f, 0.59765625f, 0.498046875f}, // U+2207
+    {154, 239, 16, 16, 0.6015625f, 0.466796875f, 0.6640625f, 0.498046875f}, // U+2208
+    {171, 239, 16, 16, 0.66796875f, 0.466796875f, 0.73046875f, 0.498046875f}, // U+2209
+    {188, 239, 16, 16, 0.734375f, 0.466796875f, 0.796875f, 0.498046875f}, // U+220B
+    {205, 239, 16, 16, 0.80078125f, 0.466796875f, 0.86328125f, 0.498046875f}, // U+220C
+    {222, 239, 16, 16, 0.8671875f, 0.466796875f, 0.9296875f, 0.498046875f}, // U+220E
+    {239, 239, 16, 16, 0.93359375f, 0.466796875f, 0.99609375f, 0.498046875f}, // U+220F
+    {1, 256, 16, 16, 0.00390625f, 0.5f, 0.06640625f, 0.53125f}, // U+2210
+    {18, 256, 16, 16, 0.0703125f, 0.5f, 0.1328125f, 0.53125f}, // U+2211
+    {35, 256, 16, 16, 0.13671875f, 0.5f, 0.19921875f, 0.53125f}, // U+2212
+    {52, 256, 16, 16, 0.203125f, 0.5f, 0.265625f, 0.53125f}, // U+2217
+    {69, 256, 16, 16, 0.26953125f, 0.5f, 0.33203125f, 0.53125f}, // U+2218
+    {86, 256, 16, 16, 0.3359375f, 0.5f, 0.3984375f, 0.53125f}, // U+2219
+    {103, 256, 16, 16, 0.40234375f, 0.5f, 0.46484375f, 0.53125f}, // U+221A
+    {120, 256, 16, 16, 0.46875f, 0.5f, 0.53125f, 0.53125f}, // U+221E
+    {137, 256, 16, 16, 0.53515625f, 0.5f, 0.59765625f, 0.53125f}, // U+221F
+    {154, 256, 16, 16, 0.6015625f, 0.5f, 0.6640625f, 0.53125f}, // U+2220
+    {35, 103, 16, 16, 0.13671875f, 0.201171875f, 0.19921875f, 0.232421875f}, // U+2223
+    {171, 256, 16, 16, 0.66796875f, 0.5f, 0.73046875f, 0.53125f}, // U+2224
+    {188, 256, 16, 16, 0.734375f, 0.5f, 0.796875f, 0.53125f}, // U+2225
+    {205, 256, 16, 16, 0.80078125f, 0.5f, 0.86328125f, 0.53125f}, // U+2226
+    {222, 256, 16, 16, 0.8671875f, 0.5f, 0.9296875f, 0.53125f}, // U+2227
+    {239, 256, 16, 16, 0.93359375f, 0.5f, 0.99609375f, 0.53125f}, // U+2228
+    {1, 273, 16, 16, 0.00390625f, 0.533203125f, 0.06640625f, 0.564453125f}, // U+2229
+    {18, 273, 16, 16, 0.0703125f, 0.533203125f, 0.1328125f, 0.564453125f}, // U+222A
+    {35, 273, 16, 16, 0.13671875f, 0.533203125f, 0.19921875f, 0.564453125f}, // U+222B
+    {52, 273, 16, 16, 0.203125f, 0.533203125f, 0.265625f, 0.564453125f}, // U+2243
+    {69, 273, 16, 16, 0.26953125f, 0.533203125f, 0.33203125f, 0.564453125f}, // U+2245
+    {86, 273, 16, 16, 0.3359375f, 0.533203125f, 0.3984375f, 0.564453125f}, // U+2248
+    {103, 273, 16, 16, 0.40234375f, 0.533203125f, 0.46484375f, 0.564453125f}, // U+2260
+    {120, 273, 16, 16, 0.46875f, 0.533203125f, 0.53125f, 0.564453125f}, // U+2261
+    {137, 273, 16, 16, 0.53515625f, 0.533203125f, 0.59765625f, 0.564453125f}, // U+2262
+    {154, 273, 16, 16, 0.6015625f, 0.533203125f, 0.6640625f, 0.564453125f}, // U+2264
+    {171, 273, 16, 16, 0.66796875f, 0.533203125f, 0.73046875f, 0.564453125f}, // U+2265
+    {188, 273, 16, 16, 0.734375f, 0.533203125f, 0.796875f, 0.564453125f}, // U+226A
+    {205, 273, 16, 16, 0.80078125f, 0.533203125f, 0.86328125f, 0.564453125f}, // U+226B
+    {222, 273, 16, 16, 0.8671875f, 0.533203125f, 0.9296875f, 0.564453125f}, // U+2282
+    {239, 273, 16, 16, 0.93359375f, 0.533203125f, 0.99609375f, 0.564453125f}, // U+2283
+    {1, 290, 16, 16, 0.00390625f, 0.56640625f, 0.06640625f, 0.59765625f}, // U+2284
+    {18, 290, 16, 16, 0.0703125f, 0.56640625f, 0.1328125f, 0.59765625f}, // U+2285
+    {35, 290, 16, 16, 0.13671875f, 0.56640625f, 0.19921875f, 0.59765625f}, // U+2286
+    {52, 290, 16, 16, 0.203125f, 0.56640625f, 0.265625f, 0.59765625f}, // U+2287
+    {69, 290, 16, 16, 0.26953125f, 0.56640625f, 0.33203125f, 0.59765625f}, // U+2288
+    {86, 290, 16, 16, 0.3359375f, 0.56640625f, 0.3984375f, 0.59765625f}, // U+2289
+    {103, 290, 16, 16, 0.40234375f, 0.56640625f, 0.46484375f, 0.59765625f}, // U+2295
+    {120, 290, 16, 16, 0.46875f, 0.56640625f, 0.53125f, 0.59765625f}, // U+2296
+    {137, 290, 16, 16, 0.53515625f, 0.56640625f, 0.59765625f, 0.59765625f}, // U+2297
+    {154, 290, 16, 16, 0.6015625f, 0.56640625f, 0.6640625f, 0.59765625f}, // U+2298
+    {171, 290, 16, 16, 0.66796875f, 0.56640625f, 0.73046875f, 0.59765625f}, // U+2299
+    {188, 290, 16, 16, 0.734375f, 0.56640625f, 0.796875f, 0.59765625f}, // U+229A
+    {205, 290, 16, 16, 0.80078125f, 0.56640625f, 0.86328125f, 0.59765625f}, // U+229C
+    {222, 290, 16, 16, 0.8671875f, 0.56640625f, 0.9296875f, 0.59765625f}, // U+22A5
+    {239, 290, 16, 16, 0.93359375f, 0.56640625f, 0.99609375f, 0.59765625f}, // U+22B9
+    {1, 307, 16, 16, 0.00390625f, 0.599609375f, 0.06640625f, 0.630859375f}, // U+22BB
+    {18, 307, 16, 16, 0.0703125f, 0.599609375f, 0.1328125f, 0.630859375f}, // U+22BC
+    {35, 307, 16, 16, 0.13671875f, 0.599609375f, 0.19921875f, 0.630859375f}, // U+22BD
+    {52, 307, 16, 16, 0.203125f, 0.599609375f, 0.265625f, 0.630859375f}, // U+22BF
+    {69, 307, 16, 16, 0.26953125f, 0.599609375f, 0.33203125f, 0.630859375f}, // U+22C0
+    {86, 307, 16, 16, 0.3359375f, 0.599609375f, 0.3984375f, 0.630859375f}, // U+22C1
+    {103, 307, 16, 16, 0.40234375f, 0.599609375f, 0.46484375f, 0.630859375f}, // U+22C2
+    {120, 307, 16, 16, 0.46875f, 0.599609375f, 0.53125f, 0.630859375f}, // U+22C3
+    {137, 307, 16, 16, 0.53515625f, 0.599609375f, 0.59765625f, 0.630859375f}, // U+22C4
+    {154, 307, 16, 16, 0.6015625f, 0.599609375f, 0.6640625f, 0.630859375f}, // U+22C5
+    {171, 307, 16, 16, 0.66796875f, 0.599609375f, 0.73046875f, 0.630859375f}, // U+22C6
+    {188, 307, 16, 16, 0.734375f, 0.599609375f, 0.796875f, 0.630859375f}, // U+22EE
+    {205, 307, 16, 16, 0.80078125f, 0.599609375f, 0.86328125f, 0.630859375f}, // U+22EF
+    {222, 307, 16, 16, 0.8671875f, 0.599609375f, 0.9296875f, 0.630859375f}, // U+22F0
+    {239, 307, 16, 16, 0.93359375f, 0.599609375f, 0.99609375f, 0.630859375f}, // U+22F1
+    {1, 324, 16, 16, 0.00390625f, 0.6328125f, 0.06640625f, 0.6640625f}, // U+2308
+    {18, 324, 16, 16, 0.0703125f, 0.6328125f, 0.1328125f, 0.6640625f}, // U+2309
+    {35, 324, 16, 16, 0.13671875f, 0.6328125f, 0.19921875f, 0.6640625f}, // U+230A
+    {52, 324, 16, 16, 0.203125f, 0.6328125f, 0.265625f, 0.6640625f}, // U+230B
+    {69, 324, 16, 16, 0.26953125f, 0.6328125f, 0.33203125f, 0.6640625f}, // U+231B
+    {86, 324, 16, 16, 0.3359375f, 0.6328125f, 0.3984375f, 0.6640625f}, // U+23E9
+    {103, 324, 16, 16, 0.40234375f, 0.6328125f, 0.46484375f, 0.6640625f}, // U+23EA
+    {120, 324, 16, 16, 0.46875f, 0.6328125f, 0.53125f, 0.6640625f}, // U+23EB
+    {137, 324, 16, 16, 0.53515625f, 0.6328125f, 0.59765625f, 0.6640625f}, // U+23EC
+    {154, 324, 16, 16, 0.6015625f, 0.6328125f, 0.6640625f, 0.6640625f}, // U+23ED
+    {171, 324, 16, 16, 0.66796875f, 0.6328125f, 0.73046875f, 0.6640625f}, // U+23EE
+    {188, 324, 16, 16, 0.734375f, 0.6328125f, 0.796875f, 0.6640625f}, // U+23EF
+    {205, 324, 16, 16, 0.80078125f, 0.6328125f, 0.86328125f, 0.6640625f}, // U+23F0
+    {222, 324, 16, 16, 0.8671875f, 0.6328125f, 0.9296875f, 0.6640625f}, // U+23F4
+    {35, 222, 16, 16, 0.13671875f, 0.43359375f, 0.19921875f, 0.46484375f}, // U+23F5
+    {239, 324, 16, 16, 0.93359375f, 0.6328125f, 0.99609375f, 0.6640625f}, // U+23F6
+    {1, 341, 16, 16, 0.00390625f, 0.666015625f, 0.06640625f, 0.697265625f}, // U+23F7
+    {18, 341, 16, 16, 0.0703125f, 0.666015625f, 0.1328125f, 0.697265625f}, // U+23F8
+    {35, 341, 16, 16, 0.13671875f, 0.666015625f, 0.19921875f, 0.697265625f}, // U+23F9
+    {52, 341, 16, 16, 0.203125f, 0.666015625f, 0.265625f, 0.697265625f}, // U+23FA
+    {69, 341, 16, 16, 0.26953125f, 0.666015625f, 0.33203125f, 0.697265625f}, // U+23FB
+    {86, 341, 16, 16, 0.3359375f, 0.666015625f, 0.3984375f, 0.697265625f}, // U+23FE
+    {103, 341, 16, 16, 0.40234375f, 0.666015625f, 0.46484375f, 0.697265625f}, // U+FFFD
+};
+
+static uint16_t const font8x8_direct_glyph_indices[1106] = {
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 14, 15, 16,
+    17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32,
+    33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48,
+    49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64,
+    65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+    81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 96, 341, 97, 341, 98, 99, 341, 100, 341,
+    101, 102, 341, 341, 341, 341, 103, 104, 341, 341, 341, 105, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 106, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 107, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122,
+    123, 124, 341, 125, 126, 127, 128, 129, 130, 131, 341, 341, 341, 341, 341, 341,
+    341, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146,
+    147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 157, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    158, 159, 160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173,
+    174, 175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189,
+    190, 191, 192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205,
+    206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221,
+    341, 222,
+};
+
+static Font8x8Range const font8x8_ranges[] = {
+    {0x2014, 1, 223},
+    {0x2018, 2, 224},
+    {0x201c, 3, 226},
+    {0x2022, 2, 229},
+    {0x2026, 1, 231},
+    {0x2190, 4, 232},
+    {0x2196, 4, 236},
+    {0x21b0, 5, 240},
+    {0x2200, 1, 245},
+    {0x2202, 8, 246},
+    {0x220b, 2, 254},
+    {0x220e, 5, 256},
+    {0x2217, 4, 261},
+    {0x221e, 3, 265},
+    {0x2223, 9, 268},
+    {0x2243, 1, 277},
+    {0x2245, 1, 278},
+    {0x2248, 1, 279},
+    {0x2260, 3, 280},
+    {0x2264, 2, 283},
+    {0x226a, 2, 285},
+    {0x2282, 8, 287},
+    {0x2295, 6, 295},
+    {0x229c, 1, 301},
+    {0x22a5, 1, 302},
+    {0x22b9, 1, 303},
+    {0x22bb, 3, 304},
+    {0x22bf, 8, 307},
+    {0x22ee, 4, 315},
+    {0x2308, 4, 319},
+    {0x231b, 1, 323},
+    {0x23e9, 8, 324},
+    {0x23f4, 8, 332},
+    {0x23fe, 1, 340},
+    {0xfffd, 1, 341},
+};
+
+static Font8x8Index const font8x8_index = {
+    .direct_glyph_indices = font8x8_direct_glyph_indices,
+    .direct_count = 1106,
+    .ranges = font8x8_ranges,
+    .range_count = 35,
+    .fallback_glyph_index = 341,
+};
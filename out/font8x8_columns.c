@@ -0,0 +1,2360 @@
+// Generated file. Do not edit manually.
+
+#include <stdint.h>
+
+#include "font8x8.h"
+
+#define font8x8_glyph_width 8
+#define font8x8_glyph_height 8
+#define font8x8_glyph_page_count 1
+#define font8x8_glyph_count 342
+#define font8x8_bitmap_count 307
+#define font8x8_scale 2
+
+static uint32_t const font8x8_char_codes[font8x8_glyph_count] = {
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027,
+    0x0028, 0x0029, 0x002a, 0x002b, 0x002c, 0x002c, 0x002d, 0x002e,
+    0x002f, 0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036,
+    0x0037, 0x0038, 0x0039, 0x003a, 0x003b, 0x003c, 0x003d, 0x003e,
+    0x003f, 0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046,
+    0x0047, 0x0048, 0x0049, 0x004a, 0x004b, 0x004c, 0x004d, 0x004e,
+    0x004f, 0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056,
+    0x0057, 0x0058, 0x0059, 0x005a, 0x005b, 0x005c, 0x005d, 0x005e,
+    0x005f, 0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066,
+    0x0067, 0x0068, 0x0069, 0x006a, 0x006b, 0x006c, 0x006d, 0x006e,
+    0x006f, 0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076,
+    0x0077, 0x0078, 0x0079, 0x007a, 0x007b, 0x007c, 0x007d, 0x007e,
+    0x00a7, 0x00a9, 0x00ab, 0x00ac, 0x00ae, 0x00b0, 0x00b1, 0x00b6,
+    0x00b7, 0x00bb, 0x00d7, 0x00f7, 0x0391, 0x0392, 0x0393, 0x0394,
+    0x0395, 0x0396, 0x0397, 0x0398, 0x0399, 0x039a, 0x039b, 0x039c,
+    0x039d, 0x039e, 0x039f, 0x03a0, 0x03a1, 0x03a3, 0x03a4, 0x03a5,
+    0x03a6, 0x03a7, 0x03a8, 0x03a9, 0x03b1, 0x03b2, 0x03b3, 0x03b4,
+    0x03b5, 0x03b6, 0x03b7, 0x03b8, 0x03b9, 0x03ba, 0x03bb, 0x03bc,
+    0x03bd, 0x03be, 0x03bf, 0x03c0, 0x03c1, 0x03c2, 0x03c3, 0x03c4,
+    0x03c5, 0x03c6, 0x03c7, 0x03c8, 0x03c9, 0x0401, 0x0410, 0x0411,
+    0x0412, 0x0413, 0x0414, 0x0415, 0x0416, 0x0417, 0x0418, 0x0419,
+    0x041a, 0x041b, 0x041c, 0x041d, 0x041e, 0x041f, 0x0420, 0x0421,
+    0x0422, 0x0423, 0x0424, 0x0425, 0x0426, 0x0427, 0x0428, 0x0429,
+    0x042a, 0x042b, 0x042c, 0x042d, 0x042e, 0x042f, 0x0430, 0x0431,
+    0x0432, 0x0433, 0x0434, 0x0435, 0x0436, 0x0437, 0x0438, 0x0439,
+    0x043a, 0x043b, 0x043c, 0x043d, 0x043e, 0x043f, 0x0440, 0x0441,
+    0x0442, 0x0443, 0x0444, 0x0445, 0x0446, 0x0447, 0x0448, 0x0449,
+    0x044a, 0x044b, 0x044c, 0x044d, 0x044e, 0x044f, 0x0451, 0x2014,
+    0x2018, 0x2019, 0x201c, 0x201d, 0x201e, 0x2022, 0x2023, 0x2026,
+    0x2190, 0x2191, 0x2192, 0x2193, 0x2196, 0x2197, 0x2198, 0x2199,
+    0x21b0, 0x21b1, 0x21b2, 0x21b3, 0x21b4, 0x2200, 0x2202, 0x2203,
+    0x2204, 0x2205, 0x2206, 0x2207, 0x2208, 0x2209, 0x220b, 0x220c,
+    0x220e, 0x220f, 0x2210, 0x2211, 0x2212, 0x2217, 0x2218, 0x2219,
+    0x221a, 0x221e, 0x221f, 0x2220, 0x2223, 0x2224, 0x2225, 0x2226,
+    0x2227, 0x2228, 0x2229, 0x222a, 0x222b, 0x2243, 0x2245, 0x2248,
+    0x2260, 0x2261, 0x2262, 0x2264, 0x2265, 0x226a, 0x226b, 0x2282,
+    0x2283, 0x2284, 0x2285, 0x2286, 0x2287, 0x2288, 0x2289, 0x2295,
+    0x2296, 0x2297, 0x2298, 0x2299, 0x229a, 0x229c, 0x22a5, 0x22b9,
+    0x22bb, 0x22bc, 0x22bd, 0x22bf, 0x22c0, 0x22c1, 0x22c2, 0x22c3,
+    0x22c4, 0x22c5, 0x22c6, 0x22ee, 0x22ef, 0x22f0, 0x22f1, 0x2308,
+    0x2309, 0x230a, 0x230b, 0x231b, 0x23e9, 0x23ea, 0x23eb, 0x23ec,
+    0x23ed, 0x23ee, 0x23ef, 0x23f0, 0x23f4, 0x23f5, 0x23f6, 0x23f7,
+    0x23f8, 0x23f9, 0x23fa, 0x23fb, 0x23fe, 0xfffd,
+};
+
+// Pages of 8 rows, each is one byte per column from left to right and the least significant
+// bit is the top pixel. Glyphs which look the same share a bitmap.
+static uint8_t const font8x8_column_bitmaps[font8x8_bitmap_count][font8x8_glyph_page_count][font8x8_glyph_width] = {
+    { // U+0020 ' '
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    },
+    { // U+0021 '!'
+        {0x00, 0x00, 0x00, 0x00, 0x5e, 0x5e, 0x00, 0x00},
+    },
+    { // U+0022 '"'
+        {0x00, 0x00, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x00},
+    },
+    { // U+0023 '#'
+        {0x00, 0x24, 0x7e, 0x7e, 0x24, 0x7e, 0x7e, 0x24},
+    },
+    { // U+0024 '$'
+        {0x00, 0x6e, 0x6e, 0x4a, 0xff, 0x4a, 0x7a, 0x7a},
+    },
+    { // U+0025 '%'
+        {0x00, 0x4e, 0x6a, 0x2e, 0x18, 0x74, 0x56, 0x72},
+    },
+    { // U+0026 '&'
+        {0x00, 0x78, 0x4e, 0x4a, 0x5a, 0x7e, 0x70, 0x58},
+    },
+    { // U+0027 '''
+        {0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00},
+    },
+    { // U+0028 '('
+        {0x00, 0x00, 0x00, 0x3c, 0x66, 0x42, 0x00, 0x00},
+    },
+    { // U+0029 ')'
+        {0x00, 0x00, 0x00, 0x42, 0x66, 0x3c, 0x00, 0x00},
+    },
+    { // U+002A '*'
+        {0x00, 0x00, 0x14, 0x1c, 0x0e, 0x1c, 0x14, 0x00},
+    },
+    { // U+002B '+'
+        {0x00, 0x00, 0x10, 0x10, 0x7c, 0x10, 0x10, 0x00},
+    },
+    { // U+002C ',', U+002C ','
+        {0x00, 0x00, 0x00, 0x00, 0x60, 0xe0, 0x00, 0x00},
+    },
+    { // U+002D '-'
+        {0x00, 0x00, 0x00, 0x10, 0x10, 0x10, 0x00, 0x00},
+    },
+    { // U+002E '.'
+        {0x00, 0x00, 0x00, 0x00, 0x60, 0x60, 0x00, 0x00},
+    },
+    { // U+002F '/'
+        {0x00, 0x00, 0x60, 0x30, 0x18, 0x0c, 0x06, 0x00},
+    },
+    { // U+0030 '0'
+        {0x00, 0x00, 0x3c, 0x7e, 0x42, 0x7e, 0x3c, 0x00},
+    },
+    { // U+0031 '1'
+        {0x00, 0x00, 0x48, 0x4c, 0x7e, 0x7e, 0x40, 0x00},
+    },
+    { // U+0032 '2'
+        {0x00, 0x00, 0x66, 0x76, 0x52, 0x5e, 0x4e, 0x00},
+    },
+    { // U+0033 '3'
+        {0x00, 0x00, 0x66, 0x62, 0x4a, 0x7e, 0x76, 0x00},
+    },
+    { // U+0034 '4'
+        {0x00, 0x00, 0x38, 0x3c, 0x26, 0x7e, 0x7e, 0x20},
+    },
+    { // U+0035 '5'
+        {0x00, 0x00, 0x6e, 0x6e, 0x4a, 0x7a, 0x32, 0x00},
+    },
+    { // U+0036 '6'
+        {0x00, 0x00, 0x7c, 0x7e, 0x52, 0x76, 0x76, 0x00},
+    },
+    { // U+0037 '7'
+        {0x00, 0x00, 0x02, 0x62, 0x7a, 0x1e, 0x0e, 0x00},
+    },
+    { // U+0038 '8'
+        {0x00, 0x00, 0x78, 0x7e, 0x4a, 0x7e, 0x78, 0x00},
+    },
+    { // U+0039 '9'
+        {0x00, 0x00, 0x6e, 0x6e, 0x4a, 0x7e, 0x3e, 0x00},
+    },
+    { // U+003A ':'
+        {0x00, 0x00, 0x00, 0x00, 0x6c, 0x6c, 0x00, 0x00},
+    },
+    { // U+003B ';'
+        {0x00, 0x00, 0x00, 0x00, 0x6c, 0xec, 0x00, 0x00},
+    },
+    { // U+003C '<'
+        {0x00, 0x00, 0x10, 0x38, 0x28, 0x6c, 0x44, 0x00},
+    },
+    { // U+003D '='
+        {0x00, 0x00, 0x28, 0x28, 0x28, 0x28, 0x28, 0x00},
+    },
+    { // U+003E '>'
+        {0x00, 0x00, 0x44, 0x6c, 0x28, 0x38, 0x10, 0x00},
+    },
+    { // U+003F '?'
+        {0x00, 0x00, 0x06, 0x06, 0x52, 0x5a, 0x0e, 0x0e},
+    },
+    { // U+0040 '@'
+        {0x00, 0x7c, 0xc6, 0xb2, 0x2a, 0x7a, 0x46, 0x7c},
+    },
+    { // U+0041 'A', U+0391 'Α', U+0410 'А'
+        {0x00, 0x7c, 0x7e, 0x0a, 0x0a, 0x0a, 0x7e, 0x7c},
+    },
+    { // U+0042 'B', U+0392 'Β', U+0412 'В'
+        {0x00, 0x7e, 0x7e, 0x4a, 0x4a, 0x4e, 0x7c, 0x78},
+    },
+    { // U+0043 'C', U+0421 'С'
+        {0x00, 0x3c, 0x7e, 0x66, 0x42, 0x42, 0x66, 0x66},
+    },
+    { // U+0044 'D'
+        {0x00, 0x7e, 0x7e, 0x42, 0x42, 0x66, 0x7e, 0x3c},
+    },
+    { // U+0045 'E', U+0395 'Ε', U+0415 'Е'
+        {0x00, 0x7e, 0x7e, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a},
+    },
+    { // U+0046 'F'
+        {0x00, 0x7e, 0x7e, 0x0a, 0x0a, 0x0a, 0x02, 0x02},
+    },
+    { // U+0047 'G'
+        {0x00, 0x3c, 0x7e, 0x66, 0x4a, 0x4a, 0x7a, 0x7a},
+    },
+    { // U+0048 'H', U+0397 'Η', U+041D 'Н'
+        {0x00, 0x7e, 0x7e, 0x08, 0x08, 0x08, 0x7e, 0x7e},
+    },
+    { // U+0049 'I', U+0399 'Ι'
+        {0x00, 0x00, 0x00, 0x42, 0x7e, 0x7e, 0x42, 0x00},
+    },
+    { // U+004A 'J'
+        {0x00, 0x00, 0x62, 0x42, 0x7e, 0x7e, 0x02, 0x00},
+    },
+    { // U+004B 'K', U+039A 'Κ', U+041A 'К'
+        {0x00, 0x7e, 0x7e, 0x18, 0x1c, 0x3e, 0x76, 0x62},
+    },
+    { // U+004C 'L'
+        {0x00, 0x7e, 0x7e, 0x40, 0x40, 0x40, 0x40, 0x00},
+    },
+    { // U+004D 'M', U+039C 'Μ', U+041C 'М'
+        {0x00, 0x7e, 0x7e, 0x0c, 0x18, 0x0c, 0x7e, 0x7e},
+    },
+    { // U+004E 'N', U+039D 'Ν'
+        {0x00, 0x7e, 0x7e, 0x0e, 0x1c, 0x38, 0x7e, 0x7e},
+    },
+    { // U+004F 'O', U+039F 'Ο', U+041E 'О'
+        {0x00, 0x3c, 0x7e, 0x42, 0x42, 0x42, 0x7e, 0x3c},
+    },
+    { // U+0050 'P', U+0420 'Р'
+        {0x00, 0x7e, 0x7e, 0x0a, 0x0a, 0x0a, 0x0e, 0x0c},
+    },
+    { // U+0051 'Q'
+        {0x00, 0x3c, 0x7e, 0x42, 0x62, 0xe2, 0xfe, 0xbc},
+    },
+    { // U+0052 'R'
+        {0x00, 0x7e, 0x7e, 0x1a, 0x3a, 0x7a, 0x6e, 0x4c},
+    },
+    { // U+0053 'S'
+        {0x00, 0x6c, 0x6e, 0x4e, 0x4a, 0x7a, 0x7a, 0x3a},
+    },
+    { // U+0054 'T', U+0422 'Т'
+        {0x00, 0x00, 0x02, 0x02, 0x7e, 0x7e, 0x02, 0x02},
+    },
+    { // U+0055 'U'
+        {0x00, 0x3e, 0x7e, 0x60, 0x60, 0x60, 0x7e, 0x3e},
+    },
+    { // U+0056 'V'
+        {0x00, 0x06, 0x1e, 0x7c, 0x70, 0x7c, 0x1e, 0x06},
+    },
+    { // U+0057 'W'
+        {0x00, 0x7e, 0x7e, 0x30, 0x18, 0x30, 0x7e, 0x7e},
+    },
+    { // U+0058 'X', U+03A7 'Χ', U+0425 'Х'
+        {0x00, 0x62, 0x76, 0x3e, 0x1c, 0x3e, 0x76, 0x62},
+    },
+    { // U+0059 'Y', U+03A5 'Υ'
+        {0x00, 0x06, 0x0e, 0x7c, 0x78, 0x7c, 0x0e, 0x06},
+    },
+    { // U+005A 'Z'
+        {0x00, 0x42, 0x62, 0x72, 0x7a, 0x5e, 0x4e, 0x46},
+    },
+    { // U+005B '['
+        {0x00, 0x00, 0x00, 0x7e, 0x42, 0x42, 0x00, 0x00},
+    },
+    { // U+005C '\'
+        {0x00, 0x00, 0x06, 0x0c, 0x18, 0x30, 0x60, 0x00},
+    },
+    { // U+005D ']'
+        {0x00, 0x00, 0x00, 0x42, 0x42, 0x7e, 0x00, 0x00},
+    },
+    { // U+005E '^'
+        {0x00, 0x00, 0x18, 0x0c, 0x06, 0x0c, 0x18, 0x00},
+    },
+    { // U+005F '_'
+        {0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40},
+    },
+    { // U+0060 '`'
+        {0x00, 0x00, 0x00, 0x02, 0x06, 0x0c, 0x00, 0x00},
+    },
+    { // U+0061 'a', U+0430 'а'
+        {0x00, 0x74, 0x74, 0x54, 0x54, 0x54, 0x7c, 0x78},
+    },
+    { // U+0062 'b'
+        {0x00, 0x7e, 0x7e, 0x44, 0x44, 0x44, 0x7c, 0x78},
+    },
+    { // U+0063 'c', U+0441 'с'
+        {0x00, 0x38, 0x7c, 0x44, 0x44, 0x44, 0x6c, 0x6c},
+    },
+    { // U+0064 'd'
+        {0x00, 0x78, 0x7c, 0x44, 0x44, 0x44, 0x7e, 0x7e},
+    },
+    { // U+0065 'e', U+0435 'е'
+        {0x00, 0x7c, 0x7c, 0x54, 0x54, 0x54, 0x5c, 0x5c},
+    },
+    { // U+0066 'f'
+        {0x00, 0x7c, 0x7e, 0x0a, 0x0a, 0x02, 0x06, 0x06},
+    },
+    { // U+0067 'g'
+        {0x00, 0xb8, 0xbc, 0xa4, 0xa4, 0xa4, 0xfc, 0xfc},
+    },
+    { // U+0068 'h'
+        {0x00, 0x7e, 0x7e, 0x04, 0x04, 0x04, 0x7c, 0x78},
+    },
+    { // U+0069 'i'
+        {0x00, 0x00, 0x44, 0x45, 0x7d, 0x7d, 0x40, 0x00},
+    },
+    { // U+006A 'j'
+        {0x00, 0x00, 0xc4, 0x85, 0xfd, 0xfd, 0x04, 0x00},
+    },
+    { // U+006B 'k'
+        {0x00, 0x7e, 0x7e, 0x30, 0x38, 0x7c, 0x6c, 0x40},
+    },
+    { // U+006C 'l'
+        {0x00, 0x00, 0x42, 0x42, 0x7e, 0x7e, 0x40, 0x00},
+    },
+    { // U+006D 'm'
+        {0x00, 0x7c, 0x7c, 0x0c, 0x78, 0x0c, 0x7c, 0x78},
+    },
+    { // U+006E 'n'
+        {0x00, 0x7c, 0x7c, 0x04, 0x04, 0x04, 0x7c, 0x78},
+    },
+    { // U+006F 'o', U+043E 'о'
+        {0x00, 0x38, 0x7c, 0x44, 0x44, 0x44, 0x7c, 0x38},
+    },
+    { // U+0070 'p', U+0440 'р'
+        {0x00, 0xfc, 0xfc, 0x24, 0x24, 0x24, 0x3c, 0x38},
+    },
+    { // U+0071 'q'
+        {0x00, 0x38, 0x3c, 0x24, 0x24, 0x24, 0xfc, 0xfc},
+    },
+    { // U+0072 'r'
+        {0x00, 0x7c, 0x7c, 0x0c, 0x04, 0x04, 0x0c, 0x0c},
+    },
+    { // U+0073 's'
+        {0x00, 0x5c, 0x5c, 0x54, 0x54, 0x54, 0x74, 0x74},
+    },
+    { // U+0074 't'
+        {0x00, 0x00, 0x04, 0x7e, 0x7e, 0x44, 0x64, 0x00},
+    },
+    { // U+0075 'u'
+        {0x00, 0x3c, 0x7c, 0x40, 0x40, 0x40, 0x7c, 0x7c},
+    },
+    { // U+0076 'v'
+        {0x00, 0x1c, 0x3c, 0x60, 0x40, 0x60, 0x3c, 0x1c},
+    },
+    { // U+0077 'w'
+        {0x00, 0x1c, 0x3c, 0x60, 0x38, 0x60, 0x3c, 0x1c},
+    },
+    { // U+0078 'x', U+0445 'х'
+        {0x00, 0x6c, 0x6c, 0x38, 0x10, 0x38, 0x6c, 0x6c},
+    },
+    { // U+0079 'y', U+0443 'у'
+        {0x00, 0xbc, 0xbc, 0xa0, 0xa0, 0xa0, 0xfc, 0x7c},
+    },
+    { // U+007A 'z'
+        {0x00, 0x64, 0x74, 0x74, 0x54, 0x5c, 0x5c, 0x4c},
+    },
+    { // U+007B '{'
+        {0x00, 0x00, 0x00, 0x18, 0x7e, 0x42, 0x00, 0x00},
+    },
+    { // U+007C '|', U+2223 '∣'
+        {0x00, 0x00, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x00},
+    },
+    { // U+007D '}'
+        {0x00, 0x00, 0x00, 0x42, 0x7e, 0x18, 0x00, 0x00},
+    },
+    { // U+007E '~'
+        {0x00, 0x18, 0x0c, 0x0c, 0x18, 0x30, 0x30, 0x18},
+    },
+    { // U+00A7 '§'
+        {0x00, 0x00, 0x5c, 0x56, 0x66, 0x6a, 0x3a, 0x00},
+    },
+    { // U+00A9 '©'
+        {0x00, 0x1c, 0x22, 0x5d, 0x55, 0x55, 0x22, 0x1c},
+    },
+    { // U+00AB '«'
+        {0x00, 0x10, 0x38, 0x6c, 0x10, 0x38, 0x6c, 0x00},
+    },
+    { // U+00AC '¬'
+        {0x00, 0x00, 0x10, 0x10, 0x10, 0x10, 0x70, 0x00},
+    },
+    { // U+00AE '®'
+        {0x00, 0x1c, 0x22, 0x5d, 0x4d, 0x55, 0x22, 0x1c},
+    },
+    { // U+00B0 '°'
+        {0x00, 0x00, 0x00, 0x0e, 0x0a, 0x0e, 0x00, 0x00},
+    },
+    { // U+00B1 '±'
+        {0x00, 0x00, 0x00, 0x48, 0x5c, 0x48, 0x00, 0x00},
+    },
+    { // U+00B6 '¶'
+        {0x00, 0x00, 0x0c, 0x1e, 0x1e, 0x00, 0x7e, 0x00},
+    },
+    { // U+00B7 '·'
+        {0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00},
+    },
+    { // U+00BB '»'
+        {0x00, 0x00, 0x6c, 0x38, 0x10, 0x6c, 0x38, 0x10},
+    },
+    { // U+00D7 '×'
+        {0x00, 0x00, 0x6c, 0x38, 0x10, 0x38, 0x6c, 0x00},
+    },
+    { // U+00F7 '÷'
+        {0x00, 0x00, 0x10, 0x10, 0x54, 0x10, 0x10, 0x00},
+    },
+    { // U+0393 'Γ'
+        {0x00, 0x7e, 0x7e, 0x02, 0x02, 0x02, 0x06, 0x06},
+    },
+    { // U+0394 'Δ'
+        {0x00, 0x60, 0x78, 0x5e, 0x46, 0x5e, 0x78, 0x60},
+    },
+    { // U+0396 'Ζ'
+        {0x00, 0x46, 0x66, 0x72, 0x7a, 0x5e, 0x4e, 0x66},
+    },
+    { // U+0398 'Θ'
+        {0x00, 0x3c, 0x7e, 0x4a, 0x4a, 0x4a, 0x7e, 0x3c},
+    },
+    { // U+039B 'Λ'
+        {0x00, 0x60, 0x78, 0x1e, 0x06, 0x1e, 0x78, 0x60},
+    },
+    { // U+039E 'Ξ'
+        {0x00, 0x62, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x62},
+    },
+    { // U+03A0 'Π', U+041F 'П'
+        {0x00, 0x7e, 0x7e, 0x02, 0x02, 0x02, 0x7e, 0x7e},
+    },
+    { // U+03A1 'Ρ'
+        {0x00, 0x7e, 0x7e, 0x0a, 0x0a, 0x0a, 0x0e, 0x0e},
+    },
+    { // U+03A3 'Σ'
+        {0x00, 0x62, 0x76, 0x7e, 0x5a, 0x4a, 0x42, 0x42},
+    },
+    { // U+03A4 'Τ'
+        {0x00, 0x00, 0x06, 0x02, 0x7e, 0x7e, 0x02, 0x06},
+    },
+    { // U+03A6 'Φ', U+0424 'Ф'
+        {0x00, 0x1c, 0x3e, 0x22, 0x7e, 0x22, 0x3e, 0x1c},
+    },
+    { // U+03A8 'Ψ'
+        {0x00, 0x0e, 0x1e, 0x10, 0x7e, 0x10, 0x1e, 0x0e},
+    },
+    { // U+03A9 'Ω'
+        {0x00, 0x5c, 0x7e, 0x66, 0x02, 0x66, 0x7e, 0x5c},
+    },
+    { // U+03B1 'α'
+        {0x00, 0x78, 0x7c, 0x4c, 0x64, 0x3c, 0x78, 0x5c},
+    },
+    { // U+03B2 'β'
+        {0x00, 0xf8, 0xfc, 0x54, 0x54, 0x5c, 0x7c, 0x70},
+    },
+    { // U+03B3 'γ'
+        {0x00, 0x0c, 0x1c, 0x78, 0xe0, 0xf8, 0x1c, 0x0c},
+    },
+    { // U+03B4 'δ'
+        {0x00, 0x00, 0x36, 0x7e, 0x5a, 0x5a, 0x7a, 0x32},
+    },
+    { // U+03B5 'ε'
+        {0x00, 0x00, 0x6c, 0x7c, 0x54, 0x44, 0x6c, 0x00},
+    },
+    { // U+03B6 'ζ'
+        {0x00, 0x00, 0x32, 0x7a, 0x4e, 0xc6, 0xc2, 0x00},
+    },
+    { // U+03B7 'η'
+        {0x00, 0x3c, 0x3c, 0x08, 0x04, 0x04, 0xfc, 0xf8},
+    },
+    { // U+03B8 'θ'
+        {0x00, 0x38, 0x7c, 0x54, 0x54, 0x54, 0x7c, 0x38},
+    },
+    { // U+03B9 'ι'
+        {0x00, 0x00, 0x04, 0x3c, 0x7c, 0x60, 0x60, 0x00},
+    },
+    { // U+03BA 'κ', U+043A 'к'
+        {0x00, 0x7c, 0x7c, 0x30, 0x38, 0x7c, 0x6c, 0x44},
+    },
+    { // U+03BB 'λ'
+        {0x00, 0x62, 0x76, 0x3e, 0x1c, 0x38, 0x70, 0x60},
+    },
+    { // U+03BC 'μ'
+        {0x00, 0xfc, 0xfc, 0x20, 0x30, 0x1c, 0x3c, 0x20},
+    },
+    { // U+03BD 'ν'
+        {0x00, 0x0c, 0x1c, 0x38, 0x60, 0x70, 0x3c, 0x1c},
+    },
+    { // U+03BE 'ξ'
+        {0x00, 0x00, 0x3a, 0x7e, 0x6e, 0xca, 0xca, 0x00},
+    },
+    { // U+03BF 'ο'
+        {0x00, 0x38, 0x7c, 0x6c, 0x44, 0x6c, 0x7c, 0x38},
+    },
+    { // U+03C0 'π'
+        {0x00, 0x04, 0x7c, 0x7c, 0x04, 0x7c, 0x7c, 0x44},
+    },
+    { // U+03C1 'ρ'
+        {0x00, 0xf8, 0xfc, 0x24, 0x24, 0x3c, 0x3c, 0x18},
+    },
+    { // U+03C2 'ς'
+        {0x00, 0x00, 0x38, 0x7c, 0x44, 0xcc, 0xcc, 0x00},
+    },
+    { // U+03C3 'σ'
+        {0x00, 0x00, 0x38, 0x7c, 0x44, 0x7c, 0x3c, 0x04},
+    },
+    { // U+03C4 'τ'
+        {0x00, 0x04, 0x04, 0x3c, 0x7c, 0x64, 0x64, 0x00},
+    },
+    { // U+03C5 'υ'
+        {0x00, 0x00, 0x3c, 0x7c, 0x60, 0x6c, 0x7c, 0x78},
+    },
+    { // U+03C6 'φ'
+        {0x00, 0x1c, 0x3c, 0x20, 0xfc, 0xfc, 0x24, 0x3c},
+    },
+    { // U+03C7 'χ'
+        {0x00, 0x00, 0xcc, 0xfc, 0x30, 0xfc, 0xcc, 0x00},
+    },
+    { // U+03C8 'ψ'
+        {0x00, 0x38, 0x78, 0x40, 0xfc, 0x40, 0x78, 0x38},
+    },
+    { // U+03C9 'ω'
+        {0x00, 0x3c, 0x7c, 0x60, 0x38, 0x60, 0x7c, 0x3c},
+    },
+    { // U+0401 'Ё'
+        {0x00, 0x7e, 0x7f, 0x4a, 0x4a, 0x4a, 0x4b, 0x4a},
+    },
+    { // U+0411 'Б'
+        {0x00, 0x7e, 0x7e, 0x4a, 0x4a, 0x4a, 0x7a, 0x7a},
+    },
+    { // U+0413 'Г'
+        {0x00, 0x7e, 0x7e, 0x02, 0x02, 0x02, 0x02, 0x00},
+    },
+    { // U+0414 'Д'
+        {0x00, 0xe0, 0xfe, 0x62, 0x62, 0x7e, 0xfe, 0xe0},
+    },
+    { // U+0416 'Ж'
+        {0x00, 0x76, 0x7e, 0x08, 0x7e, 0x08, 0x7e, 0x76},
+    },
+    { // U+0417 'З'
+        {0x00, 0x4a, 0x4a, 0x4a, 0x4a, 0x7e, 0x7e, 0x34},
+    },
+    { // U+0418 'И'
+        {0x00, 0x7e, 0x7e, 0x30, 0x18, 0x0c, 0x7e, 0x7e},
+    },
+    { // U+0419 'Й'
+        {0x00, 0x7e, 0x7e, 0x31, 0x19, 0x0d, 0x7e, 0x7e},
+    },
+    { // U+041B 'Л'
+        {0x00, 0x70, 0x7c, 0x0e, 0x06, 0x0e, 0x7c, 0x70},
+    },
+    { // U+0423 'У'
+        {0x00, 0x46, 0x6e, 0x7c, 0x38, 0x1c, 0x0e, 0x06},
+    },
+    { // U+0426 'Ц'
+        {0x00, 0x7e, 0x7e, 0x60, 0x60, 0x7e, 0xfe, 0xc0},
+    },
+    { // U+0427 'Ч'
+        {0x00, 0x0e, 0x0e, 0x08, 0x08, 0x08, 0x7e, 0x7e},
+    },
+    { // U+0428 'Ш'
+        {0x00, 0x7e, 0x7e, 0x60, 0x7e, 0x60, 0x7e, 0x7e},
+    },
+    { // U+0429 'Щ'
+        {0x00, 0x7e, 0x7e, 0x60, 0x7e, 0x60, 0x7e, 0xfe},
+    },
+    { // U+042A 'Ъ'
+        {0xc0, 0x06, 0x7e, 0x7e, 0x48, 0x78, 0x78, 0x00},
+    },
+    { // U+042B 'Ы'
+        {0x00, 0x7e, 0x7e, 0x48, 0x78, 0x00, 0x7e, 0x7e},
+    },
+    { // U+042C 'Ь'
+        {0x00, 0x00, 0x7e, 0x7e, 0x48, 0x78, 0x78, 0x00},
+    },
+    { // U+042D 'Э'
+        {0x00, 0x42, 0x4a, 0x4a, 0x4a, 0x4a, 0x7e, 0x3c},
+    },
+    { // U+042E 'Ю'
+        {0x00, 0x7e, 0x7e, 0x08, 0x7e, 0x62, 0x7e, 0x7e},
+    },
+    { // U+042F 'Я'
+        {0x00, 0x4c, 0x6e, 0x7a, 0x3a, 0x1a, 0x7e, 0x7e},
+    },
+    { // U+0431 'б'
+        {0x00, 0x7c, 0x7c, 0x54, 0x54, 0x54, 0x74, 0x74},
+    },
+    { // U+0432 'в'
+        {0x00, 0x7c, 0x7c, 0x54, 0x54, 0x54, 0x7c, 0x28},
+    },
+    { // U+0433 'г'
+        {0x00, 0x7c, 0x7c, 0x04, 0x04, 0x04, 0x04, 0x04},
+    },
+    { // U+0434 'д'
+        {0x00, 0xc0, 0xfc, 0x7c, 0x44, 0x7c, 0xfc, 0xc0},
+    },
+    { // U+0436 'ж'
+        {0x00, 0x6c, 0x7c, 0x10, 0x7c, 0x10, 0x7c, 0x6c},
+    },
+    { // U+0437 'з'
+        {0x00, 0x54, 0x54, 0x54, 0x54, 0x7c, 0x7c, 0x28},
+    },
+    { // U+0438 'и'
+        {0x00, 0x7c, 0x7c, 0x60, 0x30, 0x18, 0x7c, 0x7c},
+    },
+    { // U+0439 'й'
+        {0x00, 0x7c, 0x7c, 0x62, 0x32, 0x1a, 0x7c, 0x7c},
+    },
+    { // U+043B 'л'
+        {0x00, 0x60, 0x70, 0x38, 0x1c, 0x0c, 0x7c, 0x7c},
+    },
+    { // U+043C 'м'
+        {0x00, 0x7c, 0x7c, 0x18, 0x30, 0x18, 0x7c, 0x7c},
+    },
+    { // U+043D 'н'
+        {0x00, 0x7c, 0x7c, 0x10, 0x10, 0x10, 0x7c, 0x7c},
+    },
+    { // U+043F 'п'
+        {0x00, 0x7c, 0x7c, 0x04, 0x04, 0x04, 0x7c, 0x7c},
+    },
+    { // U+0442 'т'
+        {0x00, 0x00, 0x04, 0x04, 0x7c, 0x7c, 0x04, 0x04},
+    },
+    { // U+0444 'ф'
+        {0x00, 0x38, 0x3c, 0x24, 0xfc, 0x24, 0x3c, 0x38},
+    },
+    { // U+0446 'ц'
+        {0x00, 0x7c, 0x7c, 0x40, 0x40, 0x7c, 0xfc, 0xc0},
+    },
+    { // U+0447 'ч'
+        {0x00, 0x1c, 0x1c, 0x10, 0x10, 0x10, 0x7c, 0x7c},
+    },
+    { // U+0448 'ш'
+        {0x00, 0x7c, 0x7c, 0x40, 0x7c, 0x40, 0x7c, 0x7c},
+    },
+    { // U+0449 'щ'
+        {0x00, 0x7c, 0x7c, 0x40, 0x7c, 0x40, 0x7c, 0xfc},
+    },
+    { // U+044A 'ъ'
+        {0xc0, 0x04, 0x7c, 0x7c, 0x50, 0x70, 0x70, 0x00},
+    },
+    { // U+044B 'ы'
+        {0x00, 0x7c, 0x7c, 0x50, 0x70, 0x00, 0x7c, 0x7c},
+    },
+    { // U+044C 'ь'
+        {0x00, 0x00, 0x7c, 0x7c, 0x50, 0x70, 0x70, 0x00},
+    },
+    { // U+044D 'э'
+        {0x00, 0x44, 0x54, 0x54, 0x54, 0x54, 0x7c, 0x7c},
+    },
+    { // U+044E 'ю'
+        {0x00, 0x7c, 0x7c, 0x10, 0x7c, 0x44, 0x7c, 0x7c},
+    },
+    { // U+044F 'я'
+        {0x00, 0x5c, 0x5c, 0x74, 0x34, 0x34, 0x7c, 0x7c},
+    },
+    { // U+0451 'ё'
+        {0x00, 0x7c, 0x7d, 0x54, 0x54, 0x54, 0x5d, 0x5c},
+    },
+    { // U+2014 '—'
+        {0x00, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10},
+    },
+    { // U+2018 '‘'
+        {0x00, 0x00, 0x00, 0x00, 0x0e, 0x0c, 0x00, 0x00},
+    },
+    { // U+2019 '’'
+        {0x00, 0x00, 0x00, 0x00, 0x06, 0x0e, 0x00, 0x00},
+    },
+    { // U+201C '“'
+        {0x00, 0x00, 0x0e, 0x0c, 0x00, 0x0e, 0x0c, 0x00},
+    },
+    { // U+201D '”'
+        {0x00, 0x00, 0x06, 0x0e, 0x00, 0x06, 0x0e, 0x00},
+    },
+    { // U+201E '„'
+        {0x00, 0x00, 0x60, 0xe0, 0x00, 0x60, 0xe0, 0x00},
+    },
+    { // U+2022 '•'
+        {0x00, 0x00, 0x00, 0x38, 0x38, 0x38, 0x00, 0x00},
+    },
+    { // U+2023 '‣', U+23F5 '⏵'
+        {0x00, 0x00, 0x00, 0x7c, 0x38, 0x10, 0x00, 0x00},
+    },
+    { // U+2026 '…'
+        {0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00},
+    },
+    { // U+2190 '←'
+        {0x00, 0x18, 0x3c, 0x7e, 0x18, 0x18, 0x18, 0x00},
+    },
+    { // U+2191 '↑'
+        {0x00, 0x00, 0x08, 0x0c, 0x7e, 0x7e, 0x0c, 0x08},
+    },
+    { // U+2192 '→'
+        {0x00, 0x00, 0x18, 0x18, 0x18, 0x7e, 0x3c, 0x18},
+    },
+    { // U+2193 '↓'
+        {0x00, 0x00, 0x10, 0x30, 0x7e, 0x7e, 0x30, 0x10},
+    },
+    { // U+2196 '↖'
+        {0x00, 0x00, 0x1e, 0x0e, 0x1e, 0x3a, 0x30, 0x00},
+    },
+    { // U+2197 '↗'
+        {0x00, 0x00, 0x30, 0x3a, 0x1e, 0x0e, 0x1e, 0x00},
+    },
+    { // U+2198 '↘'
+        {0x00, 0x00, 0x06, 0x2e, 0x3c, 0x38, 0x3c, 0x00},
+    },
+    { // U+2199 '↙'
+        {0x00, 0x00, 0x3c, 0x38, 0x3c, 0x2e, 0x06, 0x00},
+    },
+    { // U+21B0 '↰'
+        {0x00, 0x00, 0x18, 0x3c, 0x7e, 0x18, 0x78, 0x78},
+    },
+    { // U+21B1 '↱'
+        {0x00, 0x00, 0x78, 0x78, 0x18, 0x7e, 0x3c, 0x18},
+    },
+    { // U+21B2 '↲'
+        {0x00, 0x00, 0x18, 0x3c, 0x7e, 0x18, 0x1e, 0x1e},
+    },
+    { // U+21B3 '↳'
+        {0x00, 0x00, 0x1e, 0x1e, 0x18, 0x7e, 0x3c, 0x18},
+    },
+    { // U+21B4 '↴'
+        {0x00, 0x00, 0x16, 0x36, 0x7e, 0x7e, 0x30, 0x10},
+    },
+    { // U+2200 '∀'
+        {0x00, 0x06, 0x1e, 0x78, 0x68, 0x78, 0x1e, 0x06},
+    },
+    { // U+2202 '∂'
+        {0x00, 0x00, 0x00, 0x7a, 0x4a, 0x7e, 0x00, 0x00},
+    },
+    { // U+2203 '∃'
+        {0x00, 0x00, 0x4a, 0x4a, 0x4a, 0x4a, 0x7e, 0x00},
+    },
+    { // U+2204 '∄'
+        {0x00, 0x00, 0x4a, 0x4a, 0xff, 0x4a, 0x7e, 0x00},
+    },
+    { // U+2205 '∅'
+        {0x00, 0x40, 0x38, 0x64, 0x54, 0x4c, 0x38, 0x04},
+    },
+    { // U+2206 '∆'
+        {0x00, 0x60, 0x78, 0x4e, 0x42, 0x4e, 0x78, 0x60},
+    },
+    { // U+2207 '∇'
+        {0x00, 0x06, 0x1e, 0x72, 0x42, 0x72, 0x1e, 0x06},
+    },
+    { // U+2208 '∈'
+        {0x00, 0x00, 0x38, 0x7c, 0x54, 0x54, 0x54, 0x00},
+    },
+    { // U+2209 '∉'
+        {0x00, 0x00, 0x38, 0x7c, 0x54, 0xfe, 0x54, 0x00},
+    },
+    { // U+220B '∋'
+        {0x00, 0x00, 0x54, 0x54, 0x54, 0x7c, 0x38, 0x00},
+    },
+    { // U+220C '∌'
+        {0x00, 0x00, 0x54, 0xfe, 0x54, 0x7c, 0x38, 0x00},
+    },
+    { // U+220E '∎'
+        {0x00, 0x00, 0x00, 0x7c, 0x7c, 0x7c, 0x00, 0x00},
+    },
+    { // U+220F '∏'
+        {0x00, 0x00, 0x7e, 0x02, 0x02, 0x02, 0x7e, 0x00},
+    },
+    { // U+2210 '∐'
+        {0x00, 0x00, 0x7e, 0x40, 0x40, 0x40, 0x7e, 0x00},
+    },
+    { // U+2211 '∑'
+        {0x00, 0x00, 0x62, 0x76, 0x5a, 0x4a, 0x42, 0x00},
+    },
+    { // U+2212 '−'
+        {0x00, 0x00, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00},
+    },
+    { // U+2217 '∗'
+        {0x00, 0x00, 0x6c, 0x38, 0x7c, 0x38, 0x6c, 0x00},
+    },
+    { // U+2218 '∘'
+        {0x00, 0x00, 0x00, 0x38, 0x28, 0x38, 0x00, 0x00},
+    },
+    { // U+2219 '∙'
+        {0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00},
+    },
+    { // U+221A '√'
+        {0x00, 0x08, 0x08, 0x38, 0x60, 0x78, 0x1e, 0x06},
+    },
+    { // U+221E '∞'
+        {0x00, 0x18, 0x24, 0x34, 0x18, 0x2c, 0x24, 0x18},
+    },
+    { // U+221F '∟'
+        {0x00, 0x00, 0x7c, 0x40, 0x40, 0x40, 0x40, 0x00},
+    },
+    { // U+2220 '∠'
+        {0x00, 0x00, 0x40, 0x60, 0x50, 0x48, 0x40, 0x00},
+    },
+    { // U+2224 '∤'
+        {0x00, 0x00, 0x20, 0x10, 0x7e, 0x08, 0x04, 0x00},
+    },
+    { // U+2225 '∥'
+        {0x00, 0x00, 0x00, 0x7e, 0x00, 0x7e, 0x00, 0x00},
+    },
+    { // U+2226 '∦'
+        {0x00, 0x20, 0x10, 0x7e, 0x08, 0x7e, 0x04, 0x02},
+    },
+    { // U+2227 '∧'
+        {0x00, 0x00, 0x60, 0x38, 0x0c, 0x38, 0x60, 0x00},
+    },
+    { // U+2228 '∨'
+        {0x00, 0x00, 0x0c, 0x38, 0x60, 0x38, 0x0c, 0x00},
+    },
+    { // U+2229 '∩'
+        {0x00, 0x00, 0x78, 0x0c, 0x04, 0x0c, 0x78, 0x00},
+    },
+    { // U+222A '∪'
+        {0x00, 0x00, 0x3c, 0x60, 0x40, 0x60, 0x3c, 0x00},
+    },
+    { // U+222B '∫'
+        {0x00, 0x00, 0x70, 0x60, 0x7e, 0x06, 0x0e, 0x00},
+    },
+    { // U+2243 '≃'
+        {0x00, 0x58, 0x4c, 0x4c, 0x58, 0x50, 0x58, 0x4c},
+    },
+    { // U+2245 '≅'
+        {0x00, 0x56, 0x53, 0x53, 0x56, 0x54, 0x56, 0x53},
+    },
+    { // U+2248 '≈'
+        {0x00, 0x6c, 0x36, 0x36, 0x6c, 0x48, 0x6c, 0x36},
+    },
+    { // U+2260 '≠'
+        {0x00, 0x00, 0x28, 0x28, 0x7c, 0x28, 0x28, 0x00},
+    },
+    { // U+2261 '≡'
+        {0x00, 0x00, 0x54, 0x54, 0x54, 0x54, 0x54, 0x00},
+    },
+    { // U+2262 '≢'
+        {0x00, 0x00, 0x54, 0x54, 0xfe, 0x54, 0x54, 0x00},
+    },
+    { // U+2264 '≤'
+        {0x00, 0x00, 0x58, 0x5c, 0x54, 0x56, 0x52, 0x00},
+    },
+    { // U+2265 '≥'
+        {0x00, 0x00, 0x52, 0x56, 0x54, 0x5c, 0x58, 0x00},
+    },
+    { // U+226A '≪'
+        {0x00, 0x10, 0x38, 0x6c, 0x54, 0x38, 0x6c, 0x44},
+    },
+    { // U+226B '≫'
+        {0x00, 0x44, 0x6c, 0x38, 0x54, 0x6c, 0x38, 0x10},
+    },
+    { // U+2282 '⊂'
+        {0x00, 0x00, 0x38, 0x6c, 0x44, 0x44, 0x44, 0x44},
+    },
+    { // U+2283 '⊃'
+        {0x00, 0x00, 0x44, 0x44, 0x44, 0x44, 0x6c, 0x38},
+    },
+    { // U+2284 '⊄'
+        {0x00, 0x00, 0x38, 0x6c, 0x44, 0xfe, 0x44, 0x44},
+    },
+    { // U+2285 '⊅'
+        {0x00, 0x00, 0x44, 0x44, 0xfe, 0x44, 0x6c, 0x38},
+    },
+    { // U+2286 '⊆'
+        {0x00, 0x00, 0x4c, 0x5e, 0x52, 0x52, 0x52, 0x52},
+    },
+    { // U+2287 '⊇'
+        {0x00, 0x00, 0x52, 0x52, 0x52, 0x52, 0x5e, 0x4c},
+    },
+    { // U+2288 '⊈'
+        {0x00, 0x00, 0x4c, 0x5e, 0x52, 0xff, 0x52, 0x52},
+    },
+    { // U+2289 '⊉'
+        {0x00, 0x00, 0x52, 0x52, 0xff, 0x52, 0x5e, 0x4c},
+    },
+    { // U+2295 '⊕'
+        {0x00, 0x1c, 0x22, 0x49, 0x5d, 0x49, 0x22, 0x1c},
+    },
+    { // U+2296 '⊖'
+        {0x00, 0x1c, 0x22, 0x49, 0x49, 0x49, 0x22, 0x1c},
+    },
+    { // U+2297 '⊗'
+        {0x00, 0x1c, 0x22, 0x55, 0x49, 0x55, 0x22, 0x1c},
+    },
+    { // U+2298 '⊘'
+        {0x00, 0x1c, 0x22, 0x51, 0x49, 0x45, 0x22, 0x1c},
+    },
+    { // U+2299 '⊙'
+        {0x00, 0x1c, 0x22, 0x41, 0x49, 0x41, 0x22, 0x1c},
+    },
+    { // U+229A '⊚'
+        {0x00, 0x1c, 0x22, 0x5d, 0x55, 0x5d, 0x22, 0x1c},
+    },
+    { // U+229C '⊜'
+        {0x00, 0x1c, 0x22, 0x55, 0x55, 0x55, 0x22, 0x1c},
+    },
+    { // U+22A5 '⊥'
+        {0x00, 0x00, 0x40, 0x40, 0x7c, 0x40, 0x40, 0x00},
+    },
+    { // U+22B9 '⊹'
+        {0x00, 0x00, 0x10, 0x10, 0x6c, 0x10, 0x10, 0x00},
+    },
+    { // U+22BB '⊻'
+        {0x00, 0x00, 0x42, 0x4e, 0x58, 0x4e, 0x42, 0x00},
+    },
+    { // U+22BC '⊼'
+        {0x00, 0x00, 0x42, 0x72, 0x1a, 0x72, 0x42, 0x00},
+    },
+    { // U+22BD '⊽'
+        {0x00, 0x00, 0x0a, 0x3a, 0x62, 0x3a, 0x0a, 0x00},
+    },
+    { // U+22BF '⊿'
+        {0x00, 0x00, 0x40, 0x60, 0x70, 0x58, 0x4c, 0x7e},
+    },
+    { // U+22C0 '⋀'
+        {0x00, 0x40, 0x70, 0x1c, 0x06, 0x1c, 0x70, 0x40},
+    },
+    { // U+22C1 '⋁'
+        {0x00, 0x02, 0x0e, 0x38, 0x60, 0x38, 0x0e, 0x02},
+    },
+    { // U+22C2 '⋂'
+        {0x00, 0x00, 0x7c, 0x06, 0x02, 0x06, 0x7c, 0x00},
+    },
+    { // U+22C3 '⋃'
+        {0x00, 0x00, 0x3e, 0x60, 0x40, 0x60, 0x3e, 0x00},
+    },
+    { // U+22C4 '⋄'
+        {0x00, 0x00, 0x00, 0x18, 0x3c, 0x18, 0x00, 0x00},
+    },
+    { // U+22C5 '⋅'
+        {0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00},
+    },
+    { // U+22C6 '⋆'
+        {0x00, 0x00, 0x48, 0x78, 0x3c, 0x78, 0x48, 0x00},
+    },
+    { // U+22EE '⋮'
+        {0x00, 0x00, 0x00, 0x00, 0x4a, 0x00, 0x00, 0x00},
+    },
+    { // U+22EF '⋯'
+        {0x00, 0x10, 0x00, 0x00, 0x10, 0x00, 0x00, 0x10},
+    },
+    { // U+22F0 '⋰'
+        {0x00, 0x00, 0x40, 0x00, 0x10, 0x00, 0x04, 0x00},
+    },
+    { // U+22F1 '⋱'
+        {0x00, 0x00, 0x04, 0x00, 0x10, 0x00, 0x40, 0x00},
+    },
+    { // U+2308 '⌈'
+        {0x00, 0x00, 0x00, 0x7e, 0x02, 0x02, 0x00, 0x00},
+    },
+    { // U+2309 '⌉'
+        {0x00, 0x00, 0x00, 0x02, 0x02, 0x7e, 0x00, 0x00},
+    },
+    { // U+230A '⌊'
+        {0x00, 0x00, 0x00, 0x7e, 0x40, 0x40, 0x00, 0x00},
+    },
+    { // U+230B '⌋'
+        {0x00, 0x00, 0x00, 0x40, 0x40, 0x7e, 0x00, 0x00},
+    },
+    { // U+231B '⌛'
+        {0x00, 0x42, 0x66, 0x5a, 0x52, 0x5a, 0x66, 0x42},
+    },
+    { // U+23E9 '⏩'
+        {0x00, 0x7c, 0x38, 0x10, 0x00, 0x7c, 0x38, 0x10},
+    },
+    { // U+23EA '⏪'
+        {0x00, 0x10, 0x38, 0x7c, 0x00, 0x10, 0x38, 0x7c},
+    },
+    { // U+23EB '⏫'
+        {0x00, 0x00, 0x44, 0x66, 0x77, 0x66, 0x44, 0x00},
+    },
+    { // U+23EC '⏬'
+        {0x00, 0x00, 0x22, 0x66, 0xee, 0x66, 0x22, 0x00},
+    },
+    { // U+23ED '⏭'
+        {0x00, 0x7c, 0x38, 0x10, 0x7c, 0x38, 0x10, 0x7c},
+    },
+    { // U+23EE '⏮'
+        {0x00, 0x7c, 0x10, 0x38, 0x7c, 0x10, 0x38, 0x7c},
+    },
+    { // U+23EF '⏯'
+        {0x00, 0x7c, 0x38, 0x10, 0x00, 0x7c, 0x00, 0x7c},
+    },
+    { // U+23F0 '⏰'
+        {0x00, 0x00, 0x3a, 0x46, 0x5c, 0x56, 0x3a, 0x00},
+    },
+    { // U+23F4 '⏴'
+        {0x00, 0x00, 0x00, 0x10, 0x38, 0x7c, 0x00, 0x00},
+    },
+    { // U+23F6 '⏶'
+        {0x00, 0x00, 0x20, 0x30, 0x38, 0x30, 0x20, 0x00},
+    },
+    { // U+23F7 '⏷'
+        {0x00, 0x00, 0x08, 0x18, 0x38, 0x18, 0x08, 0x00},
+    },
+    { // U+23F8 '⏸'
+        {0x00, 0x00, 0x7c, 0x7c, 0x00, 0x7c, 0x7c, 0x00},
+    },
+    { // U+23F9 '⏹'
+        {0x00, 0x00, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x00},
+    },
+    { // U+23FA '⏺'
+        {0x00, 0x00, 0x38, 0x7c, 0x7c, 0x7c, 0x38, 0x00},
+    },
+    { // U+23FB '⏻'
+        {0x00, 0x1c, 0x22, 0x40, 0x4f, 0x40, 0x22, 0x1c},
+    },
+    { // U+23FE '⏾'
+        {0x00, 0x00, 0x3c, 0x7e, 0x76, 0x62, 0x62, 0x30},
+    },
+    { // U+FFFD '�'
+        {0x00, 0x18, 0x3c, 0x7a, 0xab, 0x76, 0x3c, 0x18},
+    },
+};
+
+// The same bitmaps scaled by font8x8_scale.
+static uint8_t const font8x8_column_bitmaps_scaled[font8x8_bitmap_count][font8x8_glyph_page_count * font8x8_scale][font8x8_glyph_width * font8x8_scale] = {
+    { // U+0020 ' '
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    },
+    { // U+0021 '!'
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xfc, 0xfc, 0xfc, 0x00, 0x00, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00},
+    },
+    { // U+0022 '"'
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xfc, 0x00, 0x00, 0xfc, 0xfc, 0x00, 0x00, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    },
+    { // U+0023 '#'
+        {0x00, 0x00, 0x30, 0x30, 0xfc, 0xfc, 0xfc, 0xfc, 0x30, 0x30, 0xfc, 0xfc, 0xfc, 0xfc, 0x30, 0x30},
+        {0x00, 0x00, 0x0c, 0x0c, 0x3f, 0x3f, 0x3f, 0x3f, 0x0c, 0x0c, 0x3f, 0x3f, 0x3f, 0x3f, 0x0c, 0x0c},
+    },
+    { // U+0024 '$'
+        {0x00, 0x00, 0xfc, 0xfc, 0xfc, 0xfc, 0xcc, 0xcc, 0xff, 0xff, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc},
+        {0x00, 0x00, 0x3c, 0x3c, 0x3c, 0x3c, 0x30, 0x30, 0xff, 0xff, 0x30, 0x30, 0x3f, 0x3f, 0x3f, 0x3f},
+    },
+    { // U+0025 '%'
+        {0x00, 0x00, 0xfc, 0xfc, 0xcc, 0xcc, 0xfc, 0xfc, 0xc0, 0xc0, 0x30, 0x30, 0x3c, 0x3c, 0x0c, 0x0c},
+        {0x00, 0x00, 0x30, 0x30, 0x3c, 0x3c, 0x0c, 0x0c, 0x03, 0x03, 0x3f, 0x3f, 0x33, 0x33, 0x3f, 0x3f},
+    },
+    { // U+0026 '&'
+        {0x00, 0x00, 0xc0, 0xc0, 0xfc, 0xfc, 0xcc, 0xcc, 0xcc, 0xcc, 0xfc, 0xfc, 0x00, 0x00, 0xc0, 0xc0},
+        {0x00, 0x00, 0x3f, 0x3f, 0x30, 0x30, 0x30, 0x30, 0x33, 0x33, 0x3f, 0x3f, 0x3f, 0x3f, 0x33, 0x33},
+    },
+    { // U+0027 '''
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    },
+    { // U+0028 '('
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xf0, 0x3c, 0x3c, 0x0c, 0x0c, 0x00, 0x00, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x0f, 0x3c, 0x3c, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00},
+    },
+    { // U+0029 ')'
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x0c, 0x3c, 0x3c, 0xf0, 0xf0, 0x00, 0x00, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x3c, 0x3c, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00},
+    },
+    { // U+002A '*'
+        {0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0xf0, 0xf0, 0xfc, 0xfc, 0xf0, 0xf0, 0x30, 0x30, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00},
+    },
+    { // U+002B '+'
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x3f, 0x3f, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00},
+    },
+    { // U+002C ',', U+002C ','
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x3c, 0xfc, 0xfc, 0x00, 0x00, 0x00, 0x00},
+    },
+    { // U+002D '-'
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00},
+    },
+    { // U+002E '.'
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x3c, 0x3c, 0x3c, 0x00, 0x00, 0x00, 0x00},
+    },
+    { // U+002F '/'
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xf0, 0xf0, 0x3c, 0x3c, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x3c, 0x3c, 0x0f, 0x0f, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    },
+    { // U+0030 '0'
+        {0x00, 0x00, 0x00, 0x00, 0xf0, 0xf0, 0xfc, 0xfc, 0x0c, 0x0c, 0xfc, 0xfc, 0xf0, 0xf0, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x0f, 0x0f, 0x3f, 0x3f, 0x30, 0x30, 0x3f, 0x3f, 0x0f, 0x0f, 0x00, 0x00},
+    },
+    { // U+0031 '1'
+        {0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xf0, 0xf0, 0xfc, 0xfc, 0xfc, 0xfc, 0x00, 0x00, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x30, 0x30, 0x3f, 0x3f, 0x3f, 0x3f, 0x30, 0x30, 0x00, 0x00},
+    },
+    { // U+0032 '2'
+        {0x00, 0x00, 0x00, 0x00, 0x3c, 0x3c, 0x3c, 0x3c, 0x0c, 0x0c, 0xfc, 0xfc, 0xfc, 0xfc, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x3c, 0x3c, 0x3f, 0x3f, 0x33, 0x33, 0x33, 0x33, 0x30, 0x30, 0x00, 0x00},
+    },
+    { // U+0033 '3'
+        {0x00, 0x00, 0x00, 0x00, 0x3c, 0x3c, 0x0c, 0x0c, 0xcc, 0xcc, 0xfc, 0xfc, 0x3c, 0x3c, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x3c, 0x3c, 0x3c, 0x3c, 0x30, 0x30, 0x3f, 0x3f, 0x3f, 0x3f, 0x00, 0x00},
+    },
+    { // U+0034 '4'
+        {0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xf0, 0xf0, 0x3c, 0x3c, 0xfc, 0xfc, 0xfc, 0xfc, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x0f, 0x0f, 0x0f, 0x0f, 0x0c, 0x0c, 0x3f, 0x3f, 0x3f, 0x3f, 0x0c, 0x0c},
+    },
+    { // U+0035 '5'
+        {0x00, 0x00, 0x00, 0x00, 0xfc, 0xfc, 0xfc, 0xfc, 0xcc, 0xcc, 0xcc, 0xcc, 0x0c, 0x0c, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x3c, 0x3c, 0x3c, 0x3c, 0x30, 0x30, 0x3f, 0x3f, 0x0f, 0x0f, 0x00, 0x00},
+    },
+    { // U+0036 '6'
+        {0x00, 0x00, 0x00, 0x00, 0xf0, 0xf0, 0xfc, 0xfc, 0x0c, 0x0c, 0x3c, 0x3c, 0x3c, 0x3c, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3f, 0x33, 0x33, 0x3f, 0x3f, 0x3f, 0x3f, 0x00, 0x00},
+    },
+    { // U+0037 '7'
+        {0x00, 0x00, 0x00, 0x00, 0x0c, 0x0c, 0x0c, 0x0c, 0xcc, 0xcc, 0xfc, 0xfc, 0xfc, 0xfc, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x3c, 0x3f, 0x3f, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00},
+    },
+    { // U+0038 '8'
+        {0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xfc, 0xfc, 0xcc, 0xcc, 0xfc, 0xfc, 0xc0, 0xc0, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3f, 0x30, 0x30, 0x3f, 0x3f, 0x3f, 0x3f, 0x00, 0x00},
+    },
+    { // U+0039 '9'
+        {0x00, 0x00, 0x00, 0x00, 0xfc, 0xfc, 0xfc, 0xfc, 0xcc, 0xcc, 0xfc, 0xfc, 0xfc, 0xfc, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x3c, 0x3c, 0x3c, 0x3c, 0x30, 0x30, 0x3f, 0x3f, 0x0f, 0x0f, 0x00, 0x00},
+    },
+    { // U+003A ':'
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xf0, 0xf0, 0xf0, 0x00, 0x00, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x3c, 0x3c, 0x3c, 0x00, 0x00, 0x00, 0x00},
+    },
+    { // U+003B ';'
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xf0, 0xf0, 0xf0, 0x00, 0x00, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x3c, 0xfc, 0xfc, 0x00, 0x00, 0x00, 0x00},
+    },
+    { // U+003C '<'
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0xf0, 0xf0, 0x30, 0x30, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x0f, 0x0f, 0x0c, 0x0c, 0x3c, 0x3c, 0x30, 0x30, 0x00, 0x00},
+    },
+    { // U+003D '='
+        {0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x00, 0x00},
+    },
+    { // U+003E '>'
+        {0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0xf0, 0xf0, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x3c, 0x3c, 0x0c, 0x0c, 0x0f, 0x0f, 0x03, 0x03, 0x00, 0x00},
+    },
+    { // U+003F '?'
+        {0x00, 0x00, 0x00, 0x00, 0x3c, 0x3c, 0x3c, 0x3c, 0x0c, 0x0c, 0xcc, 0xcc, 0xfc, 0xfc, 0xfc, 0xfc},
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00},
+    },
+    { // U+0040 '@'
+        {0x00, 0x00, 0xf0, 0xf0, 0x3c, 0x3c, 0x0c, 0x0c, 0xcc, 0xcc, 0xcc, 0xcc, 0x3c, 0x3c, 0xf0, 0xf0},
+        {0x00, 0x00, 0x3f, 0x3f, 0xf0, 0xf0, 0xcf, 0xcf, 0x0c, 0x0c, 0x3f, 0x3f, 0x30, 0x30, 0x3f, 0x3f},
+    },
+    { // U+0041 'A', U+0391 'Α', U+0410 'А'
+        {0x00, 0x00, 0xf0, 0xf0, 0xfc, 0xfc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xfc, 0xfc, 0xf0, 0xf0},
+        {0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3f},
+    },
+    { // U+0042 'B', U+0392 'Β', U+0412 'В'
+        {0x00, 0x00, 0xfc, 0xfc, 0xfc, 0xfc, 0xcc, 0xcc, 0xcc, 0xcc, 0xfc, 0xfc, 0xf0, 0xf0, 0xc0, 0xc0},
+        {0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3f, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x3f, 0x3f, 0x3f, 0x3f},
+    },
+    { // U+0043 'C', U+0421 'С'
+        {0x00, 0x00, 0xf0, 0xf0, 0xfc, 0xfc, 0x3c, 0x3c, 0x0c, 0x0c, 0x0c, 0x0c, 0x3c, 0x3c, 0x3c, 0x3c},
+        {0x00, 0x00, 0x0f, 0x0f, 0x3f, 0x3f, 0x3c, 0x3c, 0x30, 0x30, 0x30, 0x30, 0x3c, 0x3c, 0x3c, 0x3c},
+    },
+    { // U+0044 'D'
+        {0x00, 0x00, 0xfc, 0xfc, 0xfc, 0xfc, 0x0c, 0x0c, 0x0c, 0x0c, 0x3c, 0x3c, 0xfc, 0xfc, 0xf0, 0xf0},
+        {0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3f, 0x30, 0x30, 0x30, 0x30, 0x3c, 0x3c, 0x3f, 0x3f, 0x0f, 0x0f},
+    },
+    { // U+0045 'E', U+0395 'Ε', U+0415 'Е'
+        {0x00, 0x00, 0xfc, 0xfc, 0xfc, 0xfc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc},
+        {0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3f, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30},
+    },
+    { // U+0046 'F'
+        {0x00, 0x00, 0xfc, 0xfc, 0xfc, 0xfc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x0c, 0x0c, 0x0c, 0x0c},
+        {0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    },
+    { // U+0047 'G'
+        {0x00, 0x00, 0xf0, 0xf0, 0xfc, 0xfc, 0x3c, 0x3c, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc},
+        {0x00, 0x00, 0x0f, 0x0f, 0x3f, 0x3f, 0x3c, 0x3c, 0x30, 0x30, 0x30, 0x30, 0x3f, 0x3f, 0x3f, 0x3f},
+    },
+    { // U+0048 'H', U+0397 'Η', U+041D 'Н'
+        {0x00, 0x00, 0xfc, 0xfc, 0xfc, 0xfc, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xfc, 0xfc, 0xfc, 0xfc},
+        {0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3f},
+    },
+    { // U+0049 'I', U+0399 'Ι'
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x0c, 0xfc, 0xfc, 0xfc, 0xfc, 0x0c, 0x0c, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x3f, 0x3f, 0x3f, 0x3f, 0x30, 0x30, 0x00, 0x00},
+    },
+    { // U+004A 'J'
+        {0x00, 0x00, 0x00, 0x00, 0x0c, 0x0c, 0x0c, 0x0c, 0xfc, 0xfc, 0xfc, 0xfc, 0x0c, 0x0c, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x3c, 0x3c, 0x30, 0x30, 0x3f, 0x3f, 0x3f, 0x3f, 0x00, 0x00, 0x00, 0x00},
+    },
+    { // U+004B 'K', U+039A 'Κ', U+041A 'К'
+        {0x00, 0x00, 0xfc, 0xfc, 0xfc, 0xfc, 0xc0, 0xc0, 0xf0, 0xf0, 0xfc, 0xfc, 0x3c, 0x3c, 0x0c, 0x0c},
+        {0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3f, 0x03, 0x03, 0x03, 0x03, 0x0f, 0x0f, 0x3f, 0x3f, 0x3c, 0x3c},
+    },
+    { // U+004C 'L'
+        {0x00, 0x00, 0xfc, 0xfc, 0xfc, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+        {0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3f, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x00, 0x00},
+    },
+    { // U+004D 'M', U+039C 'Μ', U+041C 'М'
+        {0x00, 0x00, 0xfc, 0xfc, 0xfc, 0xfc, 0xf0, 0xf0, 0xc0, 0xc0, 0xf0, 0xf0, 0xfc, 0xfc, 0xfc, 0xfc},
+        {0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3f, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3f},
+    },
+    { // U+004E 'N', U+039D 'Ν'
+        {0x00, 0x00, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xf0, 0xf0, 0xc0, 0xc0, 0xfc, 0xfc, 0xfc, 0xfc},
+        {0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3f, 0x00, 0x00, 0x03, 0x03, 0x0f, 0x0f, 0x3f, 0x3f, 0x3f, 0x3f},
+    },
+    { // U+004F 'O', U+039F 'Ο', U+041E 'О'
+        {0x00, 0x00, 0xf0, 0xf0, 0xfc, 0xfc, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0xfc, 0xfc, 0xf0, 0xf0},
+        {0x00, 0x00, 0x0f, 0x0f, 0x3f, 0x3f, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x3f, 0x3f, 0x0f, 0x0f},
+    },
+    { // U+0050 'P', U+0420 'Р'
+        {0x00, 0x00, 0xfc, 0xfc, 0xfc, 0xfc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xfc, 0xfc, 0xf0, 0xf0},
+        {0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    },
+    { // U+0051 'Q'
+        {0x00, 0x00, 0xf0, 0xf0, 0xfc, 0xfc, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0xfc, 0xfc, 0xf0, 0xf0},
+        {0x00, 0x00, 0x0f, 0x0f, 0x3f, 0x3f, 0x30, 0x30, 0x3c, 0x3c, 0xfc, 0xfc, 0xff, 0xff, 0xcf, 0xcf},
+    },
+    { // U+0052 'R'
+        {0x00, 0x00, 0xfc, 0xfc, 0xfc, 0xfc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xfc, 0xfc, 0xf0, 0xf0},
+        {0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3f, 0x03, 0x03, 0x0f, 0x0f, 0x3f, 0x3f, 0x3c, 0x3c, 0x30, 0x30},
+    },
+    { // U+0053 'S'
+        {0x00, 0x00, 0xf0, 0xf0, 0xfc, 0xfc, 0xfc, 0xfc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc},
+        {0x00, 0x00, 0x3c, 0x3c, 0x3c, 0x3c, 0x30, 0x30, 0x30, 0x30, 0x3f, 0x3f, 0x3f, 0x3f, 0x0f, 0x0f},
+    },
+    { // U+0054 'T', U+0422 'Т'
+        {0x00, 0x00, 0x00, 0x00, 0x0c, 0x0c, 0x0c, 0x0c, 0xfc, 0xfc, 0xfc, 0xfc, 0x0c, 0x0c, 0x0c, 0x0c},
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3f, 0x00, 0x00, 0x00, 0x00},
+    },
+    { // U+0055 'U'
+        {0x00, 0x00, 0xfc, 0xfc, 0xfc, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xfc, 0xfc, 0xfc},
+        {0x00, 0x00, 0x0f, 0x0f, 0x3f, 0x3f, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3f, 0x3f, 0x0f, 0x0f},
+    },
+    { // U+0056 'V'
+        {0x00, 0x00, 0x3c, 0x3c, 0xfc, 0xfc, 0xf0, 0xf0, 0x00, 0x00, 0xf0, 0xf0, 0xfc, 0xfc, 0x3c, 0x3c},
+        {0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x03, 0x03, 0x00, 0x00},
+    },
+    { // U+0057 'W'
+        {0x00, 0x00, 0xfc, 0xfc, 0xfc, 0xfc, 0x00, 0x00, 0xc0, 0xc0, 0x00, 0x00, 0xfc, 0xfc, 0xfc, 0xfc},
+        {0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3f, 0x0f, 0x0f, 0x03, 0x03, 0x0f, 0x0f, 0x3f, 0x3f, 0x3f, 0x3f},
+    },
+    { // U+0058 'X', U+03A7 'Χ', U+0425 'Х'
+        {0x00, 0x00, 0x0c, 0x0c, 0x3c, 0x3c, 0xfc, 0xfc, 0xf0, 0xf0, 0xfc, 0xfc, 0x3c, 0x3c, 0x0c, 0x0c},
+        {0x00, 0x00, 0x3c, 0x3c, 0x3f, 0x3f, 0x0f, 0x0f, 0x03, 0x03, 0x0f, 0x0f, 0x3f, 0x3f, 0x3c, 0x3c},
+    },
+    { // U+0059 'Y', U+03A5 'Υ'
+        {0x00, 0x00, 0x3c, 0x3c, 0xfc, 0xfc, 0xf0, 0xf0, 0xc0, 0xc0, 0xf0, 0xf0, 0xfc, 0xfc, 0x3c, 0x3c},
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x00, 0x00, 0x00, 0x00},
+    },
+    { // U+005A 'Z'
+        {0x00, 0x00, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0xcc, 0xcc, 0xfc, 0xfc, 0xfc, 0xfc, 0x3c, 0x3c},
+        {0x00, 0x00, 0x30, 0x30, 0x3c, 0x3c, 0x3f, 0x3f, 0x3f, 0x3f, 0x33, 0x33, 0x30, 0x30, 0x30, 0x30},
+    },
+    { // U+005B '['
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xfc, 0x0c, 0x0c, 0x0c, 0x0c, 0x00, 0x00, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f, 0x30, 0x30, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00},
+    },
+    { // U+005C '\'
+        {0x00, 0x00, 0x00, 0x00, 0x3c, 0x3c, 0xf0, 0xf0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x0f, 0x0f, 0x3c, 0x3c, 0x00, 0x00},
+    },
+    { // U+005D ']'
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x0c, 0x0c, 0x0c, 0xfc, 0xfc, 0x00, 0x00, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x30, 0x30, 0x3f, 0x3f, 0x00, 0x00, 0x00, 0x00},
+    },
+    { // U+005E '^'
+        {0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xf0, 0xf0, 0x3c, 0x3c, 0xf0, 0xf0, 0xc0, 0xc0, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00},
+    },
+    { // U+005F '_'
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+        {0x00, 0x00, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30},
+    },
+    { // U+0060 '`'
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x0c, 0x3c, 0x3c, 0xf0, 0xf0, 0x00, 0x00, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    },
+    { // U+0061 'a', U+0430 'а'
+        {0x00, 0x00, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0xf0, 0xf0, 0xc0, 0xc0},
+        {0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3f, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3f, 0x3f, 0x3f, 0x3f},
+    },
+    { // U+0062 'b'
+        {0x00, 0x00, 0xfc, 0xfc, 0xfc, 0xfc, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0xf0, 0xf0, 0xc0, 0xc0},
+        {0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3f, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x3f, 0x3f, 0x3f, 0x3f},
+    },
+    { // U+0063 'c', U+0441 'с'
+        {0x00, 0x00, 0xc0, 0xc0, 0xf0, 0xf0, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0xf0, 0xf0, 0xf0, 0xf0},
+        {0x00, 0x00, 0x0f, 0x0f, 0x3f, 0x3f, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x3c, 0x3c, 0x3c, 0x3c},
+    },
+    { // U+0064 'd'
+        {0x00, 0x00, 0xc0, 0xc0, 0xf0, 0xf0, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0xfc, 0xfc, 0xfc, 0xfc},
+        {0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3f, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x3f, 0x3f, 0x3f, 0x3f},
+    },
+    { // U+0065 'e', U+0435 'е'
+        {0x00, 0x00, 0xf0, 0xf0, 0xf0, 0xf0, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0xf0, 0xf0, 0xf0, 0xf0},
+        {0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3f, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33},
+    },
+    { // U+0066 'f'
+        {0x00, 0x00, 0xf0, 0xf0, 0xfc, 0xfc, 0xcc, 0xcc, 0xcc, 0xcc, 0x0c, 0x0c, 0x3c, 0x3c, 0x3c, 0x3c},
+        {0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    },
+    { // U+0067 'g'
+        {0x00, 0x00, 0xc0, 0xc0, 0xf0, 0xf0, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0xf0, 0xf0, 0xf0, 0xf0},
+        {0x00, 0x00, 0xcf, 0xcf, 0xcf, 0xcf, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xff, 0xff, 0xff, 0xff},
+    },
+    { // U+0068 'h'
+        {0x00, 0x00, 0xfc, 0xfc, 0xfc, 0xfc, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0xf0, 0xf0, 0xc0, 0xc0},
+        {0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3f},
+    },
+    { // U+0069 'i'
+        {0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x33, 0x33, 0xf3, 0xf3, 0xf3, 0xf3, 0x00, 0x00, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x30, 0x30, 0x3f, 0x3f, 0x3f, 0x3f, 0x30, 0x30, 0x00, 0x00},
+    },
+    { // U+006A 'j'
+        {0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x33, 0x33, 0xf3, 0xf3, 0xf3, 0xf3, 0x30, 0x30, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0xf0, 0xf0, 0xc0, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00},
+    },
+    { // U+006B 'k'
+        {0x00, 0x00, 0xfc, 0xfc, 0xfc, 0xfc, 0x00, 0x00, 0xc0, 0xc0, 0xf0, 0xf0, 0xf0, 0xf0, 0x00, 0x00},
+        {0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3f, 0x0f, 0x0f, 0x0f, 0x0f, 0x3f, 0x3f, 0x3c, 0x3c, 0x30, 0x30},
+    },
+    { // U+006C 'l'
+        {0x00, 0x00, 0x00, 0x00, 0x0c, 0x0c, 0x0c, 0x0c, 0xfc, 0xfc, 0xfc, 0xfc, 0x00, 0x00, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x30, 0x30, 0x3f, 0x3f, 0x3f, 0x3f, 0x30, 0x30, 0x00, 0x00},
+    },
+    { // U+006D 'm'
+        {0x00, 0x00, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xc0, 0xc0, 0xf0, 0xf0, 0xf0, 0xf0, 0xc0, 0xc0},
+        {0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3f, 0x00, 0x00, 0x3f, 0x3f, 0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3f},
+    },
+    { // U+006E 'n'
+        {0x00, 0x00, 0xf0, 0xf0, 0xf0, 0xf0, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0xf0, 0xf0, 0xc0, 0xc0},
+        {0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3f},
+    },
+    { // U+006F 'o', U+043E 'о'
+        {0x00, 0x00, 0xc0, 0xc0, 0xf0, 0xf0, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0xf0, 0xf0, 0xc0, 0xc0},
+        {0x00, 0x00, 0x0f, 0x0f, 0x3f, 0x3f, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x3f, 0x3f, 0x0f, 0x0f},
+    },
+    { // U+0070 'p', U+0440 'р'
+        {0x00, 0x00, 0xf0, 0xf0, 0xf0, 0xf0, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0xf0, 0xf0, 0xc0, 0xc0},
+        {0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0f, 0x0f, 0x0f, 0x0f},
+    },
+    { // U+0071 'q'
+        {0x00, 0x00, 0xc0, 0xc0, 0xf0, 0xf0, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0xf0, 0xf0, 0xf0, 0xf0},
+        {0x00, 0x00, 0x0f, 0x0f, 0x0f, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0xff, 0xff, 0xff, 0xff},
+    },
+    { // U+0072 'r'
+        {0x00, 0x00, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0x30, 0x30, 0x30, 0x30, 0xf0, 0xf0, 0xf0, 0xf0},
+        {0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    },
+    { // U+0073 's'
+        {0x00, 0x00, 0xf0, 0xf0, 0xf0, 0xf0, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30},
+        {0x00, 0x00, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3f, 0x3f, 0x3f, 0x3f},
+    },
+    { // U+0074 't'
+        {0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0xfc, 0xfc, 0xfc, 0xfc, 0x30, 0x30, 0x30, 0x30, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3f, 0x30, 0x30, 0x3c, 0x3c, 0x00, 0x00},
+    },
+    { // U+0075 'u'
+        {0x00, 0x00, 0xf0, 0xf0, 0xf0, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xf0, 0xf0, 0xf0},
+        {0x00, 0x00, 0x0f, 0x0f, 0x3f, 0x3f, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x3f, 0x3f, 0x3f, 0x3f},
+    },
+    { // U+0076 'v'
+        {0x00, 0x00, 0xf0, 0xf0, 0xf0, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xf0, 0xf0, 0xf0},
+        {0x00, 0x00, 0x03, 0x03, 0x0f, 0x0f, 0x3c, 0x3c, 0x30, 0x30, 0x3c, 0x3c, 0x0f, 0x0f, 0x03, 0x03},
+    },
+    { // U+0077 'w'
+        {0x00, 0x00, 0xf0, 0xf0, 0xf0, 0xf0, 0x00, 0x00, 0xc0, 0xc0, 0x00, 0x00, 0xf0, 0xf0, 0xf0, 0xf0},
+        {0x00, 0x00, 0x03, 0x03, 0x0f, 0x0f, 0x3c, 0x3c, 0x0f, 0x0f, 0x3c, 0x3c, 0x0f, 0x0f, 0x03, 0x03},
+    },
+    { // U+0078 'x', U+0445 'х'
+        {0x00, 0x00, 0xf0, 0xf0, 0xf0, 0xf0, 0xc0, 0xc0, 0x00, 0x00, 0xc0, 0xc0, 0xf0, 0xf0, 0xf0, 0xf0},
+        {0x00, 0x00, 0x3c, 0x3c, 0x3c, 0x3c, 0x0f, 0x0f, 0x03, 0x03, 0x0f, 0x0f, 0x3c, 0x3c, 0x3c, 0x3c},
+    },
+    { // U+0079 'y', U+0443 'у'
+        {0x00, 0x00, 0xf0, 0xf0, 0xf0, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xf0, 0xf0, 0xf0},
+        {0x00, 0x00, 0xcf, 0xcf, 0xcf, 0xcf, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xff, 0xff, 0x3f, 0x3f},
+    },
+    { // U+007A 'z'
+        {0x00, 0x00, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0},
+        {0x00, 0x00, 0x3c, 0x3c, 0x3f, 0x3f, 0x3f, 0x3f, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x30, 0x30},
+    },
+    { // U+007B '{'
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xfc, 0xfc, 0x0c, 0x0c, 0x00, 0x00, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x3f, 0x3f, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00},
+    },
+    { // U+007C '|', U+2223 '∣'
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    },
+    { // U+007D '}'
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x0c, 0xfc, 0xfc, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x3f, 0x3f, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00},
+    },
+    { // U+007E '~'
+        {0x00, 0x00, 0xc0, 0xc0, 0xf0, 0xf0, 0xf0, 0xf0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0},
+        {0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x0f, 0x0f, 0x0f, 0x0f, 0x03, 0x03},
+    },
+    { // U+00A7 '§'
+        {0x00, 0x00, 0x00, 0x00, 0xf0, 0xf0, 0x3c, 0x3c, 0x3c, 0x3c, 0xcc, 0xcc, 0xcc, 0xcc, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x33, 0x33, 0x3c, 0x3c, 0x3c, 0x3c, 0x0f, 0x0f, 0x00, 0x00},
+    },
+    { // U+00A9 '©'
+        {0x00, 0x00, 0xf0, 0xf0, 0x0c, 0x0c, 0xf3, 0xf3, 0x33, 0x33, 0x33, 0x33, 0x0c, 0x0c, 0xf0, 0xf0},
+        {0x00, 0x00, 0x03, 0x03, 0x0c, 0x0c, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x0c, 0x0c, 0x03, 0x03},
+    },
+    { // U+00AB '«'
+        {0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xf0, 0xf0, 0x00, 0x00, 0xc0, 0xc0, 0xf0, 0xf0, 0x00, 0x00},
+        {0x00, 0x00, 0x03, 0x03, 0x0f, 0x0f, 0x3c, 0x3c, 0x03, 0x03, 0x0f, 0x0f, 0x3c, 0x3c, 0x00, 0x00},
+    },
+    { // U+00AC '¬'
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x3f, 0x3f, 0x00, 0x00},
+    },
+    { // U+00AE '®'
+        {0x00, 0x00, 0xf0, 0xf0, 0x0c, 0x0c, 0xf3, 0xf3, 0xf3, 0xf3, 0x33, 0x33, 0x0c, 0x0c, 0xf0, 0xf0},
+        {0x00, 0x00, 0x03, 0x03, 0x0c, 0x0c, 0x33, 0x33, 0x30, 0x30, 0x33, 0x33, 0x0c, 0x0c, 0x03, 0x03},
+    },
+    { // U+00B0 '°'
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xfc, 0xcc, 0xcc, 0xfc, 0xfc, 0x00, 0x00, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    },
+    { // U+00B1 '±'
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xf0, 0xf0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x33, 0x33, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00},
+    },
+    { // U+00B6 '¶'
+        {0x00, 0x00, 0x00, 0x00, 0xf0, 0xf0, 0xfc, 0xfc, 0xfc, 0xfc, 0x00, 0x00, 0xfc, 0xfc, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x3f, 0x3f, 0x00, 0x00},
+    },
+    { // U+00B7 '·'
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    },
+    { // U+00BB '»'
+        {0x00, 0x00, 0x00, 0x00, 0xf0, 0xf0, 0xc0, 0xc0, 0x00, 0x00, 0xf0, 0xf0, 0xc0, 0xc0, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x3c, 0x3c, 0x0f, 0x0f, 0x03, 0x03, 0x3c, 0x3c, 0x0f, 0x0f, 0x03, 0x03},
+    },
+    { // U+00D7 '×'
+        {0x00, 0x00, 0x00, 0x00, 0xf0, 0xf0, 0xc0, 0xc0, 0x00, 0x00, 0xc0, 0xc0, 0xf0, 0xf0, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x3c, 0x3c, 0x0f, 0x0f, 0x03, 0x03, 0x0f, 0x0f, 0x3c, 0x3c, 0x00, 0x00},
+    },
+    { // U+00F7 '÷'
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x33, 0x33, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00},
+    },
+    { // U+0393 'Γ'
+        {0x00, 0x00, 0xfc, 0xfc, 0xfc, 0xfc, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x3c, 0x3c, 0x3c, 0x3c},
+        {0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    },
+    { // U+0394 'Δ'
+        {0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xfc, 0xfc, 0x3c, 0x3c, 0xfc, 0xfc, 0xc0, 0xc0, 0x00, 0x00},
+        {0x00, 0x00, 0x3c, 0x3c, 0x3f, 0x3f, 0x33, 0x33, 0x30, 0x30, 0x33, 0x33, 0x3f, 0x3f, 0x3c, 0x3c},
+    },
+    { // U+0396 'Ζ'
+        {0x00, 0x00, 0x3c, 0x3c, 0x3c, 0x3c, 0x0c, 0x0c, 0xcc, 0xcc, 0xfc, 0xfc, 0xfc, 0xfc, 0x3c, 0x3c},
+        {0x00, 0x00, 0x30, 0x30, 0x3c, 0x3c, 0x3f, 0x3f, 0x3f, 0x3f, 0x33, 0x33, 0x30, 0x30, 0x3c, 0x3c},
+    },
+    { // U+0398 'Θ'
+        {0x00, 0x00, 0xf0, 0xf0, 0xfc, 0xfc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xfc, 0xfc, 0xf0, 0xf0},
+        {0x00, 0x00, 0x0f, 0x0f, 0x3f, 0x3f, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x3f, 0x3f, 0x0f, 0x0f},
+    },
+    { // U+039B 'Λ'
+        {0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xfc, 0xfc, 0x3c, 0x3c, 0xfc, 0xfc, 0xc0, 0xc0, 0x00, 0x00},
+        {0x00, 0x00, 0x3c, 0x3c, 0x3f, 0x3f, 0x03, 0x03, 0x00, 0x00, 0x03, 0x03, 0x3f, 0x3f, 0x3c, 0x3c},
+    },
+    { // U+039E 'Ξ'
+        {0x00, 0x00, 0x0c, 0x0c, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x0c, 0x0c},
+        {0x00, 0x00, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c},
+    },
+    { // U+03A0 'Π', U+041F 'П'
+        {0x00, 0x00, 0xfc, 0xfc, 0xfc, 0xfc, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0xfc, 0xfc, 0xfc, 0xfc},
+        {0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3f},
+    },
+    { // U+03A1 'Ρ'
+        {0x00, 0x00, 0xfc, 0xfc, 0xfc, 0xfc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xfc, 0xfc, 0xfc, 0xfc},
+        {0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    },
+    { // U+03A3 'Σ'
+        {0x00, 0x00, 0x0c, 0x0c, 0x3c, 0x3c, 0xfc, 0xfc, 0xcc, 0xcc, 0xcc, 0xcc, 0x0c, 0x0c, 0x0c, 0x0c},
+        {0x00, 0x00, 0x3c, 0x3c, 0x3f, 0x3f, 0x3f, 0x3f, 0x33, 0x33, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30},
+    },
+    { // U+03A4 'Τ'
+        {0x00, 0x00, 0x00, 0x00, 0x3c, 0x3c, 0x0c, 0x0c, 0xfc, 0xfc, 0xfc, 0xfc, 0x0c, 0x0c, 0x3c, 0x3c},
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3f, 0x00, 0x00, 0x00, 0x00},
+    },
+    { // U+03A6 'Φ', U+0424 'Ф'
+        {0x00, 0x00, 0xf0, 0xf0, 0xfc, 0xfc, 0x0c, 0x0c, 0xfc, 0xfc, 0x0c, 0x0c, 0xfc, 0xfc, 0xf0, 0xf0},
+        {0x00, 0x00, 0x03, 0x03, 0x0f, 0x0f, 0x0c, 0x0c, 0x3f, 0x3f, 0x0c, 0x0c, 0x0f, 0x0f, 0x03, 0x03},
+    },
+    { // U+03A8 'Ψ'
+        {0x00, 0x00, 0xfc, 0xfc, 0xfc, 0xfc, 0x00, 0x00, 0xfc, 0xfc, 0x00, 0x00, 0xfc, 0xfc, 0xfc, 0xfc},
+        {0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x3f, 0x3f, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00},
+    },
+    { // U+03A9 'Ω'
+        {0x00, 0x00, 0xf0, 0xf0, 0xfc, 0xfc, 0x3c, 0x3c, 0x0c, 0x0c, 0x3c, 0x3c, 0xfc, 0xfc, 0xf0, 0xf0},
+        {0x00, 0x00, 0x33, 0x33, 0x3f, 0x3f, 0x3c, 0x3c, 0x00, 0x00, 0x3c, 0x3c, 0x3f, 0x3f, 0x33, 0x33},
+    },
+    { // U+03B1 'α'
+        {0x00, 0x00, 0xc0, 0xc0, 0xf0, 0xf0, 0xf0, 0xf0, 0x30, 0x30, 0xf0, 0xf0, 0xc0, 0xc0, 0xf0, 0xf0},
+        {0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3f, 0x30, 0x30, 0x3c, 0x3c, 0x0f, 0x0f, 0x3f, 0x3f, 0x33, 0x33},
+    },
+    { // U+03B2 'β'
+        {0x00, 0x00, 0xc0, 0xc0, 0xf0, 0xf0, 0x30, 0x30, 0x30, 0x30, 0xf0, 0xf0, 0xf0, 0xf0, 0x00, 0x00},
+        {0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3f, 0x3f, 0x3f, 0x3f},
+    },
+    { // U+03B3 'γ'
+        {0x00, 0x00, 0xf0, 0xf0, 0xf0, 0xf0, 0xc0, 0xc0, 0x00, 0x00, 0xc0, 0xc0, 0xf0, 0xf0, 0xf0, 0xf0},
+        {0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x3f, 0x3f, 0xfc, 0xfc, 0xff, 0xff, 0x03, 0x03, 0x00, 0x00},
+    },
+    { // U+03B4 'δ'
+        {0x00, 0x00, 0x00, 0x00, 0x3c, 0x3c, 0xfc, 0xfc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x0c, 0x0c},
+        {0x00, 0x00, 0x00, 0x00, 0x0f, 0x0f, 0x3f, 0x3f, 0x33, 0x33, 0x33, 0x33, 0x3f, 0x3f, 0x0f, 0x0f},
+    },
+    { // U+03B5 'ε'
+        {0x00, 0x00, 0x00, 0x00, 0xf0, 0xf0, 0xf0, 0xf0, 0x30, 0x30, 0x30, 0x30, 0xf0, 0xf0, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x3c, 0x3c, 0x3f, 0x3f, 0x33, 0x33, 0x30, 0x30, 0x3c, 0x3c, 0x00, 0x00},
+    },
+    { // U+03B6 'ζ'
+        {0x00, 0x00, 0x00, 0x00, 0x0c, 0x0c, 0xcc, 0xcc, 0xfc, 0xfc, 0x3c, 0x3c, 0x0c, 0x0c, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x0f, 0x0f, 0x3f, 0x3f, 0x30, 0x30, 0xf0, 0xf0, 0xf0, 0xf0, 0x00, 0x00},
+    },
+    { // U+03B7 'η'
+        {0x00, 0x00, 0xf0, 0xf0, 0xf0, 0xf0, 0xc0, 0xc0, 0x30, 0x30, 0x30, 0x30, 0xf0, 0xf0, 0xc0, 0xc0},
+        {0x00, 0x00, 0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff},
+    },
+    { // U+03B8 'θ'
+        {0x00, 0x00, 0xc0, 0xc0, 0xf0, 0xf0, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0xf0, 0xf0, 0xc0, 0xc0},
+        {0x00, 0x00, 0x0f, 0x0f, 0x3f, 0x3f, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3f, 0x3f, 0x0f, 0x0f},
+    },
+    { // U+03B9 'ι'
+        {0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0xf0, 0xf0, 0xf0, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x0f, 0x3f, 0x3f, 0x3c, 0x3c, 0x3c, 0x3c, 0x00, 0x00},
+    },
+    { // U+03BA 'κ', U+043A 'к'
+        {0x00, 0x00, 0xf0, 0xf0, 0xf0, 0xf0, 0x00, 0x00, 0xc0, 0xc0, 0xf0, 0xf0, 0xf0, 0xf0, 0x30, 0x30},
+        {0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3f, 0x0f, 0x0f, 0x0f, 0x0f, 0x3f, 0x3f, 0x3c, 0x3c, 0x30, 0x30},
+    },
+    { // U+03BB 'λ'
+        {0x00, 0x00, 0x0c, 0x0c, 0x3c, 0x3c, 0xfc, 0xfc, 0xf0, 0xf0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00},
+        {0x00, 0x00, 0x3c, 0x3c, 0x3f, 0x3f, 0x0f, 0x0f, 0x03, 0x03, 0x0f, 0x0f, 0x3f, 0x3f, 0x3c, 0x3c},
+    },
+    { // U+03BC 'μ'
+        {0x00, 0x00, 0xf0, 0xf0, 0xf0, 0xf0, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xf0, 0xf0, 0xf0, 0x00, 0x00},
+        {0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x0c, 0x0c, 0x0f, 0x0f, 0x03, 0x03, 0x0f, 0x0f, 0x0c, 0x0c},
+    },
+    { // U+03BD 'ν'
+        {0x00, 0x00, 0xf0, 0xf0, 0xf0, 0xf0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xf0, 0xf0, 0xf0},
+        {0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x0f, 0x0f, 0x3c, 0x3c, 0x3f, 0x3f, 0x0f, 0x0f, 0x03, 0x03},
+    },
+    { // U+03BE 'ξ'
+        {0x00, 0x00, 0x00, 0x00, 0xcc, 0xcc, 0xfc, 0xfc, 0xfc, 0xfc, 0xcc, 0xcc, 0xcc, 0xcc, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x0f, 0x0f, 0x3f, 0x3f, 0x3c, 0x3c, 0xf0, 0xf0, 0xf0, 0xf0, 0x00, 0x00},
+    },
+    { // U+03BF 'ο'
+        {0x00, 0x00, 0xc0, 0xc0, 0xf0, 0xf0, 0xf0, 0xf0, 0x30, 0x30, 0xf0, 0xf0, 0xf0, 0xf0, 0xc0, 0xc0},
+        {0x00, 0x00, 0x0f, 0x0f, 0x3f, 0x3f, 0x3c, 0x3c, 0x30, 0x30, 0x3c, 0x3c, 0x3f, 0x3f, 0x0f, 0x0f},
+    },
+    { // U+03C0 'π'
+        {0x00, 0x00, 0x30, 0x30, 0xf0, 0xf0, 0xf0, 0xf0, 0x30, 0x30, 0xf0, 0xf0, 0xf0, 0xf0, 0x30, 0x30},
+        {0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3f, 0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3f, 0x30, 0x30},
+    },
+    { // U+03C1 'ρ'
+        {0x00, 0x00, 0xc0, 0xc0, 0xf0, 0xf0, 0x30, 0x30, 0x30, 0x30, 0xf0, 0xf0, 0xf0, 0xf0, 0xc0, 0xc0},
+        {0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x0c, 0x0c, 0x0c, 0x0c, 0x0f, 0x0f, 0x0f, 0x0f, 0x03, 0x03},
+    },
+    { // U+03C2 'ς'
+        {0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xf0, 0xf0, 0x30, 0x30, 0xf0, 0xf0, 0xf0, 0xf0, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x0f, 0x0f, 0x3f, 0x3f, 0x30, 0x30, 0xf0, 0xf0, 0xf0, 0xf0, 0x00, 0x00},
+    },
+    { // U+03C3 'σ'
+        {0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xf0, 0xf0, 0x30, 0x30, 0xf0, 0xf0, 0xf0, 0xf0, 0x30, 0x30},
+        {0x00, 0x00, 0x00, 0x00, 0x0f, 0x0f, 0x3f, 0x3f, 0x30, 0x30, 0x3f, 0x3f, 0x0f, 0x0f, 0x00, 0x00},
+    },
+    { // U+03C4 'τ'
+        {0x00, 0x00, 0x30, 0x30, 0x30, 0x30, 0xf0, 0xf0, 0xf0, 0xf0, 0x30, 0x30, 0x30, 0x30, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x0f, 0x3f, 0x3f, 0x3c, 0x3c, 0x3c, 0x3c, 0x00, 0x00},
+    },
+    { // U+03C5 'υ'
+        {0x00, 0x00, 0x00, 0x00, 0xf0, 0xf0, 0xf0, 0xf0, 0x00, 0x00, 0xf0, 0xf0, 0xf0, 0xf0, 0xc0, 0xc0},
+        {0x00, 0x00, 0x00, 0x00, 0x0f, 0x0f, 0x3f, 0x3f, 0x3c, 0x3c, 0x3c, 0x3c, 0x3f, 0x3f, 0x3f, 0x3f},
+    },
+    { // U+03C6 'φ'
+        {0x00, 0x00, 0xf0, 0xf0, 0xf0, 0xf0, 0x00, 0x00, 0xf0, 0xf0, 0xf0, 0xf0, 0x30, 0x30, 0xf0, 0xf0},
+        {0x00, 0x00, 0x03, 0x03, 0x0f, 0x0f, 0x0c, 0x0c, 0xff, 0xff, 0xff, 0xff, 0x0c, 0x0c, 0x0f, 0x0f},
+    },
+    { // U+03C7 'χ'
+        {0x00, 0x00, 0x00, 0x00, 0xf0, 0xf0, 0xf0, 0xf0, 0x00, 0x00, 0xf0, 0xf0, 0xf0, 0xf0, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0xf0, 0xf0, 0xff, 0xff, 0x0f, 0x0f, 0xff, 0xff, 0xf0, 0xf0, 0x00, 0x00},
+    },
+    { // U+03C8 'ψ'
+        {0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0xf0, 0xf0, 0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xc0},
+        {0x00, 0x00, 0x0f, 0x0f, 0x3f, 0x3f, 0x30, 0x30, 0xff, 0xff, 0x30, 0x30, 0x3f, 0x3f, 0x0f, 0x0f},
+    },
+    { // U+03C9 'ω'
+        {0x00, 0x00, 0xf0, 0xf0, 0xf0, 0xf0, 0x00, 0x00, 0xc0, 0xc0, 0x00, 0x00, 0xf0, 0xf0, 0xf0, 0xf0},
+        {0x00, 0x00, 0x0f, 0x0f, 0x3f, 0x3f, 0x3c, 0x3c, 0x0f, 0x0f, 0x3c, 0x3c, 0x3f, 0x3f, 0x0f, 0x0f},
+    },
+    { // U+0401 'Ё'
+        {0x00, 0x00, 0xfc, 0xfc, 0xff, 0xff, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcf, 0xcf, 0xcc, 0xcc},
+        {0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3f, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30},
+    },
+    { // U+0411 'Б'
+        {0x00, 0x00, 0xfc, 0xfc, 0xfc, 0xfc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc},
+        {0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3f, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x3f, 0x3f, 0x3f, 0x3f},
+    },
+    { // U+0413 'Г'
+        {0x00, 0x00, 0xfc, 0xfc, 0xfc, 0xfc, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x00, 0x00},
+        {0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    },
+    { // U+0414 'Д'
+        {0x00, 0x00, 0x00, 0x00, 0xfc, 0xfc, 0x0c, 0x0c, 0x0c, 0x0c, 0xfc, 0xfc, 0xfc, 0xfc, 0x00, 0x00},
+        {0x00, 0x00, 0xfc, 0xfc, 0xff, 0xff, 0x3c, 0x3c, 0x3c, 0x3c, 0x3f, 0x3f, 0xff, 0xff, 0xfc, 0xfc},
+    },
+    { // U+0416 'Ж'
+        {0x00, 0x00, 0x3c, 0x3c, 0xfc, 0xfc, 0xc0, 0xc0, 0xfc, 0xfc, 0xc0, 0xc0, 0xfc, 0xfc, 0x3c, 0x3c},
+        {0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3f, 0x00, 0x00, 0x3f, 0x3f, 0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3f},
+    },
+    { // U+0417 'З'
+        {0x00, 0x00, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xfc, 0xfc, 0xfc, 0xfc, 0x30, 0x30},
+        {0x00, 0x00, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x3f, 0x3f, 0x3f, 0x3f, 0x0f, 0x0f},
+    },
+    { // U+0418 'И'
+        {0x00, 0x00, 0xfc, 0xfc, 0xfc, 0xfc, 0x00, 0x00, 0xc0, 0xc0, 0xf0, 0xf0, 0xfc, 0xfc, 0xfc, 0xfc},
+        {0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3f, 0x0f, 0x0f, 0x03, 0x03, 0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3f},
+    },
+    { // U+0419 'Й'
+        {0x00, 0x00, 0xfc, 0xfc, 0xfc, 0xfc, 0x03, 0x03, 0xc3, 0xc3, 0xf3, 0xf3, 0xfc, 0xfc, 0xfc, 0xfc},
+        {0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3f, 0x0f, 0x0f, 0x03, 0x03, 0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3f},
+    },
+    { // U+041B 'Л'
+        {0x00, 0x00, 0x00, 0x00, 0xf0, 0xf0, 0xfc, 0xfc, 0x3c, 0x3c, 0xfc, 0xfc, 0xf0, 0xf0, 0x00, 0x00},
+        {0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3f},
+    },
+    { // U+0423 'У'
+        {0x00, 0x00, 0x3c, 0x3c, 0xfc, 0xfc, 0xf0, 0xf0, 0xc0, 0xc0, 0xf0, 0xf0, 0xfc, 0xfc, 0x3c, 0x3c},
+        {0x00, 0x00, 0x30, 0x30, 0x3c, 0x3c, 0x3f, 0x3f, 0x0f, 0x0f, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00},
+    },
+    { // U+0426 'Ц'
+        {0x00, 0x00, 0xfc, 0xfc, 0xfc, 0xfc, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xfc, 0xfc, 0xfc, 0x00, 0x00},
+        {0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3f, 0x3c, 0x3c, 0x3c, 0x3c, 0x3f, 0x3f, 0xff, 0xff, 0xf0, 0xf0},
+    },
+    { // U+0427 'Ч'
+        {0x00, 0x00, 0xfc, 0xfc, 0xfc, 0xfc, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xfc, 0xfc, 0xfc, 0xfc},
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3f},
+    },
+    { // U+0428 'Ш'
+        {0x00, 0x00, 0xfc, 0xfc, 0xfc, 0xfc, 0x00, 0x00, 0xfc, 0xfc, 0x00, 0x00, 0xfc, 0xfc, 0xfc, 0xfc},
+        {0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3f, 0x3c, 0x3c, 0x3f, 0x3f, 0x3c, 0x3c, 0x3f, 0x3f, 0x3f, 0x3f},
+    },
+    { // U+0429 'Щ'
+        {0x00, 0x00, 0xfc, 0xfc, 0xfc, 0xfc, 0x00, 0x00, 0xfc, 0xfc, 0x00, 0x00, 0xfc, 0xfc, 0xfc, 0xfc},
+        {0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3f, 0x3c, 0x3c, 0x3f, 0x3f, 0x3c, 0x3c, 0x3f, 0x3f, 0xff, 0xff},
+    },
+    { // U+042A 'Ъ'
+        {0x00, 0x00, 0x3c, 0x3c, 0xfc, 0xfc, 0xfc, 0xfc, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00},
+        {0xf0, 0xf0, 0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3f, 0x30, 0x30, 0x3f, 0x3f, 0x3f, 0x3f, 0x00, 0x00},
+    },
+    { // U+042B 'Ы'
+        {0x00, 0x00, 0xfc, 0xfc, 0xfc, 0xfc, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0xfc, 0xfc, 0xfc, 0xfc},
+        {0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3f, 0x30, 0x30, 0x3f, 0x3f, 0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3f},
+    },
+    { // U+042C 'Ь'
+        {0x00, 0x00, 0x00, 0x00, 0xfc, 0xfc, 0xfc, 0xfc, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3f, 0x30, 0x30, 0x3f, 0x3f, 0x3f, 0x3f, 0x00, 0x00},
+    },
+    { // U+042D 'Э'
+        {0x00, 0x00, 0x0c, 0x0c, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xfc, 0xfc, 0xf0, 0xf0},
+        {0x00, 0x00, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x3f, 0x3f, 0x0f, 0x0f},
+    },
+    { // U+042E 'Ю'
+        {0x00, 0x00, 0xfc, 0xfc, 0xfc, 0xfc, 0xc0, 0xc0, 0xfc, 0xfc, 0x0c, 0x0c, 0xfc, 0xfc, 0xfc, 0xfc},
+        {0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3f, 0x00, 0x00, 0x3f, 0x3f, 0x3c, 0x3c, 0x3f, 0x3f, 0x3f, 0x3f},
+    },
+    { // U+042F 'Я'
+        {0x00, 0x00, 0xf0, 0xf0, 0xfc, 0xfc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xfc, 0xfc, 0xfc, 0xfc},
+        {0x00, 0x00, 0x30, 0x30, 0x3c, 0x3c, 0x3f, 0x3f, 0x0f, 0x0f, 0x03, 0x03, 0x3f, 0x3f, 0x3f, 0x3f},
+    },
+    { // U+0431 'б'
+        {0x00, 0x00, 0xf0, 0xf0, 0xf0, 0xf0, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30},
+        {0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3f, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3f, 0x3f, 0x3f, 0x3f},
+    },
+    { // U+0432 'в'
+        {0x00, 0x00, 0xf0, 0xf0, 0xf0, 0xf0, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0xf0, 0xf0, 0xc0, 0xc0},
+        {0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3f, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3f, 0x3f, 0x0c, 0x0c},
+    },
+    { // U+0433 'г'
+        {0x00, 0x00, 0xf0, 0xf0, 0xf0, 0xf0, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30},
+        {0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    },
+    { // U+0434 'д'
+        {0x00, 0x00, 0x00, 0x00, 0xf0, 0xf0, 0xf0, 0xf0, 0x30, 0x30, 0xf0, 0xf0, 0xf0, 0xf0, 0x00, 0x00},
+        {0x00, 0x00, 0xf0, 0xf0, 0xff, 0xff, 0x3f, 0x3f, 0x30, 0x30, 0x3f, 0x3f, 0xff, 0xff, 0xf0, 0xf0},
+    },
+    { // U+0436 'ж'
+        {0x00, 0x00, 0xf0, 0xf0, 0xf0, 0xf0, 0x00, 0x00, 0xf0, 0xf0, 0x00, 0x00, 0xf0, 0xf0, 0xf0, 0xf0},
+        {0x00, 0x00, 0x3c, 0x3c, 0x3f, 0x3f, 0x03, 0x03, 0x3f, 0x3f, 0x03, 0x03, 0x3f, 0x3f, 0x3c, 0x3c},
+    },
+    { // U+0437 'з'
+        {0x00, 0x00, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0xf0, 0xf0, 0xf0, 0xf0, 0xc0, 0xc0},
+        {0x00, 0x00, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3f, 0x3f, 0x3f, 0x3f, 0x0c, 0x0c},
+    },
+    { // U+0438 'и'
+        {0x00, 0x00, 0xf0, 0xf0, 0xf0, 0xf0, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xf0, 0xf0, 0xf0, 0xf0},
+        {0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3f, 0x3c, 0x3c, 0x0f, 0x0f, 0x03, 0x03, 0x3f, 0x3f, 0x3f, 0x3f},
+    },
+    { // U+0439 'й'
+        {0x00, 0x00, 0xf0, 0xf0, 0xf0, 0xf0, 0x0c, 0x0c, 0x0c, 0x0c, 0xcc, 0xcc, 0xf0, 0xf0, 0xf0, 0xf0},
+        {0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3f, 0x3c, 0x3c, 0x0f, 0x0f, 0x03, 0x03, 0x3f, 0x3f, 0x3f, 0x3f},
+    },
+    { // U+043B 'л'
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0},
+        {0x00, 0x00, 0x3c, 0x3c, 0x3f, 0x3f, 0x0f, 0x0f, 0x03, 0x03, 0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3f},
+    },
+    { // U+043C 'м'
+        {0x00, 0x00, 0xf0, 0xf0, 0xf0, 0xf0, 0xc0, 0xc0, 0x00, 0x00, 0xc0, 0xc0, 0xf0, 0xf0, 0xf0, 0xf0},
+        {0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3f, 0x03, 0x03, 0x0f, 0x0f, 0x03, 0x03, 0x3f, 0x3f, 0x3f, 0x3f},
+    },
+    { // U+043D 'н'
+        {0x00, 0x00, 0xf0, 0xf0, 0xf0, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xf0, 0xf0, 0xf0},
+        {0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3f, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x3f, 0x3f, 0x3f, 0x3f},
+    },
+    { // U+043F 'п'
+        {0x00, 0x00, 0xf0, 0xf0, 0xf0, 0xf0, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0xf0, 0xf0, 0xf0, 0xf0},
+        {0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3f},
+    },
+    { // U+0442 'т'
+        {0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x30, 0x30, 0xf0, 0xf0, 0xf0, 0xf0, 0x30, 0x30, 0x30, 0x30},
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3f, 0x00, 0x00, 0x00, 0x00},
+    },
+    { // U+0444 'ф'
+        {0x00, 0x00, 0xc0, 0xc0, 0xf0, 0xf0, 0x30, 0x30, 0xf0, 0xf0, 0x30, 0x30, 0xf0, 0xf0, 0xc0, 0xc0},
+        {0x00, 0x00, 0x0f, 0x0f, 0x0f, 0x0f, 0x0c, 0x0c, 0xff, 0xff, 0x0c, 0x0c, 0x0f, 0x0f, 0x0f, 0x0f},
+    },
+    { // U+0446 'ц'
+        {0x00, 0x00, 0xf0, 0xf0, 0xf0, 0xf0, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xf0, 0xf0, 0xf0, 0x00, 0x00},
+        {0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3f, 0x30, 0x30, 0x30, 0x30, 0x3f, 0x3f, 0xff, 0xff, 0xf0, 0xf0},
+    },
+    { // U+0447 'ч'
+        {0x00, 0x00, 0xf0, 0xf0, 0xf0, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xf0, 0xf0, 0xf0},
+        {0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x3f, 0x3f, 0x3f, 0x3f},
+    },
+    { // U+0448 'ш'
+        {0x00, 0x00, 0xf0, 0xf0, 0xf0, 0xf0, 0x00, 0x00, 0xf0, 0xf0, 0x00, 0x00, 0xf0, 0xf0, 0xf0, 0xf0},
+        {0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3f, 0x30, 0x30, 0x3f, 0x3f, 0x30, 0x30, 0x3f, 0x3f, 0x3f, 0x3f},
+    },
+    { // U+0449 'щ'
+        {0x00, 0x00, 0xf0, 0xf0, 0xf0, 0xf0, 0x00, 0x00, 0xf0, 0xf0, 0x00, 0x00, 0xf0, 0xf0, 0xf0, 0xf0},
+        {0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3f, 0x30, 0x30, 0x3f, 0x3f, 0x30, 0x30, 0x3f, 0x3f, 0xff, 0xff},
+    },
+    { // U+044A 'ъ'
+        {0x00, 0x00, 0x30, 0x30, 0xf0, 0xf0, 0xf0, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+        {0xf0, 0xf0, 0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3f, 0x33, 0x33, 0x3f, 0x3f, 0x3f, 0x3f, 0x00, 0x00},
+    },
+    { // U+044B 'ы'
+        {0x00, 0x00, 0xf0, 0xf0, 0xf0, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xf0, 0xf0, 0xf0},
+        {0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3f, 0x33, 0x33, 0x3f, 0x3f, 0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3f},
+    },
+    { // U+044C 'ь'
+        {0x00, 0x00, 0x00, 0x00, 0xf0, 0xf0, 0xf0, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3f, 0x33, 0x33, 0x3f, 0x3f, 0x3f, 0x3f, 0x00, 0x00},
+    },
+    { // U+044D 'э'
+        {0x00, 0x00, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0xf0, 0xf0, 0xf0, 0xf0},
+        {0x00, 0x00, 0x30, 0x30, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3f, 0x3f, 0x3f, 0x3f},
+    },
+    { // U+044E 'ю'
+        {0x00, 0x00, 0xf0, 0xf0, 0xf0, 0xf0, 0x00, 0x00, 0xf0, 0xf0, 0x30, 0x30, 0xf0, 0xf0, 0xf0, 0xf0},
+        {0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3f, 0x03, 0x03, 0x3f, 0x3f, 0x30, 0x30, 0x3f, 0x3f, 0x3f, 0x3f},
+    },
+    { // U+044F 'я'
+        {0x00, 0x00, 0xf0, 0xf0, 0xf0, 0xf0, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0xf0, 0xf0, 0xf0, 0xf0},
+        {0x00, 0x00, 0x33, 0x33, 0x33, 0x33, 0x3f, 0x3f, 0x0f, 0x0f, 0x0f, 0x0f, 0x3f, 0x3f, 0x3f, 0x3f},
+    },
+    { // U+0451 'ё'
+        {0x00, 0x00, 0xf0, 0xf0, 0xf3, 0xf3, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0xf3, 0xf3, 0xf0, 0xf0},
+        {0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3f, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33},
+    },
+    { // U+2014 '—'
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+        {0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03},
+    },
+    { // U+2018 '‘'
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xfc, 0xf0, 0xf0, 0x00, 0x00, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    },
+    { // U+2019 '’'
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x3c, 0xfc, 0xfc, 0x00, 0x00, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    },
+    { // U+201C '“'
+        {0x00, 0x00, 0x00, 0x00, 0xfc, 0xfc, 0xf0, 0xf0, 0x00, 0x00, 0xfc, 0xfc, 0xf0, 0xf0, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    },
+    { // U+201D '”'
+        {0x00, 0x00, 0x00, 0x00, 0x3c, 0x3c, 0xfc, 0xfc, 0x00, 0x00, 0x3c, 0x3c, 0xfc, 0xfc, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    },
+    { // U+201E '„'
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x3c, 0x3c, 0xfc, 0xfc, 0x00, 0x00, 0x3c, 0x3c, 0xfc, 0xfc, 0x00, 0x00},
+    },
+    { // U+2022 '•'
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00},
+    },
+    { // U+2023 '‣', U+23F5 '⏵'
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xf0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f, 0x0f, 0x0f, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00},
+    },
+    { // U+2026 '…'
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x00, 0x00, 0x30, 0x30, 0x00, 0x00, 0x30, 0x30, 0x00, 0x00},
+    },
+    { // U+2190 '←'
+        {0x00, 0x00, 0xc0, 0xc0, 0xf0, 0xf0, 0xfc, 0xfc, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00},
+        {0x00, 0x00, 0x03, 0x03, 0x0f, 0x0f, 0x3f, 0x3f, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00},
+    },
+    { // U+2191 '↑'
+        {0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xf0, 0xf0, 0xfc, 0xfc, 0xfc, 0xfc, 0xf0, 0xf0, 0xc0, 0xc0},
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3f, 0x00, 0x00, 0x00, 0x00},
+    },
+    { // U+2192 '→'
+        {0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xfc, 0xfc, 0xf0, 0xf0, 0xc0, 0xc0},
+        {0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x3f, 0x3f, 0x0f, 0x0f, 0x03, 0x03},
+    },
+    { // U+2193 '↓'
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xfc, 0xfc, 0xfc, 0x00, 0x00, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x0f, 0x0f, 0x3f, 0x3f, 0x3f, 0x3f, 0x0f, 0x0f, 0x03, 0x03},
+    },
+    { // U+2196 '↖'
+        {0x00, 0x00, 0x00, 0x00, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xcc, 0xcc, 0x00, 0x00, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x03, 0x03, 0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00},
+    },
+    { // U+2197 '↗'
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0xcc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x0f, 0x0f, 0x0f, 0x0f, 0x03, 0x03, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00},
+    },
+    { // U+2198 '↘'
+        {0x00, 0x00, 0x00, 0x00, 0x3c, 0x3c, 0xfc, 0xfc, 0xf0, 0xf0, 0xc0, 0xc0, 0xf0, 0xf0, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x0c, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00},
+    },
+    { // U+2199 '↙'
+        {0x00, 0x00, 0x00, 0x00, 0xf0, 0xf0, 0xc0, 0xc0, 0xf0, 0xf0, 0xfc, 0xfc, 0x3c, 0x3c, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0c, 0x0c, 0x00, 0x00, 0x00, 0x00},
+    },
+    { // U+21B0 '↰'
+        {0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xf0, 0xf0, 0xfc, 0xfc, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0},
+        {0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x0f, 0x0f, 0x3f, 0x3f, 0x03, 0x03, 0x3f, 0x3f, 0x3f, 0x3f},
+    },
+    { // U+21B1 '↱'
+        {0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xfc, 0xfc, 0xf0, 0xf0, 0xc0, 0xc0},
+        {0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3f, 0x03, 0x03, 0x3f, 0x3f, 0x0f, 0x0f, 0x03, 0x03},
+    },
+    { // U+21B2 '↲'
+        {0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xf0, 0xf0, 0xfc, 0xfc, 0xc0, 0xc0, 0xfc, 0xfc, 0xfc, 0xfc},
+        {0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x0f, 0x0f, 0x3f, 0x3f, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03},
+    },
+    { // U+21B3 '↳'
+        {0x00, 0x00, 0x00, 0x00, 0xfc, 0xfc, 0xfc, 0xfc, 0xc0, 0xc0, 0xfc, 0xfc, 0xf0, 0xf0, 0xc0, 0xc0},
+        {0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x3f, 0x3f, 0x0f, 0x0f, 0x03, 0x03},
+    },
+    { // U+21B4 '↴'
+        {0x00, 0x00, 0x00, 0x00, 0x3c, 0x3c, 0x3c, 0x3c, 0xfc, 0xfc, 0xfc, 0xfc, 0x00, 0x00, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x0f, 0x0f, 0x3f, 0x3f, 0x3f, 0x3f, 0x0f, 0x0f, 0x03, 0x03},
+    },
+    { // U+2200 '∀'
+        {0x00, 0x00, 0x3c, 0x3c, 0xfc, 0xfc, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xfc, 0xfc, 0x3c, 0x3c},
+        {0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x3f, 0x3f, 0x3c, 0x3c, 0x3f, 0x3f, 0x03, 0x03, 0x00, 0x00},
+    },
+    { // U+2202 '∂'
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0xcc, 0xcc, 0xcc, 0xfc, 0xfc, 0x00, 0x00, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f, 0x30, 0x30, 0x3f, 0x3f, 0x00, 0x00, 0x00, 0x00},
+    },
+    { // U+2203 '∃'
+        {0x00, 0x00, 0x00, 0x00, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xfc, 0xfc, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x3f, 0x3f, 0x00, 0x00},
+    },
+    { // U+2204 '∄'
+        {0x00, 0x00, 0x00, 0x00, 0xcc, 0xcc, 0xcc, 0xcc, 0xff, 0xff, 0xcc, 0xcc, 0xfc, 0xfc, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x30, 0x30, 0xff, 0xff, 0x30, 0x30, 0x3f, 0x3f, 0x00, 0x00},
+    },
+    { // U+2205 '∅'
+        {0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0x30, 0x30, 0x30, 0x30, 0xf0, 0xf0, 0xc0, 0xc0, 0x30, 0x30},
+        {0x00, 0x00, 0x30, 0x30, 0x0f, 0x0f, 0x3c, 0x3c, 0x33, 0x33, 0x30, 0x30, 0x0f, 0x0f, 0x00, 0x00},
+    },
+    { // U+2206 '∆'
+        {0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xfc, 0xfc, 0x0c, 0x0c, 0xfc, 0xfc, 0xc0, 0xc0, 0x00, 0x00},
+        {0x00, 0x00, 0x3c, 0x3c, 0x3f, 0x3f, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x3f, 0x3f, 0x3c, 0x3c},
+    },
+    { // U+2207 '∇'
+        {0x00, 0x00, 0x3c, 0x3c, 0xfc, 0xfc, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0xfc, 0xfc, 0x3c, 0x3c},
+        {0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x3f, 0x3f, 0x30, 0x30, 0x3f, 0x3f, 0x03, 0x03, 0x00, 0x00},
+    },
+    { // U+2208 '∈'
+        {0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xf0, 0xf0, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x0f, 0x0f, 0x3f, 0x3f, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x00, 0x00},
+    },
+    { // U+2209 '∉'
+        {0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xf0, 0xf0, 0x30, 0x30, 0xfc, 0xfc, 0x30, 0x30, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x0f, 0x0f, 0x3f, 0x3f, 0x33, 0x33, 0xff, 0xff, 0x33, 0x33, 0x00, 0x00},
+    },
+    { // U+220B '∋'
+        {0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0xf0, 0xf0, 0xc0, 0xc0, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3f, 0x3f, 0x0f, 0x0f, 0x00, 0x00},
+    },
+    { // U+220C '∌'
+        {0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0xfc, 0xfc, 0x30, 0x30, 0xf0, 0xf0, 0xc0, 0xc0, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0xff, 0xff, 0x33, 0x33, 0x3f, 0x3f, 0x0f, 0x0f, 0x00, 0x00},
+    },
+    { // U+220E '∎'
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0x00, 0x00, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x00, 0x00, 0x00, 0x00},
+    },
+    { // U+220F '∏'
+        {0x00, 0x00, 0x00, 0x00, 0xfc, 0xfc, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0xfc, 0xfc, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f, 0x00, 0x00},
+    },
+    { // U+2210 '∐'
+        {0x00, 0x00, 0x00, 0x00, 0xfc, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xfc, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x3f, 0x3f, 0x00, 0x00},
+    },
+    { // U+2211 '∑'
+        {0x00, 0x00, 0x00, 0x00, 0x0c, 0x0c, 0x3c, 0x3c, 0xcc, 0xcc, 0xcc, 0xcc, 0x0c, 0x0c, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x3c, 0x3c, 0x3f, 0x3f, 0x33, 0x33, 0x30, 0x30, 0x30, 0x30, 0x00, 0x00},
+    },
+    { // U+2212 '−'
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00},
+    },
+    { // U+2217 '∗'
+        {0x00, 0x00, 0x00, 0x00, 0xf0, 0xf0, 0xc0, 0xc0, 0xf0, 0xf0, 0xc0, 0xc0, 0xf0, 0xf0, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x3c, 0x3c, 0x0f, 0x0f, 0x3f, 0x3f, 0x0f, 0x0f, 0x3c, 0x3c, 0x00, 0x00},
+    },
+    { // U+2218 '∘'
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x0f, 0x0c, 0x0c, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00},
+    },
+    { // U+2219 '∙'
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00},
+    },
+    { // U+221A '√'
+        {0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0xc0, 0xc0, 0xfc, 0xfc, 0x3c, 0x3c},
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x0f, 0x3c, 0x3c, 0x3f, 0x3f, 0x03, 0x03, 0x00, 0x00},
+    },
+    { // U+221E '∞'
+        {0x00, 0x00, 0xc0, 0xc0, 0x30, 0x30, 0x30, 0x30, 0xc0, 0xc0, 0xf0, 0xf0, 0x30, 0x30, 0xc0, 0xc0},
+        {0x00, 0x00, 0x03, 0x03, 0x0c, 0x0c, 0x0f, 0x0f, 0x03, 0x03, 0x0c, 0x0c, 0x0c, 0x0c, 0x03, 0x03},
+    },
+    { // U+221F '∟'
+        {0x00, 0x00, 0x00, 0x00, 0xf0, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x00, 0x00},
+    },
+    { // U+2220 '∠'
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x3c, 0x3c, 0x33, 0x33, 0x30, 0x30, 0x30, 0x30, 0x00, 0x00},
+    },
+    { // U+2224 '∤'
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xfc, 0xc0, 0xc0, 0x30, 0x30, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x0c, 0x0c, 0x03, 0x03, 0x3f, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    },
+    { // U+2225 '∥'
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xfc, 0x00, 0x00, 0xfc, 0xfc, 0x00, 0x00, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f, 0x00, 0x00, 0x3f, 0x3f, 0x00, 0x00, 0x00, 0x00},
+    },
+    { // U+2226 '∦'
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xfc, 0xc0, 0xc0, 0xfc, 0xfc, 0x30, 0x30, 0x0c, 0x0c},
+        {0x00, 0x00, 0x0c, 0x0c, 0x03, 0x03, 0x3f, 0x3f, 0x00, 0x00, 0x3f, 0x3f, 0x00, 0x00, 0x00, 0x00},
+    },
+    { // U+2227 '∧'
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xf0, 0xf0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x3c, 0x3c, 0x0f, 0x0f, 0x00, 0x00, 0x0f, 0x0f, 0x3c, 0x3c, 0x00, 0x00},
+    },
+    { // U+2228 '∨'
+        {0x00, 0x00, 0x00, 0x00, 0xf0, 0xf0, 0xc0, 0xc0, 0x00, 0x00, 0xc0, 0xc0, 0xf0, 0xf0, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x0f, 0x3c, 0x3c, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00},
+    },
+    { // U+2229 '∩'
+        {0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xf0, 0xf0, 0x30, 0x30, 0xf0, 0xf0, 0xc0, 0xc0, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f, 0x00, 0x00},
+    },
+    { // U+222A '∪'
+        {0x00, 0x00, 0x00, 0x00, 0xf0, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xf0, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x0f, 0x0f, 0x3c, 0x3c, 0x30, 0x30, 0x3c, 0x3c, 0x0f, 0x0f, 0x00, 0x00},
+    },
+    { // U+222B '∫'
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xfc, 0x3c, 0x3c, 0xfc, 0xfc, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f, 0x3c, 0x3c, 0x3f, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    },
+    { // U+2243 '≃'
+        {0x00, 0x00, 0xc0, 0xc0, 0xf0, 0xf0, 0xf0, 0xf0, 0xc0, 0xc0, 0x00, 0x00, 0xc0, 0xc0, 0xf0, 0xf0},
+        {0x00, 0x00, 0x33, 0x33, 0x30, 0x30, 0x30, 0x30, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x30, 0x30},
+    },
+    { // U+2245 '≅'
+        {0x00, 0x00, 0x3c, 0x3c, 0x0f, 0x0f, 0x0f, 0x0f, 0x3c, 0x3c, 0x30, 0x30, 0x3c, 0x3c, 0x0f, 0x0f},
+        {0x00, 0x00, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33},
+    },
+    { // U+2248 '≈'
+        {0x00, 0x00, 0xf0, 0xf0, 0x3c, 0x3c, 0x3c, 0x3c, 0xf0, 0xf0, 0xc0, 0xc0, 0xf0, 0xf0, 0x3c, 0x3c},
+        {0x00, 0x00, 0x3c, 0x3c, 0x0f, 0x0f, 0x0f, 0x0f, 0x3c, 0x3c, 0x30, 0x30, 0x3c, 0x3c, 0x0f, 0x0f},
+    },
+    { // U+2260 '≠'
+        {0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0xf0, 0xf0, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x0c, 0x0c, 0x0c, 0x0c, 0x3f, 0x3f, 0x0c, 0x0c, 0x0c, 0x0c, 0x00, 0x00},
+    },
+    { // U+2261 '≡'
+        {0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x00, 0x00},
+    },
+    { // U+2262 '≢'
+        {0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x30, 0x30, 0xfc, 0xfc, 0x30, 0x30, 0x30, 0x30, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x33, 0x33, 0xff, 0xff, 0x33, 0x33, 0x33, 0x33, 0x00, 0x00},
+    },
+    { // U+2264 '≤'
+        {0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xf0, 0xf0, 0x30, 0x30, 0x3c, 0x3c, 0x0c, 0x0c, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x00, 0x00},
+    },
+    { // U+2265 '≥'
+        {0x00, 0x00, 0x00, 0x00, 0x0c, 0x0c, 0x3c, 0x3c, 0x30, 0x30, 0xf0, 0xf0, 0xc0, 0xc0, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x00, 0x00},
+    },
+    { // U+226A '≪'
+        {0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xf0, 0xf0, 0x30, 0x30, 0xc0, 0xc0, 0xf0, 0xf0, 0x30, 0x30},
+        {0x00, 0x00, 0x03, 0x03, 0x0f, 0x0f, 0x3c, 0x3c, 0x33, 0x33, 0x0f, 0x0f, 0x3c, 0x3c, 0x30, 0x30},
+    },
+    { // U+226B '≫'
+        {0x00, 0x00, 0x30, 0x30, 0xf0, 0xf0, 0xc0, 0xc0, 0x30, 0x30, 0xf0, 0xf0, 0xc0, 0xc0, 0x00, 0x00},
+        {0x00, 0x00, 0x30, 0x30, 0x3c, 0x3c, 0x0f, 0x0f, 0x33, 0x33, 0x3c, 0x3c, 0x0f, 0x0f, 0x03, 0x03},
+    },
+    { // U+2282 '⊂'
+        {0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xf0, 0xf0, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30},
+        {0x00, 0x00, 0x00, 0x00, 0x0f, 0x0f, 0x3c, 0x3c, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30},
+    },
+    { // U+2283 '⊃'
+        {0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0xf0, 0xf0, 0xc0, 0xc0},
+        {0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x3c, 0x3c, 0x0f, 0x0f},
+    },
+    { // U+2284 '⊄'
+        {0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xf0, 0xf0, 0x30, 0x30, 0xfc, 0xfc, 0x30, 0x30, 0x30, 0x30},
+        {0x00, 0x00, 0x00, 0x00, 0x0f, 0x0f, 0x3c, 0x3c, 0x30, 0x30, 0xff, 0xff, 0x30, 0x30, 0x30, 0x30},
+    },
+    { // U+2285 '⊅'
+        {0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x30, 0x30, 0xfc, 0xfc, 0x30, 0x30, 0xf0, 0xf0, 0xc0, 0xc0},
+        {0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x30, 0x30, 0xff, 0xff, 0x30, 0x30, 0x3c, 0x3c, 0x0f, 0x0f},
+    },
+    { // U+2286 '⊆'
+        {0x00, 0x00, 0x00, 0x00, 0xf0, 0xf0, 0xfc, 0xfc, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c},
+        {0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33},
+    },
+    { // U+2287 '⊇'
+        {0x00, 0x00, 0x00, 0x00, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0xfc, 0xfc, 0xf0, 0xf0},
+        {0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x30, 0x30},
+    },
+    { // U+2288 '⊈'
+        {0x00, 0x00, 0x00, 0x00, 0xf0, 0xf0, 0xfc, 0xfc, 0x0c, 0x0c, 0xff, 0xff, 0x0c, 0x0c, 0x0c, 0x0c},
+        {0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x33, 0x33, 0x33, 0x33, 0xff, 0xff, 0x33, 0x33, 0x33, 0x33},
+    },
+    { // U+2289 '⊉'
+        {0x00, 0x00, 0x00, 0x00, 0x0c, 0x0c, 0x0c, 0x0c, 0xff, 0xff, 0x0c, 0x0c, 0xfc, 0xfc, 0xf0, 0xf0},
+        {0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x33, 0x33, 0xff, 0xff, 0x33, 0x33, 0x33, 0x33, 0x30, 0x30},
+    },
+    { // U+2295 '⊕'
+        {0x00, 0x00, 0xf0, 0xf0, 0x0c, 0x0c, 0xc3, 0xc3, 0xf3, 0xf3, 0xc3, 0xc3, 0x0c, 0x0c, 0xf0, 0xf0},
+        {0x00, 0x00, 0x03, 0x03, 0x0c, 0x0c, 0x30, 0x30, 0x33, 0x33, 0x30, 0x30, 0x0c, 0x0c, 0x03, 0x03},
+    },
+    { // U+2296 '⊖'
+        {0x00, 0x00, 0xf0, 0xf0, 0x0c, 0x0c, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0x0c, 0x0c, 0xf0, 0xf0},
+        {0x00, 0x00, 0x03, 0x03, 0x0c, 0x0c, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x0c, 0x0c, 0x03, 0x03},
+    },
+    { // U+2297 '⊗'
+        {0x00, 0x00, 0xf0, 0xf0, 0x0c, 0x0c, 0x33, 0x33, 0xc3, 0xc3, 0x33, 0x33, 0x0c, 0x0c, 0xf0, 0xf0},
+        {0x00, 0x00, 0x03, 0x03, 0x0c, 0x0c, 0x33, 0x33, 0x30, 0x30, 0x33, 0x33, 0x0c, 0x0c, 0x03, 0x03},
+    },
+    { // U+2298 '⊘'
+        {0x00, 0x00, 0xf0, 0xf0, 0x0c, 0x0c, 0x03, 0x03, 0xc3, 0xc3, 0x33, 0x33, 0x0c, 0x0c, 0xf0, 0xf0},
+        {0x00, 0x00, 0x03, 0x03, 0x0c, 0x0c, 0x33, 0x33, 0x30, 0x30, 0x30, 0x30, 0x0c, 0x0c, 0x03, 0x03},
+    },
+    { // U+2299 '⊙'
+        {0x00, 0x00, 0xf0, 0xf0, 0x0c, 0x0c, 0x03, 0x03, 0xc3, 0xc3, 0x03, 0x03, 0x0c, 0x0c, 0xf0, 0xf0},
+        {0x00, 0x00, 0x03, 0x03, 0x0c, 0x0c, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x0c, 0x0c, 0x03, 0x03},
+    },
+    { // U+229A '⊚'
+        {0x00, 0x00, 0xf0, 0xf0, 0x0c, 0x0c, 0xf3, 0xf3, 0x33, 0x33, 0xf3, 0xf3, 0x0c, 0x0c, 0xf0, 0xf0},
+        {0x00, 0x00, 0x03, 0x03, 0x0c, 0x0c, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x0c, 0x0c, 0x03, 0x03},
+    },
+    { // U+229C '⊜'
+        {0x00, 0x00, 0xf0, 0xf0, 0x0c, 0x0c, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x0c, 0x0c, 0xf0, 0xf0},
+        {0x00, 0x00, 0x03, 0x03, 0x0c, 0x0c, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x0c, 0x0c, 0x03, 0x03},
+    },
+    { // U+22A5 '⊥'
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x30, 0x30, 0x3f, 0x3f, 0x30, 0x30, 0x30, 0x30, 0x00, 0x00},
+    },
+    { // U+22B9 '⊹'
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x3c, 0x3c, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00},
+    },
+    { // U+22BB '⊻'
+        {0x00, 0x00, 0x00, 0x00, 0x0c, 0x0c, 0xfc, 0xfc, 0xc0, 0xc0, 0xfc, 0xfc, 0x0c, 0x0c, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x30, 0x30, 0x33, 0x33, 0x30, 0x30, 0x30, 0x30, 0x00, 0x00},
+    },
+    { // U+22BC '⊼'
+        {0x00, 0x00, 0x00, 0x00, 0x0c, 0x0c, 0x0c, 0x0c, 0xcc, 0xcc, 0x0c, 0x0c, 0x0c, 0x0c, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x3f, 0x3f, 0x03, 0x03, 0x3f, 0x3f, 0x30, 0x30, 0x00, 0x00},
+    },
+    { // U+22BD '⊽'
+        {0x00, 0x00, 0x00, 0x00, 0xcc, 0xcc, 0xcc, 0xcc, 0x0c, 0x0c, 0xcc, 0xcc, 0xcc, 0xcc, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x0f, 0x3c, 0x3c, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00},
+    },
+    { // U+22BF '⊿'
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xf0, 0xf0, 0xfc, 0xfc},
+        {0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x3c, 0x3c, 0x3f, 0x3f, 0x33, 0x33, 0x30, 0x30, 0x3f, 0x3f},
+    },
+    { // U+22C0 '⋀'
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xf0, 0x3c, 0x3c, 0xf0, 0xf0, 0x00, 0x00, 0x00, 0x00},
+        {0x00, 0x00, 0x30, 0x30, 0x3f, 0x3f, 0x03, 0x03, 0x00, 0x00, 0x03, 0x03, 0x3f, 0x3f, 0x30, 0x30},
+    },
+    { // U+22C1 '⋁'
+        {0x00, 0x00, 0x0c, 0x0c, 0xfc, 0xfc, 0xc0, 0xc0, 0x00, 0x00, 0xc0, 0xc0, 0xfc, 0xfc, 0x0c, 0x0c},
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x0f, 0x3c, 0x3c, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00},
+    },
+    { // U+22C2 '⋂'
+        {0x00, 0x00, 0x00, 0x00, 0xf0, 0xf0, 0x3c, 0x3c, 0x0c, 0x0c, 0x3c, 0x3c, 0xf0, 0xf0, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f, 0x00, 0x00},
+    },
+    { // U+22C3 '⋃'
+        {0x00, 0x00, 0x00, 0x00, 0xfc, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xfc, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x0f, 0x0f, 0x3c, 0x3c, 0x30, 0x30, 0x3c, 0x3c, 0x0f, 0x0f, 0x00, 0x00},
+    },
+    { // U+22C4 '⋄'
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xf0, 0xf0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x0f, 0x0f, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00},
+    },
+    { // U+22C5 '⋅'
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    },
+    { // U+22C6 '⋆'
+        {0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0xf0, 0xf0, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x3f, 0x3f, 0x0f, 0x0f, 0x3f, 0x3f, 0x30, 0x30, 0x00, 0x00},
+    },
+    { // U+22EE '⋮'
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    },
+    { // U+22EF '⋯'
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+        {0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03},
+    },
+    { // U+22F0 '⋰'
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    },
+    { // U+22F1 '⋱'
+        {0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x30, 0x30, 0x00, 0x00},
+    },
+    { // U+2308 '⌈'
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xfc, 0x0c, 0x0c, 0x0c, 0x0c, 0x00, 0x00, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    },
+    { // U+2309 '⌉'
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x0c, 0x0c, 0x0c, 0xfc, 0xfc, 0x00, 0x00, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f, 0x00, 0x00, 0x00, 0x00},
+    },
+    { // U+230A '⌊'
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f, 0x30, 0x30, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00},
+    },
+    { // U+230B '⌋'
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xfc, 0x00, 0x00, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x30, 0x30, 0x3f, 0x3f, 0x00, 0x00, 0x00, 0x00},
+    },
+    { // U+231B '⌛'
+        {0x00, 0x00, 0x0c, 0x0c, 0x3c, 0x3c, 0xcc, 0xcc, 0x0c, 0x0c, 0xcc, 0xcc, 0x3c, 0x3c, 0x0c, 0x0c},
+        {0x00, 0x00, 0x30, 0x30, 0x3c, 0x3c, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3c, 0x3c, 0x30, 0x30},
+    },
+    { // U+23E9 '⏩'
+        {0x00, 0x00, 0xf0, 0xf0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xf0, 0xc0, 0xc0, 0x00, 0x00},
+        {0x00, 0x00, 0x3f, 0x3f, 0x0f, 0x0f, 0x03, 0x03, 0x00, 0x00, 0x3f, 0x3f, 0x0f, 0x0f, 0x03, 0x03},
+    },
+    { // U+23EA '⏪'
+        {0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xf0, 0xf0, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xf0, 0xf0},
+        {0x00, 0x00, 0x03, 0x03, 0x0f, 0x0f, 0x3f, 0x3f, 0x00, 0x00, 0x03, 0x03, 0x0f, 0x0f, 0x3f, 0x3f},
+    },
+    { // U+23EB '⏫'
+        {0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x3c, 0x3c, 0x3f, 0x3f, 0x3c, 0x3c, 0x30, 0x30, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x3c, 0x3c, 0x3f, 0x3f, 0x3c, 0x3c, 0x30, 0x30, 0x00, 0x00},
+    },
+    { // U+23EC '⏬'
+        {0x00, 0x00, 0x00, 0x00, 0x0c, 0x0c, 0x3c, 0x3c, 0xfc, 0xfc, 0x3c, 0x3c, 0x0c, 0x0c, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x0c, 0x0c, 0x3c, 0x3c, 0xfc, 0xfc, 0x3c, 0x3c, 0x0c, 0x0c, 0x00, 0x00},
+    },
+    { // U+23ED '⏭'
+        {0x00, 0x00, 0xf0, 0xf0, 0xc0, 0xc0, 0x00, 0x00, 0xf0, 0xf0, 0xc0, 0xc0, 0x00, 0x00, 0xf0, 0xf0},
+        {0x00, 0x00, 0x3f, 0x3f, 0x0f, 0x0f, 0x03, 0x03, 0x3f, 0x3f, 0x0f, 0x0f, 0x03, 0x03, 0x3f, 0x3f},
+    },
+    { // U+23EE '⏮'
+        {0x00, 0x00, 0xf0, 0xf0, 0x00, 0x00, 0xc0, 0xc0, 0xf0, 0xf0, 0x00, 0x00, 0xc0, 0xc0, 0xf0, 0xf0},
+        {0x00, 0x00, 0x3f, 0x3f, 0x03, 0x03, 0x0f, 0x0f, 0x3f, 0x3f, 0x03, 0x03, 0x0f, 0x0f, 0x3f, 0x3f},
+    },
+    { // U+23EF '⏯'
+        {0x00, 0x00, 0xf0, 0xf0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xf0, 0x00, 0x00, 0xf0, 0xf0},
+        {0x00, 0x00, 0x3f, 0x3f, 0x0f, 0x0f, 0x03, 0x03, 0x00, 0x00, 0x3f, 0x3f, 0x00, 0x00, 0x3f, 0x3f},
+    },
+    { // U+23F0 '⏰'
+        {0x00, 0x00, 0x00, 0x00, 0xcc, 0xcc, 0x3c, 0x3c, 0xf0, 0xf0, 0x3c, 0x3c, 0xcc, 0xcc, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x0f, 0x0f, 0x30, 0x30, 0x33, 0x33, 0x33, 0x33, 0x0f, 0x0f, 0x00, 0x00},
+    },
+    { // U+23F4 '⏴'
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xf0, 0xf0, 0x00, 0x00, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x0f, 0x0f, 0x3f, 0x3f, 0x00, 0x00, 0x00, 0x00},
+    },
+    { // U+23F6 '⏶'
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x0c, 0x0c, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0c, 0x0c, 0x00, 0x00},
+    },
+    { // U+23F7 '⏷'
+        {0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x0f, 0x0f, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00},
+    },
+    { // U+23F8 '⏸'
+        {0x00, 0x00, 0x00, 0x00, 0xf0, 0xf0, 0xf0, 0xf0, 0x00, 0x00, 0xf0, 0xf0, 0xf0, 0xf0, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3f, 0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3f, 0x00, 0x00},
+    },
+    { // U+23F9 '⏹'
+        {0x00, 0x00, 0x00, 0x00, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x00, 0x00},
+    },
+    { // U+23FA '⏺'
+        {0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xc0, 0xc0, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x0f, 0x0f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x0f, 0x0f, 0x00, 0x00},
+    },
+    { // U+23FB '⏻'
+        {0x00, 0x00, 0xf0, 0xf0, 0x0c, 0x0c, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x0c, 0x0c, 0xf0, 0xf0},
+        {0x00, 0x00, 0x03, 0x03, 0x0c, 0x0c, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x0c, 0x0c, 0x03, 0x03},
+    },
+    { // U+23FE '⏾'
+        {0x00, 0x00, 0x00, 0x00, 0xf0, 0xf0, 0xfc, 0xfc, 0x3c, 0x3c, 0x0c, 0x0c, 0x0c, 0x0c, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x0f, 0x0f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3c, 0x3c, 0x3c, 0x3c, 0x0f, 0x0f},
+    },
+    { // U+FFFD '�'
+        {0x00, 0x00, 0xc0, 0xc0, 0xf0, 0xf0, 0xcc, 0xcc, 0xcf, 0xcf, 0x3c, 0x3c, 0xf0, 0xf0, 0xc0, 0xc0},
+        {0x00, 0x00, 0x03, 0x03, 0x0f, 0x0f, 0x3f, 0x3f, 0xcc, 0xcc, 0x3f, 0x3f, 0x0f, 0x0f, 0x03, 0x03},
+    },
+};
+
+static uint16_t const font8x8_glyph_bitmap_indices[font8x8_glyph_count] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 12, 13, 14,
+    15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30,
+    31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46,
+    47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62,
+    63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78,
+    79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94,
+    95, 96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 33, 34, 107, 108,
+    37, 109, 40, 110, 41, 43, 111, 45, 46, 112, 47, 113, 114, 115, 116, 57,
+    117, 56, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131,
+    132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 33, 146,
+    34, 147, 148, 37, 149, 150, 151, 152, 43, 153, 45, 40, 47, 113, 48, 35,
+    52, 154, 117, 56, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, 65, 165,
+    166, 167, 168, 69, 169, 170, 171, 172, 129, 173, 174, 175, 79, 176, 80, 67,
+    177, 89, 178, 88, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190,
+    191, 192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206,
+    207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222,
+    223, 224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 92, 235, 236, 237,
+    238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253,
+    254, 255, 256, 257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268, 269,
+    270, 271, 272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 284, 285,
+    286, 287, 288, 289, 290, 291, 292, 293, 294, 295, 296, 297, 298, 197, 299, 300,
+    301, 302, 303, 304, 305, 306,
+};
+
+static uint16_t const font8x8_direct_glyph_indices[1106] = {
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 14, 15, 16,
+    17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32,
+    33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48,
+    49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64,
+    65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+    81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 96, 341, 97, 341, 98, 99, 341, 100, 341,
+    101, 102, 341, 341, 341, 341, 103, 104, 341, 341, 341, 105, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 106, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 107, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122,
+    123, 124, 341, 125, 126, 127, 128, 129, 130, 131, 341, 341, 341, 341, 341, 341,
+    341, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146,
+    147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 157, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    158, 159, 160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173,
+    174, 175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189,
+    190, 191, 192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205,
+    206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221,
+    341, 222,
+};
+
+static Font8x8Range const font8x8_ranges[] = {
+    {0x2014, 1, 223},
+    {0x2018, 2, 224},
+    {0x201c, 3, 226},
+    {0x2022, 2, 229},
+    {0x2026, 1, 231},
+    {0x2190, 4, 232},
+    {0x2196, 4, 236},
+    {0x21b0, 5, 240},
+    {0x2200, 1, 245},
+    {0x2202, 8, 246},
+    {0x220b, 2, 254},
+    {0x220e, 5, 256},
+    {0x2217, 4, 261},
+    {0x221e, 3, 265},
+    {0x2223, 9, 268},
+    {0x2243, 1, 277},
+    {0x2245, 1, 278},
+    {0x2248, 1, 279},
+    {0x2260, 3, 280},
+    {0x2264, 2, 283},
+    {0x226a, 2, 285},
+    {0x2282, 8, 287},
+    {0x2295, 6, 295},
+    {0x229c, 1, 301},
+    {0x22a5, 1, 302},
+    {0x22b9, 1, 303},
+    {0x22bb, 3, 304},
+    {0x22bf, 8, 307},
+    {0x22ee, 4, 315},
+    {0x2308, 4, 319},
+    {0x231b, 1, 323},
+    {0x23e9, 8, 324},
+    {0x23f4, 8, 332},
+    {0x23fe, 1, 340},
+    {0xfffd, 1, 341},
+};
+
+static Font8x8Index const font8x8_index = {
+    .direct_glyph_indices = font8x8_direct_glyph_indices,
+    .direct_count = 1106,
+    .ranges = font8x8_ranges,
+    .range_count = 35,
+    .fallback_glyph_index = 341,
+};
@@ -0,0 +1,476 @@
+// Generated file. Do not edit manually.
+
+#include <stdint.h>
+
+#include "font8x8.h"
+
+#define font8x8_glyph_width 8
+#define font8x8_glyph_height 8
+#define font8x8_glyph_count 342
+
+// Masks of the glyphs by the glyph index, to be uploaded as uvec2[] into a storage buffer (see
+// font8x8_gpu.glsl). Every byte is a row, the top row is the least significant byte of the first word
+// and the most significant bit of a row is its leftmost pixel.
+static uint32_t const font8x8_gpu_masks[font8x8_glyph_count][2] = {
+    {0x00000000, 0x00000000}, // U+0020
+    {0x0c0c0c00, 0x000c000c}, // U+0021
+    {0x14141400, 0x00000000}, // U+0022
+    {0x367f3600, 0x00367f36}, // U+0023
+    {0x7f687f08, 0x087f6b0b}, // U+0024
+    {0x78567300, 0x0067350f}, // U+0025
+    {0x7d243c00, 0x007f464f}, // U+0026
+    {0x08080800, 0x00000000}, // U+0027
+    {0x10180c00, 0x000c1810}, // U+0028
+    {0x040c1800, 0x00180c04}, // U+0029
+    {0x1c3e0800, 0x00000036}, // U+002A
+    {0x08080000, 0x0008083e}, // U+002B
+    {0x00000000, 0x040c0c00}, // U+002C
+    {0x00000000, 0x040c0c00}, // U+002C
+    {0x00000000, 0x0000001c}, // U+002D
+    {0x00000000, 0x000c0c00}, // U+002E
+    {0x0c060200, 0x00203018}, // U+002F
+    {0x36361c00, 0x001c3636}, // U+0030
+    {0x3c1c0c00, 0x003e0c0c}, // U+0031
+    {0x06363e00, 0x003e301c}, // U+0032
+    {0x0c263e00, 0x003e3606}, // U+0033
+    {0x361e0e00, 0x00063f36}, // U+0034
+    {0x3c303e00, 0x003c3606}, // U+0035
+    {0x30361e00, 0x003e363e}, // U+0036
+    {0x0e063e00, 0x0018180c}, // U+0037
+    {0x3e141c00, 0x003e3636}, // U+0038
+    {0x3e363e00, 0x003c3606}, // U+0039
+    {0x0c0c0000, 0x000c0c00}, // U+003A
+    {0x0c0c0000, 0x040c0c00}, // U+003B
+    {0x1c060000, 0x00061c30}, // U+003C
+    {0x3e000000, 0x00003e00}, // U+003D
+    {0x1c300000, 0x00301c06}, // U+003E
+    {0x07333f00, 0x000c000c}, // U+003F
+    {0x4d633e00, 0x30675d55}, // U+0040
+    {0x7f633e00, 0x00636363}, // U+0041
+    {0x7f667c00, 0x007f6363}, // U+0042
+    {0x60733f00, 0x003f7360}, // U+0043
+    {0x63677e00, 0x007e6763}, // U+0044
+    {0x7f607f00, 0x007f6060}, // U+0045
+    {0x7c607f00, 0x00606060}, // U+0046
+    {0x6f703f00, 0x003f7363}, // U+0047
+    {0x7f636300, 0x00636363}, // U+0048
+    {0x0c0c1e00, 0x001e0c0c}, // U+0049
+    {0x0c0c3e00, 0x003c2c0c}, // U+004A
+    {0x7c6e6700, 0x0063677e}, // U+004B
+    {0x60606000, 0x007e6060}, // U+004C
+    {0x7f776300, 0x0063636b}, // U+004D
+    {0x7f7b7300, 0x0063676f}, // U+004E
+    {0x63633e00, 0x003e6363}, // U+004F
+    {0x7f637e00, 0x00606060}, // U+0050
+    {0x63633e00, 0x073e6f63}, // U+0051
+    {0x7f637e00, 0x00676e7c}, // U+0052
+    {0x7f703f00, 0x007e6707}, // U+0053
+    {0x0c0c3f00, 0x000c0c0c}, // U+0054
+    {0x63636300, 0x003e7f63}, // U+0055
+    {0x36776300, 0x001c1c3e}, // U+0056
+    {0x6b636300, 0x0063777f}, // U+0057
+    {0x1c3e7700, 0x0063773e}, // U+0058
+    {0x3e776300, 0x001c1c1c}, // U+0059
+    {0x0e077f00, 0x007f381c}, // U+005A
+    {0x10101c00, 0x001c1010}, // U+005B
+    {0x18302000, 0x0002060c}, // U+005C
+    {0x04041c00, 0x001c0404}, // U+005D
+    {0x361c0800, 0x00000022}, // U+005E
+    {0x00000000, 0x007f0000}, // U+005F
+    {0x040c1800, 0x00000000}, // U+0060
+    {0x037e0000, 0x007f637f}, // U+0061
+    {0x637e6000, 0x007f6363}, // U+0062
+    {0x633f0000, 0x003f6360}, // U+0063
+    {0x633f0300, 0x007f6363}, // U+0064
+    {0x637f0000, 0x007f607f}, // U+0065
+    {0x78633f00, 0x00606060}, // U+0066
+    {0x633f0000, 0x7f037f63}, // U+0067
+    {0x637e6000, 0x00636363}, // U+0068
+    {0x0c3c001c, 0x003e0c0c}, // U+0069
+    {0x0c3e001c, 0x3c2c0c0c}, // U+006A
+    {0x6e666000, 0x00677e7c}, // U+006B
+    {0x0c0c3c00, 0x003e0c0c}, // U+006C
+    {0x7f760000, 0x006b6b6b}, // U+006D
+    {0x637e0000, 0x00636363}, // U+006E
+    {0x633e0000, 0x003e6363}, // U+006F
+    {0x637e0000, 0x60607f63}, // U+0070
+    {0x633f0000, 0x03037f63}, // U+0071
+    {0x737f0000, 0x00606060}, // U+0072
+    {0x607f0000, 0x007f037f}, // U+0073
+    {0x183e1800, 0x001e1a18}, // U+0074
+    {0x63630000, 0x003f6363}, // U+0075
+    {0x63630000, 0x001c3663}, // U+0076
+    {0x6b630000, 0x00143e6b}, // U+0077
+    {0x77630000, 0x0063771c}, // U+0078
+    {0x63630000, 0x7e037f63}, // U+0079
+    {0x077f0000, 0x007f703e}, // U+007A
+    {0x18080c00, 0x000c0818}, // U+007B
+    {0x08080800, 0x00080808}, // U+007C
+    {0x0c081800, 0x0018080c}, // U+007D
+    {0x79300000, 0x0000064f}, // U+007E
+    {0x26381e00, 0x003c0e32}, // U+00A7
+    {0x515d221c, 0x001c225d}, // U+00A9
+    {0x36120000, 0x0012366c}, // U+00AB
+    {0x00000000, 0x0002023e}, // U+00AC
+    {0x595d221c, 0x001c2255}, // U+00AE
+    {0x1c141c00, 0x00000000}, // U+00B0
+    {0x1c080000, 0x001c0008}, // U+00B1
+    {0x3a3a1a00, 0x0002021a}, // U+00B6
+    {0x18000000, 0x00000018}, // U+00B7
+    {0x36240000, 0x0024361b}, // U+00BB
+    {0x36220000, 0x0022361c}, // U+00D7
+    {0x00080000, 0x0008003e}, // U+00F7
+    {0x7f633e00, 0x00636363}, // U+0391
+    {0x7f667c00, 0x007f6363}, // U+0392
+    {0x60637f00, 0x00606060}, // U+0393
+    {0x361c1c00, 0x007f6336}, // U+0394
+    {0x7f607f00, 0x007f6060}, // U+0395
+    {0x0e677f00, 0x007f391c}, // U+0396
+    {0x7f636300, 0x00636363}, // U+0397
+    {0x7f633e00, 0x003e6363}, // U+0398
+    {0x0c0c1e00, 0x001e0c0c}, // U+0399
+    {0x7c6e6700, 0x0063677e}, // U+039A
+    {0x361c1c00, 0x00636336}, // U+039B
+    {0x7f776300, 0x0063636b}, // U+039C
+    {0x7f7b7300, 0x0063676f}, // U+039D
+    {0x3e007f00, 0x007f7f00}, // U+039E
+    {0x63633e00, 0x003e6363}, // U+039F
+    {0x63637f00, 0x00636363}, // U+03A0
+    {0x7f637f00, 0x00606060}, // U+03A1
+    {0x1c307f00, 0x007f7038}, // U+03A3
+    {0x0c2d3f00, 0x000c0c0c}, // U+03A4
+    {0x3e776300, 0x001c1c1c}, // U+03A5
+    {0x6b6b3e00, 0x00083e6b}, // U+03A6
+    {0x1c3e7700, 0x0063773e}, // U+03A7
+    {0x6b6b6b00, 0x0008083e}, // U+03A8
+    {0x63773e00, 0x00773663}, // U+03A9
+    {0x773d0000, 0x007b6e67}, // U+03B1
+    {0x663e0000, 0x607f637f}, // U+03B2
+    {0x77630000, 0x0c1c1c36}, // U+03B3
+    {0x1e303f00, 0x001e333f}, // U+03B4
+    {0x323e0000, 0x003e3218}, // U+03B5
+    {0x180c3e00, 0x061e3030}, // U+03B6
+    {0x736e0000, 0x03036363}, // U+03B7
+    {0x633e0000, 0x003e637f}, // U+03B8
+    {0x18380000, 0x000e1e18}, // U+03B9
+    {0x6e670000, 0x00677e7c}, // U+03BA
+    {0x1c387000, 0x0063773e}, // U+03BB
+    {0x66660000, 0x60607b6e}, // U+03BC
+    {0x73630000, 0x000c1e37}, // U+03BD
+    {0x3e183e00, 0x061e3830}, // U+03BE
+    {0x773e0000, 0x003e7763}, // U+03BF
+    {0x367f0000, 0x00373636}, // U+03C0
+    {0x673e0000, 0x60607e67}, // U+03C1
+    {0x361e0000, 0x061e3030}, // U+03C2
+    {0x361f0000, 0x001c3636}, // U+03C3
+    {0x187e0000, 0x000e1e18}, // U+03C4
+    {0x37360000, 0x001f3f33}, // U+03C5
+    {0x6d6f0000, 0x0c0c3f6d}, // U+03C6
+    {0x36360000, 0x36361c1c}, // U+03C7
+    {0x6b080000, 0x083e6b6b}, // U+03C8
+    {0x6b630000, 0x00367f6b}, // U+03C9
+    {0x7f607f22, 0x007f6060}, // U+0401
+    {0x7f633e00, 0x00636363}, // U+0410
+    {0x7f607f00, 0x007f6363}, // U+0411
+    {0x7f667c00, 0x007f6363}, // U+0412
+    {0x60607e00, 0x00606060}, // U+0413
+    {0x26263e00, 0x637f7f26}, // U+0414
+    {0x7f607f00, 0x007f6060}, // U+0415
+    {0x3e6b6b00, 0x006b6b6b}, // U+0416
+    {0x7e077e00, 0x007e0707}, // U+0417
+    {0x6f676300, 0x0063737b}, // U+0418
+    {0x6f67631c, 0x0063737b}, // U+0419
+    {0x7c6e6700, 0x0063677e}, // U+041A
+    {0x363e1c00, 0x00636363}, // U+041B
+    {0x7f776300, 0x0063636b}, // U+041C
+    {0x7f636300, 0x00636363}, // U+041D
+    {0x63633e00, 0x003e6363}, // U+041E
+    {0x63637f00, 0x00636363}, // U+041F
+    {0x7f637e00, 0x00606060}, // U+0420
+    {0x60733f00, 0x003f7360}, // U+0421
+    {0x0c0c3f00, 0x000c0c0c}, // U+0422
+    {0x3e776300, 0x0070381c}, // U+0423
+    {0x6b6b3e00, 0x00083e6b}, // U+0424
+    {0x1c3e7700, 0x0063773e}, // U+0425
+    {0x66666600, 0x037f7e66}, // U+0426
+    {0x7f636300, 0x00030303}, // U+0427
+    {0x6b6b6b00, 0x007f7f6b}, // U+0428
+    {0x6b6b6b00, 0x017f7f6b}, // U+0429
+    {0x3e707000, 0x80be3636}, // U+042A
+    {0x7b636300, 0x007b6b6b}, // U+042B
+    {0x3e303000, 0x003e3636}, // U+042C
+    {0x3f037e00, 0x007e0303}, // U+042D
+    {0x7b6b6f00, 0x006f6f6b}, // U+042E
+    {0x7f633f00, 0x00733b1f}, // U+042F
+    {0x037e0000, 0x007f637f}, // U+0430
+    {0x607f0000, 0x007f637f}, // U+0431
+    {0x637e0000, 0x007e637e}, // U+0432
+    {0x607f0000, 0x00606060}, // U+0433
+    {0x363e0000, 0x637f3636}, // U+0434
+    {0x637f0000, 0x007f607f}, // U+0435
+    {0x6b6b0000, 0x006b6b3e}, // U+0436
+    {0x077e0000, 0x007e077e}, // U+0437
+    {0x67630000, 0x00737b6f}, // U+0438
+    {0x67631c00, 0x00737b6f}, // U+0439
+    {0x6e670000, 0x00677e7c}, // U+043A
+    {0x1f0f0000, 0x0063733b}, // U+043B
+    {0x77630000, 0x00636b7f}, // U+043C
+    {0x63630000, 0x0063637f}, // U+043D
+    {0x633e0000, 0x003e6363}, // U+043E
+    {0x637f0000, 0x00636363}, // U+043F
+    {0x637e0000, 0x60607f63}, // U+0440
+    {0x633f0000, 0x003f6360}, // U+0441
+    {0x0c3f0000, 0x000c0c0c}, // U+0442
+    {0x63630000, 0x7e037f63}, // U+0443
+    {0x6b3e0000, 0x08087f6b}, // U+0444
+    {0x77630000, 0x0063771c}, // U+0445
+    {0x66660000, 0x037f6666}, // U+0446
+    {0x63630000, 0x0003037f}, // U+0447
+    {0x6b6b0000, 0x007f6b6b}, // U+0448
+    {0x6b6b0000, 0x017f6b6b}, // U+0449
+    {0x30700000, 0x80be363e}, // U+044A
+    {0x63630000, 0x007b6b7b}, // U+044B
+    {0x30300000, 0x003e363e}, // U+044C
+    {0x037f0000, 0x007f033f}, // U+044D
+    {0x6b6f0000, 0x006f6b7b}, // U+044E
+    {0x637f0000, 0x00731f7f}, // U+044F
+    {0x637f0022, 0x007f607f}, // U+0451
+    {0x00000000, 0x0000007f}, // U+2014
+    {0x0c0c0800, 0x00000000}, // U+2018
+    {0x040c0c00, 0x00000000}, // U+2019
+    {0x36362400, 0x00000000}, // U+201C
+    {0x12363600, 0x00000000}, // U+201D
+    {0x00000000, 0x12363600}, // U+201E
+    {0x1c000000, 0x00001c1c}, // U+2022
+    {0x18100000, 0x0010181c}, // U+2023
+    {0x00000000, 0x002a0000}, // U+2026
+    {0x7e301000, 0x0010307e}, // U+2190
+    {0x3f1e0c00, 0x000c0c0c}, // U+2191
+    {0x3f060400, 0x0004063f}, // U+2192
+    {0x0c0c0c00, 0x000c1e3f}, // U+2193
+    {0x3c383c00, 0x0000062e}, // U+2196
+    {0x1e0e1e00, 0x0000303a}, // U+2197
+    {0x1e3a3000, 0x00001e0e}, // U+2198
+    {0x3c2e0600, 0x00003c38}, // U+2199
+    {0x3f180800, 0x000b1b3f}, // U+21B0
+    {0x3f060400, 0x0034363f}, // U+21B1
+    {0x3f1b0b00, 0x0008183f}, // U+21B2
+    {0x3f363400, 0x0004063f}, // U+21B3
+    {0x0c3c3c00, 0x000c1e3f}, // U+21B4
+    {0x3e636300, 0x001c1c36}, // U+2200
+    {0x1c041c00, 0x001c1414}, // U+2202
+    {0x3e023e00, 0x003e0202}, // U+2203
+    {0x3e0a3e08, 0x083e0a0a}, // U+2204
+    {0x261d0000, 0x005c322a}, // U+2205
+    {0x36141c00, 0x007f6322}, // U+2206
+    {0x22637f00, 0x001c1436}, // U+2207
+    {0x301e0000, 0x001e303e}, // U+2208
+    {0x341e0400, 0x041e343e}, // U+2209
+    {0x063c0000, 0x003c063e}, // U+220B
+    {0x163c1000, 0x103c163e}, // U+220C
+    {0x1c1c0000, 0x001c1c1c}, // U+220E
+    {0x22223e00, 0x00222222}, // U+220F
+    {0x22222200, 0x003e2222}, // U+2210
+    {0x0c103e00, 0x003e3018}, // U+2211
+    {0x00000000, 0x0000003e}, // U+2212
+    {0x3e2a0000, 0x002a3e1c}, // U+2217
+    {0x1c000000, 0x00001c14}, // U+2218
+    {0x0c000000, 0x0000000c}, // U+2219
+    {0x76030300, 0x000c1c16}, // U+221A
+    {0x4d360000, 0x00003659}, // U+221E
+    {0x20200000, 0x003e2020}, // U+221F
+    {0x04000000, 0x003e1008}, // U+2220
+    {0x08080800, 0x00080808}, // U+2223
+    {0x0c0a0800, 0x00082818}, // U+2224
+    {0x14141400, 0x00141414}, // U+2225
+    {0x1c161500, 0x00145434}, // U+2226
+    {0x1c080000, 0x00223614}, // U+2227
+    {0x36220000, 0x00081c14}, // U+2228
+    {0x361c0000, 0x00222222}, // U+2229
+    {0x22220000, 0x001c3622}, // U+222A
+    {0x0a0e0e00, 0x00383828}, // U+222B
+    {0x7b310000, 0x007f004e}, // U+2243
+    {0x004e7b31, 0x007f007f}, // U+2245
+    {0x4e7b3100, 0x004e7b31}, // U+2248
+    {0x3e080000, 0x00083e08}, // U+2260
+    {0x003e0000, 0x003e003e}, // U+2261
+    {0x083e0800, 0x083e083e}, // U+2262
+    {0x301c0600, 0x003e003e}, // U+2264
+    {0x061c3000, 0x003e003e}, // U+2265
+    {0x361b0000, 0x001b366c}, // U+226A
+    {0x366c0000, 0x006c361b}, // U+226B
+    {0x301f0000, 0x001f3020}, // U+2282
+    {0x033e0000, 0x003e0301}, // U+2283
+    {0x341f0400, 0x041f3424}, // U+2284
+    {0x0b3e0800, 0x083e0b09}, // U+2285
+    {0x30301f00, 0x003f001f}, // U+2286
+    {0x03033e00, 0x003f003e}, // U+2287
+    {0x34341f04, 0x043f041f}, // U+2288
+    {0x0b0b3e08, 0x083f083e}, // U+2289
+    {0x5d49221c, 0x001c2249}, // U+2295
+    {0x5d41221c, 0x001c2241}, // U+2296
+    {0x4955221c, 0x001c2255}, // U+2297
+    {0x4945221c, 0x001c2251}, // U+2298
+    {0x4941221c, 0x001c2241}, // U+2299
+    {0x555d221c, 0x001c225d}, // U+229A
+    {0x415d221c, 0x001c225d}, // U+229C
+    {0x08080000, 0x003e0808}, // U+22A5
+    {0x08080000, 0x00080836}, // U+22B9
+    {0x1c143600, 0x003e0008}, // U+22BB
+    {0x08003e00, 0x0036141c}, // U+22BC
+    {0x36003e00, 0x00081c14}, // U+22BD
+    {0x07030100, 0x003f190d}, // U+22BF
+    {0x141c0800, 0x00632236}, // U+22C0
+    {0x36226300, 0x00081c14}, // U+22C1
+    {0x22361c00, 0x00222222}, // U+22C2
+    {0x22222200, 0x001c3622}, // U+22C3
+    {0x1c080000, 0x0000081c}, // U+22C4
+    {0x00000000, 0x00000008}, // U+22C5
+    {0x3e080000, 0x00361c1c}, // U+22C6
+    {0x08000800, 0x00080000}, // U+22EE
+    {0x00000000, 0x00000049}, // U+22EF
+    {0x00020000, 0x00200008}, // U+22F0
+    {0x00200000, 0x00020008}, // U+22F1
+    {0x10101c00, 0x00101010}, // U+2308
+    {0x04041c00, 0x00040404}, // U+2309
+    {0x10101000, 0x001c1010}, // U+230A
+    {0x04040400, 0x001c0404}, // U+230B
+    {0x14227f00, 0x007f221c}, // U+231B
+    {0x66440000, 0x00446677}, // U+23E9
+    {0x33110000, 0x00113377}, // U+23EA
+    {0x003e1c08, 0x003e1c08}, // U+23EB
+    {0x081c3e00, 0x081c3e00}, // U+23EC
+    {0x6d490000, 0x00496d7f}, // U+23ED
+    {0x5b490000, 0x00495b7f}, // U+23EE
+    {0x65450000, 0x00456575}, // U+23EF
+    {0x2a1c3600, 0x001c222e}, // U+23F0
+    {0x0c040000, 0x00040c1c}, // U+23F4
+    {0x18100000, 0x0010181c}, // U+23F5
+    {0x08000000, 0x00003e1c}, // U+23F6
+    {0x3e000000, 0x0000081c}, // U+23F7
+    {0x36360000, 0x00363636}, // U+23F8
+    {0x3e3e0000, 0x003e3e3e}, // U+23F9
+    {0x3e1c0000, 0x001c3e3e}, // U+23FA
+    {0x49492a08, 0x001c2241}, // U+23FB
+    {0x30381e00, 0x001e3f39}, // U+23FE
+    {0x7b261c08, 0x08143e77}, // U+FFFD
+};
+
+static uint16_t const font8x8_direct_glyph_indices[1106] = {
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 14, 15, 16,
+    17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32,
+    33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48,
+    49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64,
+    65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+    81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 96, 341, 97, 341, 98, 99, 341, 100, 341,
+    101, 102, 341, 341, 341, 341, 103, 104, 341, 341, 341, 105, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 106, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 107, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122,
+    123, 124, 341, 125, 126, 127, 128, 129, 130, 131, 341, 341, 341, 341, 341, 341,
+    341, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146,
+    147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 157, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    158, 159, 160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173,
+    174, 175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189,
+    190, 191, 192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205,
+    206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221,
+    341, 222,
+};
+
+static Font8x8Range const font8x8_ranges[] = {
+    {0x2014, 1, 223},
+    {0x2018, 2, 224},
+    {0x201c, 3, 226},
+    {0x2022, 2, 229},
+    {0x2026, 1, 231},
+    {0x2190, 4, 232},
+    {0x2196, 4, 236},
+    {0x21b0, 5, 240},
+    {0x2200, 1, 245},
+    {0x2202, 8, 246},
+    {0x220b, 2, 254},
+    {0x220e, 5, 256},
+    {0x2217, 4, 261},
+    {0x221e, 3, 265},
+    {0x2223, 9, 268},
+    {0x2243, 1, 277},
+    {0x2245, 1, 278},
+    {0x2248, 1, 279},
+    {0x2260, 3, 280},
+    {0x2264, 2, 283},
+    {0x226a, 2, 285},
+    {0x2282, 8, 287},
+    {0x2295, 6, 295},
+    {0x229c, 1, 301},
+    {0x22a5, 1, 302},
+    {0x22b9, 1, 303},
+    {0x22bb, 3, 304},
+    {0x22bf, 8, 307},
+    {0x22ee, 4, 315},
+    {0x2308, 4, 319},
+    {0x231b, 1, 323},
+    {0x23e9, 8, 324},
+    {0x23f4, 8, 332},
+    {0x23fe, 1, 340},
+    {0xfffd, 1, 341},
+};
+
+static Font8x8Index const font8x8_index = {
+    .direct_glyph_indices = font8x8_direct_glyph_indices,
+    .direct_count = 1106,
+    .ranges = font8x8_ranges,
+    .range_count = 35,
+    .fallback_glyph_index = 341,
+};
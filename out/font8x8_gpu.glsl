@@ -0,0 +1,68 @@
+// Generated file. Do not edit manually.
+//
+// Draws text as instanced cells right from the glyph masks of font8x8_gpu.c, which are bound as the
+// storage buffer 0. The same source is both stages: put "#version 430" and then the define of
+// VERTEX_SHADER or FRAGMENT_SHADER in front of it.
+//
+// Each instance is a cell: its column and row and the glyph index (from font8x8_index, see
+// font8x8_glyph_index), as integer attributes with the divisor of 1. Draw 6 vertices per
+// instance, with no vertex buffer:
+//
+//     glDrawArraysInstanced(GL_TRIANGLES, 0, 6, cell_count);
+
+const uint font8x8_glyph_width = 8u;
+const uint font8x8_glyph_height = 8u;
+
+// In pixels, with the origin at the top left corner.
+uniform vec2 font8x8_screen_size;
+uniform vec2 font8x8_origin;
+uniform float font8x8_scale;
+
+#if defined(VERTEX_SHADER)
+
+layout(location = 0) in ivec2 font8x8_instance_cell;
+layout(location = 1) in uint font8x8_instance_glyph_index;
+
+out vec2 font8x8_glyph_position;
+flat out uint font8x8_glyph_index;
+
+const vec2 font8x8_corners[6] = vec2[6](
+    vec2(0.0, 0.0), vec2(1.0, 0.0), vec2(0.0, 1.0),
+    vec2(0.0, 1.0), vec2(1.0, 0.0), vec2(1.0, 1.0)
+);
+
+void main() {
+    vec2 corner = font8x8_corners[gl_VertexID];
+    vec2 glyph_size = vec2(font8x8_glyph_width, font8x8_glyph_height);
+    vec2 position = font8x8_origin + (vec2(font8x8_instance_cell) + corner) * glyph_size * font8x8_scale;
+    vec2 clip_position = position / font8x8_screen_size * 2.0 - 1.0;
+    gl_Position = vec4(clip_position.x, -clip_position.y, 0.0, 1.0);
+
+    font8x8_glyph_position = corner * glyph_size;
+    font8x8_glyph_index = font8x8_instance_glyph_index;
+}
+
+#elif defined(FRAGMENT_SHADER)
+
+layout(std430, binding = 0) readonly buffer font8x8_masks_buffer {
+    uvec2 font8x8_masks[];
+};
+
+uniform vec4 font8x8_ink_color;
+uniform vec4 font8x8_background_color;
+
+in vec2 font8x8_glyph_position;
+flat in uint font8x8_glyph_index;
+
+out vec4 font8x8_color;
+
+void main() {
+    uvec2 pixel = min(uvec2(font8x8_glyph_position), uvec2(font8x8_glyph_width - 1u, font8x8_glyph_height - 1u));
+    uvec2 mask = font8x8_masks[font8x8_glyph_index];
+    uint rows = pixel.y < 4u ? mask.x : mask.y;
+    uint row = (rows >> ((pixel.y & 3u) * 8u)) & 0xffu;
+    bool is_set = ((row >> (7u - pixel.x)) & 1u) != 0u;
+    font8x8_color = is_set ? font8x8_ink_color : font8x8_background_color;
+}
+
+#endif
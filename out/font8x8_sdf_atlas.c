@@ -0,0 +1,479 @@
+// Generated file. Do not edit manually.
+
+#include <stdint.h>
+
+#include "font8x8.h"
+
+#define font8x8_sdf_atlas_width 1024
+#define font8x8_sdf_atlas_height 1024
+#define font8x8_sdf_glyph_width 32
+#define font8x8_sdf_glyph_height 32
+#define font8x8_sdf_glyph_count 342
+
+// Values (the alpha, or the gray of a PNG) are 0.5 + distance / (2 * spread), where the distance
+// to the edge is in pixels and positive inside. Each rect has spread pixels of the field around it.
+#define font8x8_sdf_distance_field_spread 4
+
+static Font8x8AtlasRect const font8x8_sdf_atlas_rects[font8x8_sdf_glyph_count] = {
+    {8, 8, 32, 32, 0.0078125f, 0.0078125f, 0.0390625f, 0.0390625f}, // U+0020
+    {48, 8, 32, 32, 0.046875f, 0.0078125f, 0.078125f, 0.0390625f}, // U+0021
+    {88, 8, 32, 32, 0.0859375f, 0.0078125f, 0.1171875f, 0.0390625f}, // U+0022
+    {128, 8, 32, 32, 0.125f, 0.0078125f, 0.15625f, 0.0390625f}, // U+0023
+    {168, 8, 32, 32, 0.1640625f, 0.0078125f, 0.1953125f, 0.0390625f}, // U+0024
+    {208, 8, 32, 32, 0.203125f, 0.0078125f, 0.234375f, 0.0390625f}, // U+0025
+    {248, 8, 32, 32, 0.2421875f, 0.0078125f, 0.2734375f, 0.0390625f}, // U+0026
+    {288, 8, 32, 32, 0.28125f, 0.0078125f, 0.3125f, 0.0390625f}, // U+0027
+    {328, 8, 32, 32, 0.3203125f, 0.0078125f, 0.3515625f, 0.0390625f}, // U+0028
+    {368, 8, 32, 32, 0.359375f, 0.0078125f, 0.390625f, 0.0390625f}, // U+0029
+    {408, 8, 32, 32, 0.3984375f, 0.0078125f, 0.4296875f, 0.0390625f}, // U+002A
+    {448, 8, 32, 32, 0.4375f, 0.0078125f, 0.46875f, 0.0390625f}, // U+002B
+    {488, 8, 32, 32, 0.4765625f, 0.0078125f, 0.5078125f, 0.0390625f}, // U+002C
+    {488, 8, 32, 32, 0.4765625f, 0.0078125f, 0.5078125f, 0.0390625f}, // U+002C
+    {528, 8, 32, 32, 0.515625f, 0.0078125f, 0.546875f, 0.0390625f}, // U+002D
+    {568, 8, 32, 32, 0.5546875f, 0.0078125f, 0.5859375f, 0.0390625f}, // U+002E
+    {608, 8, 32, 32, 0.59375f, 0.0078125f, 0.625f, 0.0390625f}, // U+002F
+    {648, 8, 32, 32, 0.6328125f, 0.0078125f, 0.6640625f, 0.0390625f}, // U+0030
+    {688, 8, 32, 32, 0.671875f, 0.0078125f, 0.703125f, 0.0390625f}, // U+0031
+    {728, 8, 32, 32, 0.7109375f, 0.0078125f, 0.7421875f, 0.0390625f}, // U+0032
+    {768, 8, 32, 32, 0.75f, 0.0078125f, 0.78125f, 0.0390625f}, // U+0033
+    {808, 8, 32, 32, 0.7890625f, 0.0078125f, 0.8203125f, 0.0390625f}, // U+0034
+    {848, 8, 32, 32, 0.828125f, 0.0078125f, 0.859375f, 0.0390625f}, // U+0035
+    {888, 8, 32, 32, 0.8671875f, 0.0078125f, 0.8984375f, 0.0390625f}, // U+0036
+    {928, 8, 32, 32, 0.90625f, 0.0078125f, 0.9375f, 0.0390625f}, // U+0037
+    {968, 8, 32, 32, 0.9453125f, 0.0078125f, 0.9765625f, 0.0390625f}, // U+0038
+    {8, 48, 32, 32, 0.0078125f, 0.046875f, 0.0390625f, 0.078125f}, // U+0039
+    {48, 48, 32, 32, 0.046875f, 0.046875f, 0.078125f, 0.078125f}, // U+003A
+    {88, 48, 32, 32, 0.0859375f, 0.046875f, 0.1171875f, 0.078125f}, // U+003B
+    {128, 48, 32, 32, 0.125f, 0.046875f, 0.15625f, 0.078125f}, // U+003C
+    {168, 48, 32, 32, 0.1640625f, 0.046875f, 0.1953125f, 0.078125f}, // U+003D
+    {208, 48, 32, 32, 0.203125f, 0.046875f, 0.234375f, 0.078125f}, // U+003E
+    {248, 48, 32, 32, 0.2421875f, 0.046875f, 0.2734375f, 0.078125f}, // U+003F
+    {288, 48, 32, 32, 0.28125f, 0.046875f, 0.3125f, 0.078125f}, // U+0040
+    {328, 48, 32, 32, 0.3203125f, 0.046875f, 0.3515625f, 0.078125f}, // U+0041
+    {368, 48, 32, 32, 0.359375f, 0.046875f, 0.390625f, 0.078125f}, // U+0042
+    {408, 48, 32, 32, 0.3984375f, 0.046875f, 0.4296875f, 0.078125f}, // U+0043
+    {448, 48, 32, 32, 0.4375f, 0.046875f, 0.46875f, 0.078125f}, // U+0044
+    {488, 48, 32, 32, 0.4765625f, 0.046875f, 0.5078125f, 0.078125f}, // U+0045
+    {528, 48, 32, 32, 0.515625f, 0.046875f, 0.546875f, 0.078125f}, // U+0046
+    {568, 48, 32, 32, 0.5546875f, 0.046875f, 0.5859375f, 0.078125f}, // U+0047
+    {608, 48, 32, 32, 0.59375f, 0.046875f, 0.625f, 0.078125f}, // U+0048
+    {648, 48, 32, 32, 0.6328125f, 0.046875f, 0.6640625f, 0.078125f}, // U+0049
+    {688, 48, 32, 32, 0.671875f, 0.046875f, 0.703125f, 0.078125f}, // U+004A
+    {728, 48, 32, 32, 0.7109375f, 0.046875f, 0.7421875f, 0.078125f}, // U+004B
+    {768, 48, 32, 32, 0.75f, 0.046875f, 0.78125f, 0.078125f}, // U+004C
+    {808, 48, 32, 32, 0.7890625f, 0.046875f, 0.8203125f, 0.078125f}, // U+004D
+    {848, 48, 32, 32, 0.828125f, 0.046875f, 0.859375f, 0.078125f}, // U+004E
+    {888, 48, 32, 32, 0.8671875f, 0.046875f, 0.8984375f, 0.078125f}, // U+004F
+    {928, 48, 32, 32, 0.90625f, 0.046875f, 0.9375f, 0.078125f}, // U+0050
+    {968, 48, 32, 32, 0.9453125f, 0.046875f, 0.9765625f, 0.078125f}, // U+0051
+    {8, 88, 32, 32, 0.0078125f, 0.0859375f, 0.0390625f, 0.1171875f}, // U+0052
+    {48, 88, 32, 32, 0.046875f, 0.0859375f, 0.078125f, 0.1171875f}, // U+0053
+    {88, 88, 32, 32, 0.0859375f, 0.0859375f, 0.1171875f, 0.1171875f}, // U+0054
+    {128, 88, 32, 32, 0.125f, 0.0859375f, 0.15625f, 0.1171875f}, // U+0055
+    {168, 88, 32, 32, 0.1640625f, 0.0859375f, 0.1953125f, 0.1171875f}, // U+0056
+    {208, 88, 32, 32, 0.203125f, 0.0859375f, 0.234375f, 0.1171875f}, // U+0057
+    {248, 88, 32, 32, 0.2421875f, 0.0859375f, 0.2734375f, 0.1171875f}, // U+0058
+    {288, 88, 32, 32, 0.28125f, 0.0859375f, 0.3125f, 0.1171875f}, // U+0059
+    {328, 88, 32, 32, 0.3203125f, 0.0859375f, 0.3515625f, 0.1171875f}, // U+005A
+    {368, 88, 32, 32, 0.359375f, 0.0859375f, 0.390625f, 0.1171875f}, // U+005B
+    {408, 88, 32, 32, 0.3984375f, 0.0859375f, 0.4296875f, 0.1171875f}, // U+005C
+    {448, 88, 32, 32, 0.4375f, 0.0859375f, 0.46875f, 0.1171875f}, // U+005D
+    {488, 88, 32, 32, 0.4765625f, 0.0859375f, 0.5078125f, 0.1171875f}, // U+005E
+    {528, 88, 32, 32, 0.515625f, 0.0859375f, 0.546875f, 0.1171875f}, // U+005F
+    {568, 88, 32, 32, 0.5546875f, 0.0859375f, 0.5859375f, 0.1171875f}, // U+0060
+    {608, 88, 32, 32, 0.59375f, 0.0859375f, 0.625f, 0.1171875f}, // U+0061
+    {648, 88, 32, 32, 0.6328125f, 0.0859375f, 0.6640625f, 0.1171875f}, // U+0062
+    {688, 88, 32, 32, 0.671875f, 0.0859375f, 0.703125f, 0.1171875f}, // U+0063
+    {728, 88, 32, 32, 0.7109375f, 0.0859375f, 0.7421875f, 0.1171875f}, // U+0064
+    {768, 88, 32, 32, 0.75f, 0.0859375f, 0.78125f, 0.1171875f}, // U+0065
+    {808, 88, 32, 32, 0.7890625f, 0.0859375f, 0.8203125f, 0.1171875f}, // U+0066
+    {848, 88, 32, 32, 0.828125f, 0.0859375f, 0.859375f, 0.1171875f}, // U+0067
+    {888, 88, 32, 32, 0.8671875f, 0.0859375f, 0.8984375f, 0.1171875f}, // U+0068
+    {928, 88, 32, 32, 0.90625f, 0.0859375f, 0.9375f, 0.1171875f}, // U+0069
+    {968, 88, 32, 32, 0.9453125f, 0.0859375f, 0.9765625f, 0.1171875f}, // U+006A
+    {8, 128, 32, 32, 0.0078125f, 0.125f, 0.0390625f, 0.15625f}, // U+006B
+    {48, 128, 32, 32, 0.046875f, 0.125f, 0.078125f, 0.15625f}, // U+006C
+    {88, 128, 32, 32, 0.0859375f, 0.125f, 0.1171875f, 0.15625f}, // U+006D
+    {128, 128, 32, 32, 0.125f, 0.125f, 0.15625f, 0.15625f}, // U+006E
+    {168, 128, 32, 32, 0.1640625f, 0.125f, 0.1953125f, 0.15625f}, // U+006F
+    {208, 128, 32, 32, 0.203125f, 0.125f, 0.234375f, 0.15625f}, // U+0070
+    {248, 128, 32, 32, 0.2421875f, 0.125f, 0.2734375f, 0.15625f}, // U+0071
+    {288, 128, 32, 32, 0.28125f, 0.125f, 0.3125f, 0.15625f}, // U+0072
+    {328, 128, 32, 32, 0.3203125f, 0.125f, 0.3515625f, 0.15625f}, // U+0073
+    {368, 128, 32, 32, 0.359375f, 0.125f, 0.390625f, 0.15625f}, // U+0074
+    {408, 128, 32, 32, 0.3984375f, 0.125f, 0.4296875f, 0.15625f}, // U+0075
+    {448, 128, 32, 32, 0.4375f, 0.125f, 0.46875f, 0.15625f}, // U+0076
+    {488, 128, 32, 32, 0.4765625f, 0.125f, 0.5078125f, 0.15625f}, // U+0077
+    {528, 128, 32, 32, 0.515625f, 0.125f, 0.546875f, 0.15625f}, // U+0078
+    {568, 128, 32, 32, 0.5546875f, 0.125f, 0.5859375f, 0.15625f}, // U+0079
+    {608, 128, 32, 32, 0.59375f, 0.125f, 0.625f, 0.15625f}, // U+007A
+    {648, 128, 32, 32, 0.6328125f, 0.125f, 0.6640625f, 0.15625f}, // U+007B
+    {688, 128, 32, 32, 0.671875f, 0.125f, 0.703125f, 0.15625f}, // U+007C
+    {728, 128, 32, 32, 0.7109375f, 0.125f, 0.7421875f, 0.15625f}, // U+007D
+    {768, 128, 32, 32, 0.75f, 0.125f, 0.78125f, 0.15625f}, // U+007E
+    {808, 128, 32, 32, 0.7890625f, 0.125f, 0.8203125f, 0.15625f}, // U+00A7
+    {848, 128, 32, 32, 0.828125f, 0.125f, 0.859375f, 0.15625f}, // U+00A9
+    {888, 128, 32, 32, 0.8671875f, 0.125f, 0.8984375f, 0.15625f}, // U+00AB
+    {928, 128, 32, 32, 0.90625f, 0.125f, 0.9375f, 0.15625f}, // U+00AC
+    {968, 128, 32, 32, 0.9453125f, 0.125f, 0.9765625f, 0.15625f}, // U+00AE
+    {8, 168, 32, 32, 0.0078125f, 0.1640625f, 0.0390625f, 0.1953125f}, // U+00B0
+    {48, 168, 32, 32, 0.046875f, 0.1640625f, 0.078125f, 0.1953125f}, // U+00B1
+    {88, 168, 32, 32, 0.0859375f, 0.1640625f, 0.1171875f, 0.1953125f}, // U+00B6
+    {128, 168, 32, 32, 0.125f, 0.1640625f, 0.15625f, 0.1953125f}, // U+00B7
+    {168, 168, 32, 32, 0.1640625f, 0.1640625f, 0.1953125f, 0.1953125f}, // U+00BB
+    {208, 168, 32, 32, 0.203125f, 0.1640625f, 0.234375f, 0.1953125f}, // U+00D7
+    {248, 168, 32, 32, 0.2421875f, 0.1640625f, 0.2734375f, 0.1953125f}, // U+00F7
+    {328, 48, 32, 32, 0.3203125f, 0.046875f, 0.3515625f, 0.078125f}, // U+0391
+    {368, 48, 32, 32, 0.359375f, 0.046875f, 0.390625f, 0.078125f}, // U+0392
+    {288, 168, 32, 32, 0.28125f, 0.1640625f, 0.3125f, 0.1953125f}, // U+0393
+    {328, 168, 32, 32, 0.3203125f, 0.1640625f, 0.3515625f, 0.1953125f}, // U+0394
+    {488, 48, 32, 32, 0.4765625f, 0.046875f, 0.5078125f, 0.078125f}, // U+0395
+    {368, 168, 32, 32, 0.359375f, 0.1640625f, 0.390625f, 0.1953125f}, // U+0396
+    {608, 48, 32, 32, 0.59375f, 0.046875f, 0.625f, 0.078125f}, // U+0397
+    {408, 168, 32, 32, 0.3984375f, 0.1640625f, 0.4296875f, 0.1953125f}, // U+0398
+    {648, 48, 32, 32, 0.6328125f, 0.046875f, 0.6640625f, 0.078125f}, // U+0399
+    {728, 48, 32, 32, 0.7109375f, 0.046875f, 0.7421875f, 0.078125f}, // U+039A
+    {448, 168, 32, 32, 0.4375f, 0.1640625f, 0.46875f, 0.1953125f}, // U+039B
+    {808, 48, 32, 32, 0.7890625f, 0.046875f, 0.8203125f, 0.078125f}, // U+039C
+    {848, 48, 32, 32, 0.828125f, 0.046875f, 0.859375f, 0.078125f}, // U+039D
+    {488, 168, 32, 32, 0.4765625f, 0.1640625f, 0.5078125f, 0.1953125f}, // U+039E
+    {888, 48, 32, 32, 0.8671875f, 0.046875f, 0.8984375f, 0.078125f}, // U+039F
+    {528, 168, 32, 32, 0.515625f, 0.1640625f, 0.546875f, 0.1953125f}, // U+03A0
+    {568, 168, 32, 32, 0.5546875f, 0.1640625f, 0.5859375f, 0.1953125f}, // U+03A1
+    {608, 168, 32, 32, 0.59375f, 0.1640625f, 0.625f, 0.1953125f}, // U+03A3
+    {648, 168, 32, 32, 0.6328125f, 0.1640625f, 0.6640625f, 0.1953125f}, // U+03A4
+    {288, 88, 32, 32, 0.28125f, 0.0859375f, 0.3125f, 0.1171875f}, // U+03A5
+    {688, 168, 32, 32, 0.671875f, 0.1640625f, 0.703125f, 0.1953125f}, // U+03A6
+    {248, 88, 32, 32, 0.2421875f, 0.0859375f, 0.2734375f, 0.1171875f}, // U+03A7
+    {728, 168, 32, 32, 0.7109375f, 0.1640625f, 0.7421875f, 0.1953125f}, // U+03A8
+    {768, 168, 32, 32, 0.75f, 0.1640625f, 0.78125f, 0.1953125f}, // U+03A9
+    {808, 168, 32, 32, 0.7890625f, 0.1640625f, 0.8203125f, 0.1953125f}, // U+03B1
+    {848, 168, 32, 32, 0.828125f, 0.1640625f, 0.859375f, 0.1953125f}, // U+03B2
+    {888, 168, 32, 32, 0.8671875f, 0.1640625f, 0.8984375f, 0.1953125f}, // U+03B3
+    {928, 168, 32, 32, 0.90625f, 0.1640625f, 0.9375f, 0.1953125f}, // U+03B4
+    {968, 168, 32, 32, 0.9453125f, 0.1640625f, 0.9765625f, 0.1953125f}, // U+03B5
+    {8, 208, 32, 32, 0.0078125f, 0.203125f, 0.0390625f, 0.234375f}, // U+03B6
+    {48, 208, 32, 32, 0.046875f, 0.203125f, 0.078125f, 0.234375f}, // U+03B7
+    {88, 208, 32, 32, 0.0859375f, 0.203125f, 0.1171875f, 0.234375f}, // U+03B8
+    {128, 208, 32, 32, 0.125f, 0.203125f, 0.15625f, 0.234375f}, // U+03B9
+    {168, 208, 32, 32, 0.1640625f, 0.203125f, 0.1953125f, 0.234375f}, // U+03BA
+    {208, 208, 32, 32, 0.203125f, 0.203125f, 0.234375f, 0.234375f}, // U+03BB
+    {248, 208, 32, 32, 0.2421875f, 0.203125f, 0.2734375f, 0.234375f}, // U+03BC
+    {288, 208, 32, 32, 0.28125f, 0.203125f, 0.3125f, 0.234375f}, // U+03BD
+    {328, 208, 32, 32, 0.3203125f, 0.203125f, 0.3515625f, 0.234375f}, // U+03BE
+    {368, 208, 32, 32, 0.359375f, 0.203125f, 0.390625f, 0.234375f}, // U+03BF
+    {408, 208, 32, 32, 0.3984375f, 0.203125f, 0.4296875f, 0.234375f}, // U+03C0
+    {448, 208, 32, 32, 0.4375f, 0.203125f, 0.46875f, 0.234375f}, // U+03C1
+    {488, 208, 32, 32, 0.4765625f, 0.203125f, 0.5078125f, 0.234375f}, // U+03C2
+    {528, 208, 32, 32, 0.515625f, 0.203125f, 0.546875f, 0.234375f}, // U+03C3
+    {568, 208, 32, 32, 0.5546875f, 0.203125f, 0.5859375f, 0.234375f}, // U+03C4
+    {608, 208, 32, 32, 0.59375f, 0.203125f, 0.625f, 0.234375f}, // U+03C5
+    {648, 208, 32, 32, 0.6328125f, 0.203125f, 0.6640625f, 0.234375f}, // U+03C6
+    {688, 208, 32, 32, 0.671875f, 0.203125f, 0.703125f, 0.234375f}, // U+03C7
+    {728, 208, 32, 32, 0.7109375f, 0.203125f, 0.7421875f, 0.234375f}, // U+03C8
+    {768, 208, 32, 32, 0.75f, 0.203125f, 0.78125f, 0.234375f}, // U+03C9
+    {808, 208, 32, 32, 0.7890625f, 0.203125f, 0.8203125f, 0.234375f}, // U+0401
+    {328, 48, 32, 32, 0.3203125f, 0.046875f, 0.3515625f, 0.078125f}, // U+0410
+    {848, 208, 32, 32, 0.828125f, 0.203125f, 0.859375f, 0.234375f}, // U+0411
+    {368, 48, 32, 32, 0.359375f, 0.046875f, 0.390625f, 0.078125f}, // U+0412
+    {888, 208, 32, 32, 0.8671875f, 0.203125f, 0.8984375f, 0.234375f}, // U+0413
+    {928, 208, 32, 32, 0.90625f, 0.203125f, 0.9375f, 0.234375f}, // U+0414
+    {488, 48, 32, 32, 0.4765625f, 0.046875f, 0.5078125f, 0.078125f}, // U+0415
+    {968, 208, 32, 32, 0.9453125f, 0.203125f, 0.9765625f, 0.234375f}, // U+0416
+    {8, 248, 32, 32, 0.0078125f, 0.2421875f, 0.0390625f, 0.2734375f}, // U+0417
+    {48, 248, 32, 32, 0.046875f, 0.2421875f, 0.078125f, 0.2734375f}, // U+0418
+    {88, 248, 32, 32, 0.0859375f, 0.2421875f, 0.1171875f, 0.2734375f}, // U+0419
+    {728, 48, 32, 32, 0.7109375f, 0.046875f, 0.7421875f, 0.078125f}, // U+041A
+    {128, 248, 32, 32, 0.125f, 0.2421875f, 0.15625f, 0.2734375f}, // U+041B
+    {808, 48, 32, 32, 0.7890625f, 0.046875f, 0.8203125f, 0.078125f}, // U+041C
+    {608, 48, 32, 32, 0.59375f, 0.046875f, 0.625f, 0.078125f}, // U+041D
+    {888, 48, 32, 32, 0.8671875f, 0.046875f, 0.8984375f, 0.078125f}, // U+041E
+    {528, 168, 32, 32, 0.515625f, 0.1640625f, 0.546875f, 0.1953125f}, // U+041F
+    {928, 48, 32, 32, 0.90625f, 0.046875f, 0.9375f, 0.078125f}, // U+0420
+    {408, 48, 32, 32, 0.3984375f, 0.046875f, 0.4296875f, 0.078125f}, // U+0421
+    {88, 88, 32, 32, 0.0859375f, 0.0859375f, 0.1171875f, 0.1171875f}, // U+0422
+    {168, 248, 32, 32, 0.1640625f, 0.2421875f, 0.1953125f, 0.2734375f}, // U+0423
+    {688, 168, 32, 32, 0.671875f, 0.1640625f, 0.703125f, 0.1953125f}, // U+0424
+    {248, 88, 32, 32, 0.2421875f, 0.0859375f, 0.2734375f, 0.1171875f}, // U+0425
+    {208, 248, 32, 32, 0.203125f, 0.2421875f, 0.234375f, 0.2734375f}, // U+0426
+    {248, 248, 32, 32, 0.2421875f, 0.2421875f, 0.2734375f, 0.2734375f}, // U+0427
+    {288, 248, 32, 32, 0.28125f, 0.2421875f, 0.3125f, 0.2734375f}, // U+0428
+    {328, 248, 32, 32, 0.3203125f, 0.2421875f, 0.3515625f, 0.2734375f}, // U+0429
+    {368, 248, 32, 32, 0.359375f, 0.2421875f, 0.390625f, 0.2734375f}, // U+042A
+    {408, 248, 32, 32, 0.3984375f, 0.2421875f, 0.4296875f, 0.2734375f}, // U+042B
+    {448, 248, 32, 32, 0.4375f, 0.2421875f, 0.46875f, 0.2734375f}, // U+042C
+    {488, 248, 32, 32, 0.4765625f, 0.2421875f, 0.5078125f, 0.2734375f}, // U+042D
+    {528, 248, 32, 32, 0.515625f, 0.2421875f, 0.546875f, 0.2734375f}, // U+042E
+    {568, 248, 32, 32, 0.5546875f, 0.2421875f, 0.5859375f, 0.2734375f}, // U+042F
+    {608, 88, 32, 32, 0.59375f, 0.0859375f, 0.625f, 0.1171875f}, // U+0430
+    {608, 248, 32, 32, 0.59375f, 0.2421875f, 0.625f, 0.2734375f}, // U+0431
+    {648, 248, 32, 32, 0.6328125f, 0.2421875f, 0.6640625f, 0.2734375f}, // U+0432
+    {688, 248, 32, 32, 0.671875f, 0.2421875f, 0.703125f, 0.2734375f}, // U+0433
+    {728, 248, 32, 32, 0.7109375f, 0.2421875f, 0.7421875f, 0.2734375f}, // U+0434
+    {768, 88, 32, 32, 0.75f, 0.0859375f, 0.78125f, 0.1171875f}, // U+0435
+    {768, 248, 32, 32, 0.75f, 0.2421875f, 0.78125f, 0.2734375f}, // U+0436
+    {808, 248, 32, 32, 0.7890625f, 0.2421875f, 0.8203125f, 0.2734375f}, // U+0437
+    {848, 248, 32, 32, 0.828125f, 0.2421875f, 0.859375f, 0.2734375f}, // U+0438
+    {888, 248, 32, 32, 0.8671875f, 0.2421875f, 0.8984375f, 0.2734375f}, // U+0439
+    {168, 208, 32, 32, 0.1640625f, 0.203125f, 0.1953125f, 0.234375f}, // U+043A
+    {928, 248, 32, 32, 0.90625f, 0.2421875f, 0.9375f, 0.2734375f}, // U+043B
+    {968, 248, 32, 32, 0.9453125f, 0.2421875f, 0.9765625f, 0.2734375f}, // U+043C
+    {8, 288, 32, 32, 0.0078125f, 0.28125f, 0.0390625f, 0.3125f}, // U+043D
+    {168, 128, 32, 32, 0.1640625f, 0.125f, 0.1953125f, 0.15625f}, // U+043E
+    {48, 288, 32, 32, 0.046875f, 0.28125f, 0.078125f, 0.3125f}, // U+043F
+    {208, 128, 32, 32, 0.203125f, 0.125f, 0.234375f, 0.15625f}, // U+0440
+    {688, 88, 32, 32, 0.671875f, 0.0859375f, 0.703125f, 0.1171875f}, // U+0441
+    {88, 288, 32, 32, 0.0859375f, 0.28125f, 0.1171875f, 0.3125f}, // U+0442
+    {568, 128, 32, 32, 0.5546875f, 0.125f, 0.5859375f, 0.15625f}, // U+0443
+    {128, 288, 32, 32, 0.125f, 0.28125f, 0.15625f, 0.3125f}, // U+0444
+    {528, 128, 32, 32, 0.515625f, 0.125f, 0.546875f, 0.15625f}, // U+0445
+    {168, 288, 32, 32, 0.1640625f, 0.28125f, 0.1953125f, 0.3125f}, // U+0446
+    {208, 288, 32, 32, 0.203125f, 0.28125f, 0.234375f, 0.3125f}, // U+0447
+    {248, 288, 32, 32, 0.2421875f, 0.28125f, 0.2734375f, 0.3125f}, // U+0448
+    {288, 288, 32, 32, 0.28125f, 0.28125f, 0.3125f, 0.3125f}, // U+0449
+    {328, 288, 32, 32, 0.3203125f, 0.28125f, 0.3515625f, 0.3125f}, // U+044A
+    {368, 288, 32, 32, 0.359375f, 0.28125f, 0.390625f, 0.3125f}, // U+044B
+    {408, 288, 32, 32, 0.3984375f, 0.28125f, 0.4296875f, 0.3125f}, // U+044C
+    {448, 288, 32, 32, 0.4375f, 0.28125f, 0.46875f, 0.3125f}, // U+044D
+    {488, 288, 32, 32, 0.4765625f, 0.28125f, 0.5078125f, 0.3125f}, // U+044E
+    {528, 288, 32, 32, 0.515625f, 0.28125f, 0.546875f, 0.3125f}, // U+044F
+    {568, 288, 32, 32, 0.5546875f, 0.28125f, 0.5859375f, 0.3125f}, // U+0451
+    {608, 288, 32, 32, 0.59375f, 0.28125f, 0.625f, 0.3125f}, // U+2014
+    {648, 288, 32, 32, 0.6328125f, 0.28125f, 0.6640625f, 0.3125f}, // U+2018
+    {688, 288, 32, 32, 0.671875f, 0.28125f, 0.703125f, 0.3125f}, // U+2019
+    {728, 288, 32, 32, 0.7109375f, 0.28125f, 0.7421875f, 0.3125f}, // U+201C
+    {768, 288, 32, 32, 0.75f, 0.28125f, 0.78125f, 0.3125f}, // U+201D
+    {808, 288, 32, 32, 0.7890625f, 0.28125f, 0.8203125f, 0.3125f}, // U+201E
+    {848, 288, 32, 32, 0.828125f, 0.28125f, 0.859375f, 0.3125f}, // U+2022
+    {888, 288, 32, 32, 0.8671875f, 0.28125f, 0.8984375f, 0.3125f}, // U+2023
+    {928, 288, 32, 32, 0.90625f, 0.28125f, 0.9375f, 0.3125f}, // U+2026
+    {968, 288, 32, 32, 0.9453125f, 0.28125f, 0.9765625f, 0.3125f}, // U+2190
+    {8, 328, 32, 32, 0.0078125f, 0.3203125f, 0.0390625f, 0.3515625f}, // U+2191
+    {48, 328, 32, 32, 0.046875f, 0.3203125f, 0.078125f, 0.3515625f}, // U+2192
+    {88, 328, 32, 32, 0.0859375f, 0.3203125f, 0.1171875f, 0.3515625f}, // U+2193
+    {128, 328, 32, 32, 0.125f, 0.3203125f, 0.15625f, 0.3515625f}, // U+2196
+    {168, 328, 32, 32, 0.1640625f, 0.3203125f, 0.1953125f, 0.3515625f}, // U+2197
+    {208, 328, 32, 32, 0.203125f, 0.3203125f, 0.234375f, 0.3515625f}, // U+2198
+    {248, 328, 32, 32, 0.2421875f, 0.3203125f, 0.2734375f, 0.3515625f}, // U+2199
+    {288, 328, 32, 32, 0.28125f, 0.3203125f, 0.3125f, 0.3515625f}, // U+21B0
+    {328, 328, 32, 32, 0.3203125f, 0.3203125f, 0.3515625f, 0.3515625f}, // U+21B1
+    {368, 328, 32, 32, 0.359375f, 0.3203125f, 0.390625f, 0.3515625f}, // U+21B2
+    {408, 328, 32, 32, 0.3984375f, 0.3203125f, 0.4296875f, 0.3515625f}, // U+21B3
+    {448, 328, 32, 32, 0.4375f, 0.3203125f, 0.46875f, 0.3515625f}, // U+21B4
+    {488, 328, 32, 32, 0.4765625f, 0.3203125f, 0.5078125f, 0.3515625f}, // U+2200
+    {528, 328, 32, 32, 0.515625f, 0.3203125f, 0.546875f, 0.3515625f}, // U+2202
+    {568, 328, 32, 32, 0.5546875f, 0.3203125f, 0.5859375f, 0.3515625f}, // U+2203
+    {608, 328, 32, 32, 0.59375f, 0.3203125f, 0.625f, 0.3515625f}, // U+2204
+    {648, 328, 32, 32, 0.6328125f, 0.3203125f, 0.6640625f, 0.3515625f}, // U+2205
+    {688, 328, 32, 32, 0.671875f, 0.3203125f, 0.703125f, 0.3515625f}, // U+2206
+    {728, 328, 32, 32, 0.7109375f, 0.3203125f, 0.7421875f, 0.3515625f}, // U+2207
+    {768, 328, 32, 32, 0.75f, 0.3203125f, 0.78125f, 0.3515625f}, // U+2208
+    {808, 328, 32, 32, 0.7890625f, 0.3203125f, 0.8203125f, 0.3515625f}, // U+2209
+    {848, 328, 32, 32, 0.828125f, 0.3203125f, 0.859375f, 0.3515625f}, // U+220B
+    {888, 328, 32, 32, 0.8671875f, 0.3203125f, 0.8984375f, 0.3515625f}, // U+220C
+    {928, 328, 32, 32, 0.90625f, 0.3203125f, 0.9375f, 0.3515625f}, // U+220E
+    {968, 328, 32, 32, 0.9453125f, 0.3203125f, 0.9765625f, 0.3515625f}, // U+220F
+    {8, 368, 32, 32, 0.0078125f, 0.359375f, 0.0390625f, 0.390625f}, // U+2210
+    {48, 368, 32, 32, 0.046875f, 0.359375f, 0.078125f, 0.390625f}, // U+2211
+    {88, 368, 32, 32, 0.0859375f, 0.359375f, 0.1171875f, 0.390625f}, // U+2212
+    {128, 368, 32, 32, 0.125f, 0.359375f, 0.15625f, 0.390625f}, // U+2217
+    {168, 368, 32, 32, 0.1640625f, 0.359375f, 0.1953125f, 0.390625f}, // U+2218
+    {208, 368, 32, 32, 0.203125f, 0.359375f, 0.234375f, 0.390625f}, // U+2219
+    {248, 368, 32, 32, 0.2421875f, 0.359375f, 0.2734375f, 0.390625f}, // U+221A
+    {288, 368, 32, 32, 0.28125f, 0.359375f, 0.3125f, 0.390625f}, // U+221E
+    {328, 368, 32, 32, 0.3203125f, 0.359375f, 0.3515625f, 0.390625f}, // U+221F
+    {368, 368, 32, 32, 0.359375f, 0.359375f, 0.390625f, 0.390625f}, // U+2220
+    {688, 128, 32, 32, 0.671875f, 0.125f, 0.703125f, 0.15625f}, // U+2223
+    {408, 368, 32, 32, 0.3984375f, 0.359375f, 0.4296875f, 0.390625f}, // U+2224
+    {448, 368, 32, 32, 0.4375f, 0.359375f, 0.46875f, 0.390625f}, // U+2225
+    {488, 368, 32, 32, 0.4765625f, 0.359375f, 0.5078125f, 0.390625f}, // U+2226
+    {528, 368, 32, 32, 0.515625f, 0.359375f, 0.546875f, 0.390625f}, // U+2227
+    {568, 368, 32, 32, 0.5546875f, 0.359375f, 0.5859375f, 0.390625f}, // U+2228
+    {608, 368, 32, 32, 0.59375f, 0.359375f, 0.625f, 0.390625f}, // U+2229
+    {648, 368, 32, 32, 0.6328125f, 0.359375f, 0.6640625f, 0.390625f}, // U+222A
+    {688, 368, 32, 32, 0.671875f, 0.359375f, 0.703125f, 0.390625f}, // U+222B
+    {728, 368, 32, 32, 0.7109375f, 0.359375f, 0.7421875f, 0.390625f}, // U+2243
+    {768, 368, 32, 32, 0.75f, 0.359375f, 0.78125f, 0.390625f}, // U+2245
+    {808, 368, 32, 32, 0.7890625f, 0.359375f, 0.8203125f, 0.390625f}, // U+2248
+    {848, 368, 32, 32, 0.828125f, 0.359375f, 0.859375f, 0.390625f}, // U+2260
+    {888, 368, 32, 32, 0.8671875f, 0.359375f, 0.8984375f, 0.390625f}, // U+2261
+    {928, 368, 32, 32, 0.90625f, 0.359375f, 0.9375f, 0.390625f}, // U+2262
+    {968, 368, 32, 32, 0.9453125f, 0.359375f, 0.9765625f, 0.390625f}, // U+2264
+    {8, 408, 32, 32, 0.0078125f, 0.3984375f, 0.0390625f, 0.4296875f}, // U+2265
+    {48, 408, 32, 32, 0.046875f, 0.3984375f, 0.078125f, 0.4296875f}, // U+226A
+    {88, 408, 32, 32, 0.0859375f, 0.3984375f, 0.1171875f, 0.4296875f}, // U+226B
+    {128, 408, 32, 32, 0.125f, 0.3984375f, 0.15625f, 0.4296875f}, // U+2282
+    {168, 408, 32, 32, 0.1640625f, 0.3984375f, 0.1953125f, 0.4296875f}, // U+2283
+    {208, 408, 32, 32, 0.203125f, 0.3984375f, 0.234375f, 0.4296875f}, // U+2284
+    {248, 408, 32, 32, 0.2421875f, 0.3984375f, 0.2734375f, 0.4296875f}, // U+2285
+    {288, 408, 32, 32, 0.28125f, 0.3984375f, 0.3125f, 0.4296875f}, // U+2286
+    {328, 408, 32, 32, 0.3203125f, 0.3984375f, 0.3515625f, 0.4296875f}, // U+2287
+    {368, 408, 32, 32, 0.359375f, 0.3984375f, 0.390625f, 0.4296875f}, // U+2288
+    {408, 408, 32, 32, 0.3984375f, 0.3984375f, 0.4296875f, 0.4296875f}, // U+2289
+    {448, 408, 32, 32, 0.4375f, 0.3984375f, 0.46875f, 0.4296875f}, // U+2295
+    {488, 408, 32, 32, 0.4765625f, 0.3984375f, 0.5078125f, 0.4296875f}, // U+2296
+    {528, 408, 32, 32, 0.515625f, 0.3984375f, 0.546875f, 0.4296875f}, // U+2297
+    {568, 408, 32, 32, 0.5546875f, 0.3984375f, 0.5859375f, 0.4296875f}, // U+2298
+    {608, 408, 32, 32, 0.59375f, 0.3984375f, 0.625f, 0.4296875f}, // U+2299
+    {648, 408, 32, 32, 0.6328125f, 0.3984375f, 0.6640625f, 0.4296875f}, // U+229A
+    {688, 408, 32, 32, 0.671875f, 0.3984375f, 0.703125f, 0.4296875f}, // U+229C
+    {728, 408, 32, 32, 0.7109375f, 0.3984375f, 0.7421875f, 0.4296875f}, // U+22A5
+    {768, 408, 32, 32, 0.75f, 0.3984375f, 0.78125f, 0.4296875f}, // U+22B9
+    {808, 408, 32, 32, 0.7890625f, 0.3984375f, 0.8203125f, 0.4296875f}, // U+22BB
+    {848, 408, 32, 32, 0.828125f, 0.3984375f, 0.859375f, 0.4296875f}, // U+22BC
+    {888, 408, 32, 32, 0.8671875f, 0.3984375f, 0.8984375f, 0.4296875f}, // U+22BD
+    {928, 408, 32, 32, 0.90625f, 0.3984375f, 0.9375f, 0.4296875f}, // U+22BF
+    {968, 408, 32, 32, 0.9453125f, 0.3984375f, 0.9765625f, 0.4296875f}, // U+22C0
+    {8, 448, 32, 32, 0.0078125f, 0.4375f, 0.0390625f, 0.46875f}, // U+22C1
+    {48, 448, 32, 32, 0.046875f, 0.4375f, 0.078125f, 0.46875f}, // U+22C2
+    {88, 448, 32, 32, 0.0859375f, 0.4375f, 0.1171875f, 0.46875f}, // U+22C3
+    {128, 448, 32, 32, 0.125f, 0.4375f, 0.15625f, 0.46875f}, // U+22C4
+    {168, 448, 32, 32, 0.1640625f, 0.4375f, 0.1953125f, 0.46875f}, // U+22C5
+    {208, 448, 32, 32, 0.203125f, 0.4375f, 0.234375f, 0.46875f}, // U+22C6
+    {248, 448, 32, 32, 0.2421875f, 0.4375f, 0.2734375f, 0.46875f}, // U+22EE
+    {288, 448, 32, 32, 0.28125f, 0.4375f, 0.3125f, 0.46875f}, // U+22EF
+    {328, 448, 32, 32, 0.3203125f, 0.4375f, 0.3515625f, 0.46875f}, // U+22F0
+    {368, 448, 32, 32, 0.359375f, 0.4375f, 0.390625f, 0.46875f}, // U+22F1
+    {408, 448, 32, 32, 0.3984375f, 0.4375f, 0.4296875f, 0.46875f}, // U+2308
+    {448, 448, 32, 32, 0.4375f, 0.4375f, 0.46875f, 0.46875f}, // U+2309
+    {488, 448, 32, 32, 0.4765625f, 0.4375f, 0.5078125f, 0.46875f}, // U+230A
+    {528, 448, 32, 32, 0.515625f, 0.4375f, 0.546875f, 0.46875f}, // U+230B
+    {568, 448, 32, 32, 0.5546875f, 0.4375f, 0.5859375f, 0.46875f}, // U+231B
+    {608, 448, 32, 32, 0.59375f, 0.4375f, 0.625f, 0.46875f}, // U+23E9
+    {648, 448, 32, 32, 0.6328125f, 0.4375f, 0.6640625f, 0.46875f}, // U+23EA
+    {688, 448, 32, 32, 0.671875f, 0.4375f, 0.703125f, 0.46875f}, // U+23EB
+    {728, 448, 32, 32, 0.7109375f, 0.4375f, 0.7421875f, 0.46875f}, // U+23EC
+    {768, 448, 32, 32, 0.75f, 0.4375f, 0.78125f, 0.46875f}, // U+23ED
+    {808, 448, 32, 32, 0.7890625f, 0.4375f, 0.8203125f, 0.46875f}, // U+23EE
+    {848, 448, 32, 32, 0.828125f, 0.4375f, 0.859375f, 0.46875f}, // U+23EF
+    {888, 448, 32, 32, 0.8671875f, 0.4375f, 0.8984375f, 0.46875f}, // U+23F0
+    {928, 448, 32, 32, 0.90625f, 0.4375f, 0.9375f, 0.46875f}, // U+23F4
+    {888, 288, 32, 32, 0.8671875f, 0.28125f, 0.8984375f, 0.3125f}, // U+23F5
+    {968, 448, 32, 32, 0.9453125f, 0.4375f, 0.9765625f, 0.46875f}, // U+23F6
+    {8, 488, 32, 32, 0.0078125f, 0.4765625f, 0.0390625f, 0.5078125f}, // U+23F7
+    {48, 488, 32, 32, 0.046875f, 0.4765625f, 0.078125f, 0.5078125f}, // U+23F8
+    {88, 488, 32, 32, 0.0859375f, 0.4765625f, 0.1171875f, 0.5078125f}, // U+23F9
+    {128, 488, 32, 32, 0.125f, 0.4765625f, 0.15625f, 0.5078125f}, // U+23FA
+    {168, 488, 32, 32, 0.1640625f, 0.4765625f, 0.1953125f, 0.5078125f}, // U+23FB
+    {208, 488, 32, 32, 0.203125f, 0.4765625f, 0.234375f, 0.5078125f}, // U+23FE
+    {248, 488, 32, 32, 0.2421875f, 0.4765625f, 0.2734375f, 0.5078125f}, // U+FFFD
+};
+
+static uint16_t const font8x8_sdf_direct_glyph_indices[1106] = {
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 14, 15, 16,
+    17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32,
+    33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48,
+    49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64,
+    65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+    81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 96, 341, 97, 341, 98, 99, 341, 100, 341,
+    101, 102, 341, 341, 341, 341, 103, 104, 341, 341, 341, 105, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 106, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 107, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122,
+    123, 124, 341, 125, 126, 127, 128, 129, 130, 131, 341, 341, 341, 341, 341, 341,
+    341, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146,
+    147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 157, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    158, 159, 160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173,
+    174, 175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189,
+    190, 191, 192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205,
+    206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221,
+    341, 222,
+};
+
+static Font8x8Range const font8x8_sdf_ranges[] = {
+    {0x2014, 1, 223},
+    {0x2018, 2, 224},
+    {0x201c, 3, 226},
+    {0x2022, 2, 229},
+    {0x2026, 1, 231},
+    {0x2190, 4, 232},
+    {0x2196, 4, 236},
+    {0x21b0, 5, 240},
+    {0x2200, 1, 245},
+    {0x2202, 8, 246},
+    {0x220b, 2, 254},
+    {0x220e, 5, 256},
+    {0x2217, 4, 261},
+    {0x221e, 3, 265},
+    {0x2223, 9, 268},
+    {0x2243, 1, 277},
+    {0x2245, 1, 278},
+    {0x2248, 1, 279},
+    {0x2260, 3, 280},
+    {0x2264, 2, 283},
+    {0x226a, 2, 285},
+    {0x2282, 8, 287},
+    {0x2295, 6, 295},
+    {0x229c, 1, 301},
+    {0x22a5, 1, 302},
+    {0x22b9, 1, 303},
+    {0x22bb, 3, 304},
+    {0x22bf, 8, 307},
+    {0x22ee, 4, 315},
+    {0x2308, 4, 319},
+    {0x231b, 1, 323},
+    {0x23e9, 8, 324},
+    {0x23f4, 8, 332},
+    {0x23fe, 1, 340},
+    {0xfffd, 1, 341},
+};
+
+static Font8x8Index const font8x8_sdf_index = {
+    .direct_glyph_indices = font8x8_sdf_direct_glyph_indices,
+    .direct_count = 1106,
+    .ranges = font8x8_sdf_ranges,
+    .range_count = 35,
+    .fallback_glyph_index = 341,
+};
@@ -0,0 +1,330 @@
+// Runtime part of the font: the types which are referenced by the generated files and the functions
+// to work with them. The generated file includes this header, so it has to be on the include path.
+// Define FONT8X8_NO_SIMD to get the scalar code only.
+
+#ifndef FONT8X8_H
+#define FONT8X8_H
+
+#include <stdbool.h>    // bool, true, false
+#include <assert.h>     // assert
+#include <string.h>     // memcpy
+
+// Redefinition of typedefs is a C11 feature.
+// This is the official™ guard, which is used across different headers to protect u8 and friends.
+// (Or just add a #define before including this header, if you already have short names defined.)
+#ifndef SHORT_NAMES_FOR_PRIMITIVE_TYPES_WERE_DEFINED
+    #define SHORT_NAMES_FOR_PRIMITIVE_TYPES_WERE_DEFINED
+
+    #include <stdint.h>
+    #include <stddef.h>
+
+    typedef uint8_t u8;
+    typedef int8_t i8;
+    typedef uint16_t u16;
+    typedef int16_t i16;
+    typedef uint32_t u32;
+    typedef int32_t i32;
+    typedef uint64_t u64;
+    typedef int64_t i64;
+
+    typedef uintptr_t uptr;
+    typedef size_t usize;
+    typedef ptrdiff_t isize;
+
+    typedef float f32;
+    typedef double f64;
+#endif
+
+#if !defined(FONT8X8_NO_SIMD)
+    #if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+        #define FONT8X8_SSE2
+        #include <emmintrin.h>
+    #elif defined(__ARM_NEON) || defined(_M_ARM64)
+        #define FONT8X8_NEON
+        #include <arm_neon.h>
+    #endif
+#endif
+
+#ifndef UNREACHABLE
+#if defined(__GCC__) || defined(__clang__)
+    #define UNREACHABLE() __builtin_unreachable()
+#elif defined(_MSC_VER)
+    #define UNREACHABLE() __assume(0)
+#else
+    #define UNREACHABLE() assert(0)
+#endif
+#endif
+
+typedef struct {
+    u8 *data;
+    isize size;
+} StringView;
+
+// 1 byte:  0b00000000 .. 0b01111111 = 0x00 .. 0x7f
+//
+// (Codes from 0x20 to 0x7f are covered by 1 byte case, so 0xc0 or 0xc1 as first byte is invalid.)
+// 2 bytes: 0b11000010 .. 0b11011111 = 0xc2 .. 0xdf
+//
+// 3 bytes: 0b11100000 .. 0b11101111 = 0xe0 .. 0xef
+//
+// (Codes greater than 0x10ffff are invalid.)
+// 4 bytes: 0b11110000 .. 0b11110100 = 0xf0 .. 0xf4
+static u8 const utf8_char_size[] = {
+//  0  1  2  3  4  5  6  7  8  9  A  B  C  D  E  F
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, // 0
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, // 1
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, // 2
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, // 3
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, // 4
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, // 5
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, // 6
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, // 7
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // 8
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // 9
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // A
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // B
+    0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, // C
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, // D
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, // E
+    4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // F
+};
+
+// Unsafe function: passing invalid UTF-8 here will cause all sorts of UB.
+static inline StringView utf8_chop_char(StringView *string, u32 *char_code) {
+    isize char_size = utf8_char_size[string->data[0]];
+
+    switch (char_size) {
+    case 1: {
+        *char_code =
+            (u32)(string->data[0]);
+    } break;
+
+    case 2: {
+        *char_code =
+            (u32)(string->data[0] & 0x1f) << 6 |
+            (u32)(string->data[1] & 0x3f);
+    } break;
+
+    case 3: {
+        *char_code =
+            (u32)(string->data[0] & 0x0f) << 12 |
+            (u32)(string->data[1] & 0x3f) << 6 |
+            (u32)(string->data[2] & 0x3f);
+    } break;
+
+    case 4: {
+        *char_code =
+            (u32)(string->data[0] & 0x07) << 18 |
+            (u32)(string->data[1] & 0x3f) << 12 |
+            (u32)(string->data[2] & 0x3f) << 6 |
+            (u32)(string->data[3] & 0x3f);
+    } break;
+
+    default: {
+        UNREACHABLE();
+    } break;
+    }
+
+    StringView result = {string->data, char_size};
+    string->data += char_size;
+    string->size -= char_size;
+    return result;
+}
+
+// The chars which have no glyph in the font image. They are also the line break opportunities.
+static inline bool char_is_space(u32 char_code) {
+    return
+        char_code == 0x0020 ||  // Space
+        char_code == 0x0009 ||  // Character Tabulation
+        char_code == 0x000a ||  // End of Line
+        char_code == 0x000c ||  // Form Feed
+        char_code == 0x000d;    // Carriage Return
+}
+
+// Size of the packed glyphs (see the packed C array exporter), each row is one byte.
+#define FONT8X8_GLYPH_WIDTH 8
+#define FONT8X8_GLYPH_HEIGHT 8
+
+// A run of consecutive char codes, which are mapped to consecutive glyph indices.
+typedef struct {
+    u32 first_char_code;
+    u16 char_count;
+    u16 first_glyph_index;
+} Font8x8Range;
+
+// Maps char codes to glyph indices (positions in the sorted glyph arrays of the generated file).
+// Char codes below direct_count are looked up directly, the rest of them are binary searched in
+// the ranges. Missing char codes are mapped to the fallback glyph (U+FFFD, if the font has it).
+typedef struct {
+    u16 const *direct_glyph_indices;
+    u32 direct_count;
+    Font8x8Range const *ranges;
+    u16 range_count;
+    u16 fallback_glyph_index;
+} Font8x8Index;
+
+static inline u16 font8x8_glyph_index(Font8x8Index const *index, u32 char_code) {
+    if (char_code < index->direct_count) {
+        return index->direct_glyph_indices[char_code];
+    }
+
+    isize low = 0;
+    isize high = index->range_count;
+    while (low < high) {
+        isize middle = low + (high - low) / 2;
+        Font8x8Range const *range = &index->ranges[middle];
+
+        if (char_code < range->first_char_code) {
+            high = middle;
+        } else if (char_code - range->first_char_code >= range->char_count) {
+            low = middle + 1;
+        } else {
+            return (u16)(range->first_glyph_index + (char_code - range->first_char_code));
+        }
+    }
+
+    return index->fallback_glyph_index;
+}
+
+// Position of a glyph within the atlas texture (see the atlas exporter) in pixels and in texture
+// coordinates.
+typedef struct {
+    u16 x;
+    u16 y;
+    u16 width;
+    u16 height;
+    f32 u0;
+    f32 v0;
+    f32 u1;
+    f32 v1;
+} Font8x8AtlasRect;
+
+// Packed glyphs (see the packed C array exporter) along with their index. Glyphs which look the same
+// share a bitmap, so the glyph index from the index goes through glyph_bitmap_indices.
+typedef struct {
+    u8 const (*bitmap_rows)[FONT8X8_GLYPH_HEIGHT];
+    isize bitmap_count;
+    u16 const *glyph_bitmap_indices;
+    isize glyph_count;
+    Font8x8Index const *index;
+} Font8x8;
+
+static inline u8 const *font8x8_glyph_rows(Font8x8 const *font, u16 glyph_index) {
+    assert(glyph_index < font->glyph_count);
+    return font->bitmap_rows[font->glyph_bitmap_indices[glyph_index]];
+}
+
+typedef struct {
+    // Bytes consumed from the string.
+    isize byte_count;
+    // Chars written into the output buffer.
+    isize char_count;
+} Font8x8DecodeResult;
+
+// Returns true, if none of the 16 bytes have the high bit set.
+static inline bool font8x8_block_is_ascii(u8 const *bytes) {
+#if defined(FONT8X8_SSE2)
+    return _mm_movemask_epi8(_mm_loadu_si128((__m128i const *)bytes)) == 0;
+#elif defined(FONT8X8_NEON)
+    return vmaxvq_u8(vld1q_u8(bytes)) < 0x80;
+#else
+    u64 words[2];
+    memcpy(words, bytes, sizeof(words));
+    return ((words[0] | words[1]) & 0x8080808080808080) == 0;
+#endif
+}
+
+// Decodes UTF-8 (which has to be valid, see utf8_validate) into char codes until either the string or
+// the output buffer runs out. A char cut off at the end of the string is left unconsumed, so a stream
+// can be decoded in chunks by passing the rest of the bytes along with the next chunk.
+static inline Font8x8DecodeResult utf8_decode(StringView string, u32 *char_codes, isize capacity) {
+    u8 const *string_begin = string.data;
+    isize char_count = 0;
+
+    while (string.size > 0 && char_count < capacity) {
+        // Runs of ASCII are widened 16 bytes at a time.
+        if (string.size >= 16 && capacity - char_count >= 16 && font8x8_block_is_ascii(string.data)) {
+        #if defined(FONT8X8_SSE2)
+            __m128i const zero = _mm_setzero_si128();
+            __m128i bytes = _mm_loadu_si128((__m128i const *)string.data);
+            __m128i words_low = _mm_unpacklo_epi8(bytes, zero);
+            __m128i words_high = _mm_unpackhi_epi8(bytes, zero);
+
+            __m128i *output = (__m128i *)(char_codes + char_count);
+            _mm_storeu_si128(output + 0, _mm_unpacklo_epi16(words_low, zero));
+            _mm_storeu_si128(output + 1, _mm_unpackhi_epi16(words_low, zero));
+            _mm_storeu_si128(output + 2, _mm_unpacklo_epi16(words_high, zero));
+            _mm_storeu_si128(output + 3, _mm_unpackhi_epi16(words_high, zero));
+        #elif defined(FONT8X8_NEON)
+            uint8x16_t bytes = vld1q_u8(string.data);
+            uint16x8_t words_low = vmovl_u8(vget_low_u8(bytes));
+            uint16x8_t words_high = vmovl_u8(vget_high_u8(bytes));
+
+            u32 *output = char_codes + char_count;
+            vst1q_u32(output + 0, vmovl_u16(vget_low_u16(words_low)));
+            vst1q_u32(output + 4, vmovl_u16(vget_high_u16(words_low)));
+            vst1q_u32(output + 8, vmovl_u16(vget_low_u16(words_high)));
+            vst1q_u32(output + 12, vmovl_u16(vget_high_u16(words_high)));
+        #else
+            for (isize i = 0; i < 16; i += 1) {
+                char_codes[char_count + i] = string.data[i];
+            }
+        #endif
+
+            string.data += 16;
+            string.size -= 16;
+            char_count += 16;
+            continue;
+        }
+
+        if (utf8_char_size[string.data[0]] > string.size) {
+            break;
+        }
+        utf8_chop_char(&string, &char_codes[char_count]);
+        char_count += 1;
+    }
+
+    return (Font8x8DecodeResult){string.data - string_begin, char_count};
+}
+
+// Same as utf8_decode, but the chars are looked up in the index right away.
+static inline Font8x8DecodeResult font8x8_decode_glyph_indices(
+    Font8x8Index const *index,
+    StringView string,
+    u16 *glyph_indices,
+    isize capacity
+) {
+    u8 const *string_begin = string.data;
+    isize char_count = 0;
+    bool ascii_is_direct = index->direct_count >= 0x80;
+
+    while (string.size > 0 && char_count < capacity) {
+        if (
+            ascii_is_direct &&
+            string.size >= 16 &&
+            capacity - char_count >= 16 &&
+            font8x8_block_is_ascii(string.data)
+        ) {
+            for (isize i = 0; i < 16; i += 1) {
+                glyph_indices[char_count + i] = index->direct_glyph_indices[string.data[i]];
+            }
+
+            string.data += 16;
+            string.size -= 16;
+            char_count += 16;
+            continue;
+        }
+
+        if (utf8_char_size[string.data[0]] > string.size) {
+            break;
+        }
+        u32 char_code;
+        utf8_chop_char(&string, &char_code);
+        glyph_indices[char_count] = font8x8_glyph_index(index, char_code);
+        char_count += 1;
+    }
+
+    return (Font8x8DecodeResult){string.data - string_begin, char_count};
+}
+
+#endif // FONT8X8_H
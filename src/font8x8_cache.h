@@ -0,0 +1,381 @@
+// Cache of rendered text runs on top of font8x8_draw_string, for the labels which are drawn over and
+// over with the same look. A run is keyed on the string, the font, the scale, the colors and the pixel
+// format, and a hit copies the rendered rows into the surface instead of blitting every glyph.
+//
+// The cache lives in a single block of memory given by the caller: a table of entries followed by the
+// storage for the strings and the pixels, whose size is the byte budget. When a new run doesn't fit,
+// the least recently used runs are evicted, and the storage is compacted if the free space is scattered.
+// Entries are found with a linear scan over their hashes, which is meant for tens to hundreds of runs.
+
+#ifndef FONT8X8_CACHE_H
+#define FONT8X8_CACHE_H
+
+#include <stdbool.h>    // bool, true, false
+#include <string.h>     // memcpy, memmove, memcmp, memset
+
+#include "font8x8.h"
+#include "font8x8_draw.h"
+
+#define FONT8X8_CACHE_NO_ENTRY (-1)
+
+typedef struct {
+    u64 hash;
+    Font8x8 const *font;
+    isize string_size;
+    i32 scale;
+    u32 foreground;
+    u32 background;
+    Font8x8Format format;
+
+    // The string, the widths of its lines in pixels and then the pixels, all in the storage.
+    isize data_offset;
+    isize data_size;
+    i32 line_count;
+    i32 width;
+    i32 height;
+
+    // Neighbours in the recency list, FONT8X8_CACHE_NO_ENTRY at its ends.
+    i32 newer_entry_index;
+    i32 older_entry_index;
+    bool is_used;
+} Font8x8CacheEntry;
+
+typedef struct {
+    Font8x8CacheEntry *entries;
+    i32 entry_capacity;
+    i32 entry_count;
+    i32 newest_entry_index;
+    i32 oldest_entry_index;
+
+    u8 *storage;
+    isize storage_size;
+    // Everything below the top is either used by the entries or left by evicted ones.
+    isize storage_top;
+    isize storage_used;
+
+    u64 hit_count;
+    u64 miss_count;
+    u64 eviction_count;
+    // Runs which are bigger than the whole storage, they are drawn without the cache.
+    u64 bypass_count;
+} Font8x8RenderCache;
+
+// Splits the memory (which has to be 8 byte aligned) into entry_capacity entries and the storage, so
+// the memory has to be larger than the entry table. Returns false, if it isn't.
+static inline bool font8x8_cache_init(
+    Font8x8RenderCache *cache,
+    void *memory,
+    isize memory_size,
+    i32 entry_capacity
+) {
+    assert((uptr)memory % 8 == 0);
+
+    isize entries_size = entry_capacity * (isize)sizeof(Font8x8CacheEntry);
+    entries_size = (entries_size + 7) & ~(isize)7;
+    if (entry_capacity <= 0 || memory_size <= entries_size) {
+        return false;
+    }
+
+    *cache = (Font8x8RenderCache){
+        .entries = memory,
+        .entry_capacity = entry_capacity,
+        .newest_entry_index = FONT8X8_CACHE_NO_ENTRY,
+        .oldest_entry_index = FONT8X8_CACHE_NO_ENTRY,
+        .storage = (u8 *)memory + entries_size,
+        .storage_size = memory_size - entries_size,
+    };
+    memset(cache->entries, 0, (size_t)entries_size);
+    return true;
+}
+
+// Drops all the runs, for example after the font was changed. The counters are kept.
+static inline void font8x8_cache_clear(Font8x8RenderCache *cache) {
+    memset(cache->entries, 0, (size_t)cache->entry_capacity * sizeof(Font8x8CacheEntry));
+    cache->entry_count = 0;
+    cache->newest_entry_index = FONT8X8_CACHE_NO_ENTRY;
+    cache->oldest_entry_index = FONT8X8_CACHE_NO_ENTRY;
+    cache->storage_top = 0;
+    cache->storage_used = 0;
+}
+
+static inline u64 font8x8_cache_hash(
+    Font8x8 const *font,
+    StringView string,
+    i32 scale,
+    u32 foreground,
+    u32 background,
+    Font8x8Format format
+) {
+    // FNV-1a over the string, then the rest of the key is mixed in.
+    u64 hash = 0xcbf29ce484222325;
+    for (isize i = 0; i < string.size; i += 1) {
+        hash = (hash ^ string.data[i]) * 0x00000100000001b3;
+    }
+    u64 const key_words[4] = {
+        (u64)(uptr)font,
+        (u64)(u32)scale << 32 | (u32)format,
+        foreground,
+        background,
+    };
+    for (isize i = 0; i < 4; i += 1) {
+        hash = (hash ^ key_words[i]) * 0x9e3779b97f4a7c15;
+        hash ^= hash >> 29;
+    }
+    return hash;
+}
+
+static inline void font8x8_cache_unlink(Font8x8RenderCache *cache, i32 entry_index) {
+    Font8x8CacheEntry *entry = &cache->entries[entry_index];
+
+    if (entry->newer_entry_index != FONT8X8_CACHE_NO_ENTRY) {
+        cache->entries[entry->newer_entry_index].older_entry_index = entry->older_entry_index;
+    } else {
+        cache->newest_entry_index = entry->older_entry_index;
+    }
+    if (entry->older_entry_index != FONT8X8_CACHE_NO_ENTRY) {
+        cache->entries[entry->older_entry_index].newer_entry_index = entry->newer_entry_index;
+    } else {
+        cache->oldest_entry_index = entry->newer_entry_index;
+    }
+}
+
+static inline void font8x8_cache_link_as_newest(Font8x8RenderCache *cache, i32 entry_index) {
+    Font8x8CacheEntry *entry = &cache->entries[entry_index];
+
+    entry->newer_entry_index = FONT8X8_CACHE_NO_ENTRY;
+    entry->older_entry_index = cache->newest_entry_index;
+    if (cache->newest_entry_index != FONT8X8_CACHE_NO_ENTRY) {
+        cache->entries[cache->newest_entry_index].newer_entry_index = entry_index;
+    } else {
+        cache->oldest_entry_index = entry_index;
+    }
+    cache->newest_entry_index = entry_index;
+}
+
+static inline void font8x8_cache_evict_oldest(Font8x8RenderCache *cache) {
+    i32 entry_index = cache->oldest_entry_index;
+    assert(entry_index != FONT8X8_CACHE_NO_ENTRY);
+
+    font8x8_cache_unlink(cache, entry_index);
+    cache->storage_used -= cache->entries[entry_index].data_size;
+    cache->entries[entry_index].is_used = false;
+    cache->entry_count -= 1;
+    cache->eviction_count += 1;
+    if (cache->entry_count == 0) {
+        cache->storage_top = 0;
+    }
+}
+
+// Moves the data of the entries down to the start of the storage, keeping their order, so that all
+// the free space is at the top.
+static inline void font8x8_cache_compact(Font8x8RenderCache *cache) {
+    isize storage_top = 0;
+
+    while (true) {
+        // The entry with the lowest data which hasn't been moved yet.
+        i32 next_entry_index = FONT8X8_CACHE_NO_ENTRY;
+        for (i32 i = 0; i < cache->entry_capacity; i += 1) {
+            Font8x8CacheEntry const *entry = &cache->entries[i];
+            if (!entry->is_used || entry->data_offset < storage_top) {
+                continue;
+            }
+            if (
+                next_entry_index == FONT8X8_CACHE_NO_ENTRY ||
+                entry->data_offset < cache->entries[next_entry_index].data_offset
+            ) {
+                next_entry_index = i;
+            }
+        }
+        if (next_entry_index == FONT8X8_CACHE_NO_ENTRY) {
+            break;
+        }
+
+        Font8x8CacheEntry *entry = &cache->entries[next_entry_index];
+        memmove(cache->storage + storage_top, cache->storage + entry->data_offset, (size_t)entry->data_size);
+        entry->data_offset = storage_top;
+        storage_top += entry->data_size;
+    }
+
+    cache->storage_top = storage_top;
+}
+
+static inline i32 *font8x8_cache_entry_line_widths(Font8x8RenderCache const *cache, Font8x8CacheEntry const *entry) {
+    isize offset = (entry->data_offset + entry->string_size + 3) & ~(isize)3;
+    return (i32 *)(cache->storage + offset);
+}
+
+static inline u8 *font8x8_cache_entry_pixels(Font8x8RenderCache const *cache, Font8x8CacheEntry const *entry) {
+    return (u8 *)(font8x8_cache_entry_line_widths(cache, entry) + entry->line_count);
+}
+
+// Copies the rows of the run into the surface at (x, y), only as wide as each line was drawn, so that
+// the result is the same as drawing the string there.
+static inline void font8x8_cache_copy_run(
+    Font8x8RenderCache const *cache,
+    Font8x8CacheEntry const *entry,
+    Font8x8Surface surface,
+    i32 x,
+    i32 y
+) {
+    isize bytes_per_pixel = entry->format == FONT8X8_FORMAT_A8 ? 1 : 4;
+    isize run_stride = entry->width * bytes_per_pixel;
+    i32 const *line_widths = font8x8_cache_entry_line_widths(cache, entry);
+    u8 const *pixels = font8x8_cache_entry_pixels(cache, entry);
+    i32 line_height = FONT8X8_GLYPH_HEIGHT * entry->scale;
+
+    i32 x_begin = x < 0 ? 0 : x;
+    i32 y_begin = y < 0 ? 0 : y;
+    i32 y_end = surface.height - entry->height < y ? surface.height : y + entry->height;
+
+    for (i32 pixel_y = y_begin; pixel_y < y_end; pixel_y += 1) {
+        i32 run_y = pixel_y - y;
+        i32 line_width = line_widths[run_y / line_height];
+        i32 x_end = surface.width - line_width < x ? surface.width : x + line_width;
+        if (x_end <= x_begin) {
+            continue;
+        }
+
+        memcpy(
+            surface.pixels + pixel_y * surface.stride + x_begin * bytes_per_pixel,
+            pixels + run_y * run_stride + (x_begin - x) * bytes_per_pixel,
+            (size_t)((x_end - x_begin) * bytes_per_pixel)
+        );
+    }
+}
+
+// Same as font8x8_draw_string, but the runs are rendered once and then copied from the cache.
+static inline void font8x8_cache_draw_string(
+    Font8x8RenderCache *cache,
+    Font8x8Surface surface,
+    Font8x8 const *font,
+    StringView string,
+    i32 x,
+    i32 y,
+    i32 scale,
+    u32 foreground,
+    u32 background
+) {
+    if (scale <= 0 || string.size == 0) {
+        return;
+    }
+
+    u64 hash = font8x8_cache_hash(font, string, scale, foreground, background, surface.format);
+    for (i32 i = 0; i < cache->entry_capacity; i += 1) {
+        Font8x8CacheEntry *entry = &cache->entries[i];
+        bool is_hit =
+            entry->is_used &&
+            entry->hash == hash &&
+            entry->font == font &&
+            entry->string_size == string.size &&
+            entry->scale == scale &&
+            entry->foreground == foreground &&
+            entry->background == background &&
+            entry->format == surface.format &&
+            memcmp(cache->storage + entry->data_offset, string.data, (size_t)string.size) == 0;
+
+        if (is_hit) {
+            cache->hit_count += 1;
+            font8x8_cache_unlink(cache, i);
+            font8x8_cache_link_as_newest(cache, i);
+            font8x8_cache_copy_run(cache, entry, surface, x, y);
+            return;
+        }
+    }
+    cache->miss_count += 1;
+
+    // Measures the lines the same way as font8x8_draw_string advances the pen.
+    i32 line_count = 1;
+    i32 max_line_char_count = 0;
+    {
+        i32 line_char_count = 0;
+        StringView string_iter = string;
+        while (string_iter.size > 0) {
+            u32 char_code;
+            utf8_chop_char(&string_iter, &char_code);
+            if (char_code == '\n') {
+                line_count += 1;
+                line_char_count = 0;
+            } else {
+                line_char_count += 1;
+                max_line_char_count = line_char_count > max_line_char_count ? line_char_count : max_line_char_count;
+            }
+        }
+    }
+
+    isize bytes_per_pixel = surface.format == FONT8X8_FORMAT_A8 ? 1 : 4;
+    i32 width = max_line_char_count * FONT8X8_GLYPH_WIDTH * scale;
+    i32 height = line_count * FONT8X8_GLYPH_HEIGHT * scale;
+    isize widths_offset = (string.size + 3) & ~(isize)3;
+    isize pixels_size = (isize)width * height * bytes_per_pixel;
+    // Rounded up, so that the data of the next entry stays aligned.
+    isize data_size = (widths_offset + line_count * (isize)sizeof(i32) + pixels_size + 7) & ~(isize)7;
+
+    if (data_size > cache->storage_size) {
+        cache->bypass_count += 1;
+        font8x8_draw_string(surface, font, string, x, y, scale, foreground, background);
+        return;
+    }
+
+    while (cache->entry_count == cache->entry_capacity || cache->storage_used + data_size > cache->storage_size) {
+        font8x8_cache_evict_oldest(cache);
+    }
+    if (cache->storage_top + data_size > cache->storage_size) {
+        font8x8_cache_compact(cache);
+    }
+
+    i32 entry_index = 0;
+    while (cache->entries[entry_index].is_used) {
+        entry_index += 1;
+    }
+    Font8x8CacheEntry *entry = &cache->entries[entry_index];
+    *entry = (Font8x8CacheEntry){
+        .hash = hash,
+        .font = font,
+        .string_size = string.size,
+        .scale = scale,
+        .foreground = foreground,
+        .background = background,
+        .format = surface.format,
+        .data_offset = cache->storage_top,
+        .data_size = data_size,
+        .line_count = line_count,
+        .width = width,
+        .height = height,
+        .is_used = true,
+    };
+    cache->storage_top += data_size;
+    cache->storage_used += data_size;
+    cache->entry_count += 1;
+    font8x8_cache_link_as_newest(cache, entry_index);
+
+    memcpy(cache->storage + entry->data_offset, string.data, (size_t)string.size);
+
+    i32 *line_widths = font8x8_cache_entry_line_widths(cache, entry);
+    {
+        i32 line_index = 0;
+        line_widths[0] = 0;
+        StringView string_iter = string;
+        while (string_iter.size > 0) {
+            u32 char_code;
+            utf8_chop_char(&string_iter, &char_code);
+            if (char_code == '\n') {
+                line_index += 1;
+                line_widths[line_index] = 0;
+            } else {
+                line_widths[line_index] += FONT8X8_GLYPH_WIDTH * scale;
+            }
+        }
+    }
+
+    Font8x8Surface run_surface = {
+        .pixels = font8x8_cache_entry_pixels(cache, entry),
+        .width = width,
+        .height = height,
+        .stride = width * bytes_per_pixel,
+        .format = surface.format,
+    };
+    font8x8_draw_string(run_surface, font, string, 0, 0, scale, foreground, background);
+    font8x8_cache_copy_run(cache, entry, surface, x, y);
+}
+
+#endif // FONT8X8_CACHE_H
@@ -0,0 +1,412 @@
+// Drawing of the packed glyphs (see the packed C array exporter) into RGBA or A8 framebuffers at
+// any integer scale. Scales 1, 2 and 4 have dedicated paths, which expand whole rows with tables
+// and SSE2/NEON compares (define FONT8X8_NO_SIMD to get the scalar code only).
+
+#ifndef FONT8X8_DRAW_H
+#define FONT8X8_DRAW_H
+
+#include <stdbool.h>    // bool, true, false
+#include <string.h>     // memcpy
+
+#include "font8x8.h"
+
+typedef enum {
+    // One u32 per pixel, colors are written as is.
+    FONT8X8_FORMAT_RGBA8888,
+    // One u8 per pixel, only the alpha (the most significant byte) of the colors is written.
+    FONT8X8_FORMAT_A8,
+} Font8x8Format;
+
+typedef struct {
+    u8 *pixels;
+    i32 width;
+    i32 height;
+    // Distance between the starts of two consecutive rows in bytes.
+    isize stride;
+    Font8x8Format format;
+} Font8x8Surface;
+
+// Pixel masks for each nibble, the most significant bit is the leftmost pixel.
+static u32 const font8x8_nibble_masks[16][4] = {
+    {0x00000000, 0x00000000, 0x00000000, 0x00000000},
+    {0x00000000, 0x00000000, 0x00000000, 0xffffffff},
+    {0x00000000, 0x00000000, 0xffffffff, 0x00000000},
+    {0x00000000, 0x00000000, 0xffffffff, 0xffffffff},
+    {0x00000000, 0xffffffff, 0x00000000, 0x00000000},
+    {0x00000000, 0xffffffff, 0x00000000, 0xffffffff},
+    {0x00000000, 0xffffffff, 0xffffffff, 0x00000000},
+    {0x00000000, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0x00000000, 0x00000000, 0x00000000},
+    {0xffffffff, 0x00000000, 0x00000000, 0xffffffff},
+    {0xffffffff, 0x00000000, 0xffffffff, 0x00000000},
+    {0xffffffff, 0x00000000, 0xffffffff, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0x00000000, 0x00000000},
+    {0xffffffff, 0xffffffff, 0x00000000, 0xffffffff},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0x00000000},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+};
+
+// Each bit of the byte repeated twice, the most significant bit is still the leftmost pixel.
+static u16 const font8x8_expand_by_2[256] = {
+    0x0000, 0x0003, 0x000c, 0x000f, 0x0030, 0x0033, 0x003c, 0x003f,
+    0x00c0, 0x00c3, 0x00cc, 0x00cf, 0x00f0, 0x00f3, 0x00fc, 0x00ff,
+    0x0300, 0x0303, 0x030c, 0x030f, 0x0330, 0x0333, 0x033c, 0x033f,
+    0x03c0, 0x03c3, 0x03cc, 0x03cf, 0x03f0, 0x03f3, 0x03fc, 0x03ff,
+    0x0c00, 0x0c03, 0x0c0c, 0x0c0f, 0x0c30, 0x0c33, 0x0c3c, 0x0c3f,
+    0x0cc0, 0x0cc3, 0x0ccc, 0x0ccf, 0x0cf0, 0x0cf3, 0x0cfc, 0x0cff,
+    0x0f00, 0x0f03, 0x0f0c, 0x0f0f, 0x0f30, 0x0f33, 0x0f3c, 0x0f3f,
+    0x0fc0, 0x0fc3, 0x0fcc, 0x0fcf, 0x0ff0, 0x0ff3, 0x0ffc, 0x0fff,
+    0x3000, 0x3003, 0x300c, 0x300f, 0x3030, 0x3033, 0x303c, 0x303f,
+    0x30c0, 0x30c3, 0x30cc, 0x30cf, 0x30f0, 0x30f3, 0x30fc, 0x30ff,
+    0x3300, 0x3303, 0x330c, 0x330f, 0x3330, 0x3333, 0x333c, 0x333f,
+    0x33c0, 0x33c3, 0x33cc, 0x33cf, 0x33f0, 0x33f3, 0x33fc, 0x33ff,
+    0x3c00, 0x3c03, 0x3c0c, 0x3c0f, 0x3c30, 0x3c33, 0x3c3c, 0x3c3f,
+    0x3cc0, 0x3cc3, 0x3ccc, 0x3ccf, 0x3cf0, 0x3cf3, 0x3cfc, 0x3cff,
+    0x3f00, 0x3f03, 0x3f0c, 0x3f0f, 0x3f30, 0x3f33, 0x3f3c, 0x3f3f,
+    0x3fc0, 0x3fc3, 0x3fcc, 0x3fcf, 0x3ff0, 0x3ff3, 0x3ffc, 0x3fff,
+    0xc000, 0xc003, 0xc00c, 0xc00f, 0xc030, 0xc033, 0xc03c, 0xc03f,
+    0xc0c0, 0xc0c3, 0xc0cc, 0xc0cf, 0xc0f0, 0xc0f3, 0xc0fc, 0xc0ff,
+    0xc300, 0xc303, 0xc30c, 0xc30f, 0xc330, 0xc333, 0xc33c, 0xc33f,
+    0xc3c0, 0xc3c3, 0xc3cc, 0xc3cf, 0xc3f0, 0xc3f3, 0xc3fc, 0xc3ff,
+    0xcc00, 0xcc03, 0xcc0c, 0xcc0f, 0xcc30, 0xcc33, 0xcc3c, 0xcc3f,
+    0xccc0, 0xccc3, 0xcccc, 0xcccf, 0xccf0, 0xccf3, 0xccfc, 0xccff,
+    0xcf00, 0xcf03, 0xcf0c, 0xcf0f, 0xcf30, 0xcf33, 0xcf3c, 0xcf3f,
+    0xcfc0, 0xcfc3, 0xcfcc, 0xcfcf, 0xcff0, 0xcff3, 0xcffc, 0xcfff,
+    0xf000, 0xf003, 0xf00c, 0xf00f, 0xf030, 0xf033, 0xf03c, 0xf03f,
+    0xf0c0, 0xf0c3, 0xf0cc, 0xf0cf, 0xf0f0, 0xf0f3, 0xf0fc, 0xf0ff,
+    0xf300, 0xf303, 0xf30c, 0xf30f, 0xf330, 0xf333, 0xf33c, 0xf33f,
+    0xf3c0, 0xf3c3, 0xf3cc, 0xf3cf, 0xf3f0, 0xf3f3, 0xf3fc, 0xf3ff,
+    0xfc00, 0xfc03, 0xfc0c, 0xfc0f, 0xfc30, 0xfc33, 0xfc3c, 0xfc3f,
+    0xfcc0, 0xfcc3, 0xfccc, 0xfccf, 0xfcf0, 0xfcf3, 0xfcfc, 0xfcff,
+    0xff00, 0xff03, 0xff0c, 0xff0f, 0xff30, 0xff33, 0xff3c, 0xff3f,
+    0xffc0, 0xffc3, 0xffcc, 0xffcf, 0xfff0, 0xfff3, 0xfffc, 0xffff,
+};
+
+// Each bit of the byte repeated four times.
+static u32 const font8x8_expand_by_4[256] = {
+    0x00000000, 0x0000000f, 0x000000f0, 0x000000ff,
+    0x00000f00, 0x00000f0f, 0x00000ff0, 0x00000fff,
+    0x0000f000, 0x0000f00f, 0x0000f0f0, 0x0000f0ff,
+    0x0000ff00, 0x0000ff0f, 0x0000fff0, 0x0000ffff,
+    0x000f0000, 0x000f000f, 0x000f00f0, 0x000f00ff,
+    0x000f0f00, 0x000f0f0f, 0x000f0ff0, 0x000f0fff,
+    0x000ff000, 0x000ff00f, 0x000ff0f0, 0x000ff0ff,
+    0x000fff00, 0x000fff0f, 0x000ffff0, 0x000fffff,
+    0x00f00000, 0x00f0000f, 0x00f000f0, 0x00f000ff,
+    0x00f00f00, 0x00f00f0f, 0x00f00ff0, 0x00f00fff,
+    0x00f0f000, 0x00f0f00f, 0x00f0f0f0, 0x00f0f0ff,
+    0x00f0ff00, 0x00f0ff0f, 0x00f0fff0, 0x00f0ffff,
+    0x00ff0000, 0x00ff000f, 0x00ff00f0, 0x00ff00ff,
+    0x00ff0f00, 0x00ff0f0f, 0x00ff0ff0, 0x00ff0fff,
+    0x00fff000, 0x00fff00f, 0x00fff0f0, 0x00fff0ff,
+    0x00ffff00, 0x00ffff0f, 0x00fffff0, 0x00ffffff,
+    0x0f000000, 0x0f00000f, 0x0f0000f0, 0x0f0000ff,
+    0x0f000f00, 0x0f000f0f, 0x0f000ff0, 0x0f000fff,
+    0x0f00f000, 0x0f00f00f, 0x0f00f0f0, 0x0f00f0ff,
+    0x0f00ff00, 0x0f00ff0f, 0x0f00fff0, 0x0f00ffff,
+    0x0f0f0000, 0x0f0f000f, 0x0f0f00f0, 0x0f0f00ff,
+    0x0f0f0f00, 0x0f0f0f0f, 0x0f0f0ff0, 0x0f0f0fff,
+    0x0f0ff000, 0x0f0ff00f, 0x0f0ff0f0, 0x0f0ff0ff,
+    0x0f0fff00, 0x0f0fff0f, 0x0f0ffff0, 0x0f0fffff,
+    0x0ff00000, 0x0ff0000f, 0x0ff000f0, 0x0ff000ff,
+    0x0ff00f00, 0x0ff00f0f, 0x0ff00ff0, 0x0ff00fff,
+    0x0ff0f000, 0x0ff0f00f, 0x0ff0f0f0, 0x0ff0f0ff,
+    0x0ff0ff00, 0x0ff0ff0f, 0x0ff0fff0, 0x0ff0ffff,
+    0x0fff0000, 0x0fff000f, 0x0fff00f0, 0x0fff00ff,
+    0x0fff0f00, 0x0fff0f0f, 0x0fff0ff0, 0x0fff0fff,
+    0x0ffff000, 0x0ffff00f, 0x0ffff0f0, 0x0ffff0ff,
+    0x0fffff00, 0x0fffff0f, 0x0ffffff0, 0x0fffffff,
+    0xf0000000, 0xf000000f, 0xf00000f0, 0xf00000ff,
+    0xf0000f00, 0xf0000f0f, 0xf0000ff0, 0xf0000fff,
+    0xf000f000, 0xf000f00f, 0xf000f0f0, 0xf000f0ff,
+    0xf000ff00, 0xf000ff0f, 0xf000fff0, 0xf000ffff,
+    0xf00f0000, 0xf00f000f, 0xf00f00f0, 0xf00f00ff,
+    0xf00f0f00, 0xf00f0f0f, 0xf00f0ff0, 0xf00f0fff,
+    0xf00ff000, 0xf00ff00f, 0xf00ff0f0, 0xf00ff0ff,
+    0xf00fff00, 0xf00fff0f, 0xf00ffff0, 0xf00fffff,
+    0xf0f00000, 0xf0f0000f, 0xf0f000f0, 0xf0f000ff,
+    0xf0f00f00, 0xf0f00f0f, 0xf0f00ff0, 0xf0f00fff,
+    0xf0f0f000, 0xf0f0f00f, 0xf0f0f0f0, 0xf0f0f0ff,
+    0xf0f0ff00, 0xf0f0ff0f, 0xf0f0fff0, 0xf0f0ffff,
+    0xf0ff0000, 0xf0ff000f, 0xf0ff00f0, 0xf0ff00ff,
+    0xf0ff0f00, 0xf0ff0f0f, 0xf0ff0ff0, 0xf0ff0fff,
+    0xf0fff000, 0xf0fff00f, 0xf0fff0f0, 0xf0fff0ff,
+    0xf0ffff00, 0xf0ffff0f, 0xf0fffff0, 0xf0ffffff,
+    0xff000000, 0xff00000f, 0xff0000f0, 0xff0000ff,
+    0xff000f00, 0xff000f0f, 0xff000ff0, 0xff000fff,
+    0xff00f000, 0xff00f00f, 0xff00f0f0, 0xff00f0ff,
+    0xff00ff00, 0xff00ff0f, 0xff00fff0, 0xff00ffff,
+    0xff0f0000, 0xff0f000f, 0xff0f00f0, 0xff0f00ff,
+    0xff0f0f00, 0xff0f0f0f, 0xff0f0ff0, 0xff0f0fff,
+    0xff0ff000, 0xff0ff00f, 0xff0ff0f0, 0xff0ff0ff,
+    0xff0fff00, 0xff0fff0f, 0xff0ffff0, 0xff0fffff,
+    0xfff00000, 0xfff0000f, 0xfff000f0, 0xfff000ff,
+    0xfff00f00, 0xfff00f0f, 0xfff00ff0, 0xfff00fff,
+    0xfff0f000, 0xfff0f00f, 0xfff0f0f0, 0xfff0f0ff,
+    0xfff0ff00, 0xfff0ff0f, 0xfff0fff0, 0xfff0ffff,
+    0xffff0000, 0xffff000f, 0xffff00f0, 0xffff00ff,
+    0xffff0f00, 0xffff0f0f, 0xffff0ff0, 0xffff0fff,
+    0xfffff000, 0xfffff00f, 0xfffff0f0, 0xfffff0ff,
+    0xffffff00, 0xffffff0f, 0xfffffff0, 0xffffffff,
+};
+
+// Writes bit_count pixels (8, 16 or 32), the most significant of bit_count bits goes first.
+static inline void font8x8_write_row_rgba(
+    u32 *pixels,
+    u32 bits,
+    i32 bit_count,
+    u32 foreground,
+    u32 background
+) {
+#if defined(FONT8X8_SSE2)
+    __m128i const nibble_bits = _mm_setr_epi32(0x8, 0x4, 0x2, 0x1);
+    __m128i const foreground_x4 = _mm_set1_epi32((int)foreground);
+    __m128i const background_x4 = _mm_set1_epi32((int)background);
+    __m128i const bits_x4 = _mm_set1_epi32((int)bits);
+
+    for (i32 bit_index = 0; bit_index < bit_count; bit_index += 4) {
+        __m128i shift = _mm_cvtsi32_si128(bit_count - 4 - bit_index);
+        __m128i lane_bits = _mm_sll_epi32(nibble_bits, shift);
+        __m128i mask = _mm_cmpeq_epi32(_mm_and_si128(bits_x4, lane_bits), lane_bits);
+        __m128i colors = _mm_or_si128(
+            _mm_and_si128(mask, foreground_x4),
+            _mm_andnot_si128(mask, background_x4)
+        );
+        _mm_storeu_si128((__m128i *)(pixels + bit_index), colors);
+    }
+#elif defined(FONT8X8_NEON)
+    uint32x4_t const nibble_bits = {0x8, 0x4, 0x2, 0x1};
+    uint32x4_t const foreground_x4 = vdupq_n_u32(foreground);
+    uint32x4_t const background_x4 = vdupq_n_u32(background);
+    uint32x4_t const bits_x4 = vdupq_n_u32(bits);
+
+    for (i32 bit_index = 0; bit_index < bit_count; bit_index += 4) {
+        int32x4_t shift = vdupq_n_s32(bit_count - 4 - bit_index);
+        uint32x4_t mask = vtstq_u32(bits_x4, vshlq_u32(nibble_bits, shift));
+        vst1q_u32(pixels + bit_index, vbslq_u32(mask, foreground_x4, background_x4));
+    }
+#else
+    for (i32 bit_index = 0; bit_index < bit_count; bit_index += 4) {
+        u32 const *masks = font8x8_nibble_masks[(bits >> (bit_count - 4 - bit_index)) & 0xf];
+
+        pixels[bit_index + 0] = (foreground & masks[0]) | (background & ~masks[0]);
+        pixels[bit_index + 1] = (foreground & masks[1]) | (background & ~masks[1]);
+        pixels[bit_index + 2] = (foreground & masks[2]) | (background & ~masks[2]);
+        pixels[bit_index + 3] = (foreground & masks[3]) | (background & ~masks[3]);
+    }
+#endif
+}
+
+// Same as font8x8_write_row_rgba, but for single byte pixels.
+static inline void font8x8_write_row_a8(
+    u8 *pixels,
+    u32 bits,
+    i32 bit_count,
+    u8 foreground,
+    u8 background
+) {
+#if defined(FONT8X8_SSE2)
+    __m128i const byte_bits = _mm_setr_epi8(
+        (char)0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01,
+        (char)0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01
+    );
+    __m128i const foreground_x16 = _mm_set1_epi8((char)foreground);
+    __m128i const background_x16 = _mm_set1_epi8((char)background);
+
+    for (i32 bit_index = 0; bit_index < bit_count; bit_index += 16) {
+        // Two bytes of the row go into two halves of the register, each repeated 8 times.
+        u32 row_bytes = bit_count - bit_index >= 16
+            ? (bits >> (bit_count - 16 - bit_index)) & 0xffff
+            : (bits & 0xff) << 8;
+        __m128i row = _mm_cvtsi32_si128((int)((row_bytes >> 8) | (row_bytes & 0xff) << 8));
+        row = _mm_unpacklo_epi8(row, row);
+        row = _mm_unpacklo_epi16(row, row);
+        row = _mm_unpacklo_epi32(row, row);
+
+        __m128i mask = _mm_cmpeq_epi8(_mm_and_si128(row, byte_bits), byte_bits);
+        __m128i colors = _mm_or_si128(
+            _mm_and_si128(mask, foreground_x16),
+            _mm_andnot_si128(mask, background_x16)
+        );
+
+        if (bit_count - bit_index >= 16) {
+            _mm_storeu_si128((__m128i *)(pixels + bit_index), colors);
+        } else {
+            _mm_storel_epi64((__m128i *)(pixels + bit_index), colors);
+        }
+    }
+#elif defined(FONT8X8_NEON)
+    uint8x16_t const byte_bits = {
+        0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01,
+        0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01,
+    };
+    uint8x16_t const foreground_x16 = vdupq_n_u8(foreground);
+    uint8x16_t const background_x16 = vdupq_n_u8(background);
+
+    for (i32 bit_index = 0; bit_index < bit_count; bit_index += 16) {
+        if (bit_count - bit_index >= 16) {
+            u32 row_bytes = (bits >> (bit_count - 16 - bit_index)) & 0xffff;
+            uint8x16_t row = vcombine_u8(vdup_n_u8((u8)(row_bytes >> 8)), vdup_n_u8((u8)row_bytes));
+            uint8x16_t mask = vtstq_u8(row, byte_bits);
+            vst1q_u8(pixels + bit_index, vbslq_u8(mask, foreground_x16, background_x16));
+        } else {
+            uint8x8_t mask = vtst_u8(vdup_n_u8((u8)bits), vget_low_u8(byte_bits));
+            vst1_u8(
+                pixels + bit_index,
+                vbsl_u8(mask, vget_low_u8(foreground_x16), vget_low_u8(background_x16))
+            );
+        }
+    }
+#else
+    for (i32 bit_index = 0; bit_index < bit_count; bit_index += 1) {
+        bool is_set = ((bits >> (bit_count - 1 - bit_index)) & 1) != 0;
+        pixels[bit_index] = is_set ? foreground : background;
+    }
+#endif
+}
+
+// Draws the glyph with its top left corner at (x, y), each glyph pixel becomes a scale x scale
+// square. Set bits are drawn with the foreground color, the rest with the background color.
+// Pixels outside of the surface are clipped.
+static inline void font8x8_blit_glyph(
+    Font8x8Surface surface,
+    u8 const rows[FONT8X8_GLYPH_HEIGHT],
+    i32 x,
+    i32 y,
+    i32 scale,
+    u32 foreground,
+    u32 background
+) {
+    if (scale <= 0) {
+        return;
+    }
+
+    isize bytes_per_pixel = surface.format == FONT8X8_FORMAT_A8 ? 1 : 4;
+    u8 foreground_alpha = (u8)(foreground >> 24);
+    u8 background_alpha = (u8)(background >> 24);
+
+    i32 scaled_width = FONT8X8_GLYPH_WIDTH * scale;
+    i32 scaled_height = FONT8X8_GLYPH_HEIGHT * scale;
+
+    bool is_clipped =
+        x < 0 || y < 0 ||
+        x > surface.width - scaled_width ||
+        y > surface.height - scaled_height;
+
+    if (!is_clipped && (scale == 1 || scale == 2 || scale == 4)) {
+        u8 *line_start = surface.pixels + y * surface.stride + x * bytes_per_pixel;
+
+        for (i32 glyph_y = 0; glyph_y < FONT8X8_GLYPH_HEIGHT; glyph_y += 1) {
+            u32 bits = rows[glyph_y];
+            if (scale == 2) {
+                bits = font8x8_expand_by_2[bits];
+            } else if (scale == 4) {
+                bits = font8x8_expand_by_4[bits];
+            }
+
+            if (surface.format == FONT8X8_FORMAT_A8) {
+                font8x8_write_row_a8(
+                    line_start,
+                    bits,
+                    scaled_width,
+                    foreground_alpha,
+                    background_alpha
+                );
+            } else {
+                font8x8_write_row_rgba(
+                    (u32 *)line_start,
+                    bits,
+                    scaled_width,
+                    foreground,
+                    background
+                );
+            }
+            for (i32 pixel_y = 1; pixel_y < scale; pixel_y += 1) {
+                memcpy(
+                    line_start + pixel_y * surface.stride,
+                    line_start,
+                    (size_t)(scaled_width * bytes_per_pixel)
+                );
+            }
+
+            line_start += scale * surface.stride;
+        }
+
+        return;
+    }
+
+    i32 x_begin = x < 0 ? 0 : x;
+    i32 y_begin = y < 0 ? 0 : y;
+    i32 x_end = surface.width - scaled_width < x ? surface.width : x + scaled_width;
+    i32 y_end = surface.height - scaled_height < y ? surface.height : y + scaled_height;
+
+    for (i32 pixel_y = y_begin; pixel_y < y_end; pixel_y += 1) {
+        u8 row = rows[(pixel_y - y) / scale];
+        u8 *line_start = surface.pixels + pixel_y * surface.stride;
+
+        for (i32 pixel_x = x_begin; pixel_x < x_end; pixel_x += 1) {
+            bool is_set = ((row << ((pixel_x - x) / scale)) & 0x80) != 0;
+
+            if (surface.format == FONT8X8_FORMAT_A8) {
+                line_start[pixel_x] = is_set ? foreground_alpha : background_alpha;
+            } else {
+                ((u32 *)line_start)[pixel_x] = is_set ? foreground : background;
+            }
+        }
+    }
+}
+
+// Draws UTF-8 text (which has to be valid, see utf8_validate) with the top left corner of the first
+// glyph at (x, y). Each '\n' moves the pen to the start of the next line, char codes missing from
+// the font are drawn with its fallback glyph.
+static inline void font8x8_draw_string(
+    Font8x8Surface surface,
+    Font8x8 const *font,
+    StringView string,
+    i32 x,
+    i32 y,
+    i32 scale,
+    u32 foreground,
+    u32 background
+) {
+    if (scale <= 0) {
+        return;
+    }
+
+    i32 advance_x = FONT8X8_GLYPH_WIDTH * scale;
+    i32 advance_y = FONT8X8_GLYPH_HEIGHT * scale;
+    i32 pen_x = x;
+    i32 pen_y = y;
+
+    while (string.size > 0) {
+        u32 char_code;
+        utf8_chop_char(&string, &char_code);
+
+        if (char_code == '\n') {
+            pen_x = x;
+            pen_y += advance_y;
+            continue;
+        }
+
+        bool is_visible =
+            pen_x > -advance_x && pen_x < surface.width &&
+            pen_y > -advance_y && pen_y < surface.height;
+
+        if (is_visible) {
+            u16 glyph_index = font8x8_glyph_index(font->index, char_code);
+            font8x8_blit_glyph(
+                surface,
+                font8x8_glyph_rows(font, glyph_index),
+                pen_x,
+                pen_y,
+                scale,
+                foreground,
+                background
+            );
+        }
+
+        pen_x += advance_x;
+    }
+}
+
+#endif // FONT8X8_DRAW_H
@@ -0,0 +1,297 @@
+// Binary font file (.f8x8), which is written by the generator and can be used in place of the
+// generated C files, so that fonts can be swapped at runtime without recompiling anything.
+//
+// The file is a fixed header followed by the sections listed in it, every offset is from the start of
+// the file. All the values are in the byte order of the machine which wrote the file (the byte order
+// mark tells which one), so that the loader can hand out pointers right into the file data without
+// parsing or copying anything:
+//
+//   Font8x8FileHeader
+//   u32 char_codes[glyph_count]                  sorted by char code
+//   u16 direct_glyph_indices[direct_count]       see Font8x8Index
+//   Font8x8Range ranges[range_count]
+//   u32 char_data_offsets[glyph_count]           into the string pool
+//   u16 glyph_bitmap_indices[glyph_count]        glyphs which look the same share a bitmap
+//   char string_pool[string_pool_size]           NUL terminated UTF-8 of every glyph
+//   u8 bitmaps[bitmap_count][glyph_stride]       aligned to FONT8X8_FILE_BITMAP_ALIGNMENT
+//
+// Only the header is validated when opening. The tables are trusted, so don't open files which
+// didn't come from the generator.
+// Define FONT8X8_FILE_NO_STDIO to leave out font8x8_file_load and font8x8_file_unload.
+
+#ifndef FONT8X8_FILE_H
+#define FONT8X8_FILE_H
+
+#include <stdbool.h>    // bool, true, false
+#include <string.h>     // memcmp
+
+#include "font8x8.h"
+
+#ifndef FONT8X8_FILE_NO_STDIO
+    #include <stdio.h>      // FILE, fopen, fread, fseek, ftell, fclose
+    #include <stdlib.h>     // malloc, free
+
+    #if defined(__unix__) || defined(__APPLE__)
+        #define FONT8X8_FILE_MMAP
+        #include <sys/mman.h>   // mmap, munmap
+        #include <sys/stat.h>   // fstat
+        #include <fcntl.h>      // open
+        #include <unistd.h>     // close
+    #endif
+#endif
+
+#define FONT8X8_FILE_MAGIC "F8X8"
+#define FONT8X8_FILE_BYTE_ORDER_MARK 0x01020304
+#define FONT8X8_FILE_VERSION 2
+#define FONT8X8_FILE_BITMAP_ALIGNMENT 64
+
+typedef enum {
+    // One byte per row, the most significant bit is the leftmost pixel (like Font8x8.bitmap_rows).
+    FONT8X8_FILE_PIXEL_FORMAT_PACKED = 1,
+    // One byte per pixel, the alpha of the ink or of the background color (0xff and 0x00 by default).
+    FONT8X8_FILE_PIXEL_FORMAT_A8 = 2,
+    // The rest are in the colors chosen by the generator. Words are in the byte order of the file.
+    // u16 per pixel, 0bRRRRRGGGGGGBBBBB.
+    FONT8X8_FILE_PIXEL_FORMAT_RGB565 = 3,
+    // Bytes in the order of the name.
+    FONT8X8_FILE_PIXEL_FORMAT_RGBA8888 = 4,
+    FONT8X8_FILE_PIXEL_FORMAT_BGRA8888 = 5,
+    // u32 per pixel, 0xAARRGGBB with the color channels multiplied by the alpha.
+    FONT8X8_FILE_PIXEL_FORMAT_ARGB8888_PREMULTIPLIED = 6,
+} Font8x8FilePixelFormat;
+
+typedef struct {
+    u8 magic[4];
+    u32 byte_order_mark;
+    u16 version;
+    u16 header_size;
+    u8 glyph_width;
+    u8 glyph_height;
+    u8 pixel_format;
+    u8 reserved;
+    u32 glyph_count;
+    u32 bitmap_count;
+    // Bytes per glyph bitmap.
+    u32 glyph_stride;
+    u32 direct_count;
+    u32 range_count;
+    u32 fallback_glyph_index;
+    u32 char_codes_offset;
+    u32 direct_glyph_indices_offset;
+    u32 ranges_offset;
+    u32 char_data_offsets_offset;
+    u32 glyph_bitmap_indices_offset;
+    u32 string_pool_offset;
+    u32 string_pool_size;
+    u32 bitmaps_offset;
+    u32 file_size;
+} Font8x8FileHeader;
+
+// Pointers into the file data, which has to outlive this struct.
+typedef struct {
+    Font8x8FileHeader const *header;
+    u32 const *char_codes;
+    u32 const *char_data_offsets;
+    u16 const *glyph_bitmap_indices;
+    char const *string_pool;
+    u8 const *bitmaps;
+    Font8x8Index index;
+
+    // Set by font8x8_file_load only.
+    void *memory;
+    isize memory_size;
+    bool is_mapped;
+} Font8x8File;
+
+static inline bool font8x8_file_section_is_valid(
+    Font8x8FileHeader const *header,
+    u32 offset,
+    u64 size,
+    u32 alignment
+) {
+    return offset % alignment == 0 && offset >= header->header_size && offset + size <= header->file_size;
+}
+
+// Points the file at the given data. It has to be at least 4 byte aligned (as anything from malloc,
+// mmap or an arena is), the bitmaps are 64 byte aligned in memory only if the data is.
+static inline bool font8x8_file_open_memory(void const *data, isize size, Font8x8File *file) {
+    Font8x8FileHeader const *header = data;
+    if ((uptr)data % 4 != 0 || size < (isize)sizeof(Font8x8FileHeader)) {
+        return false;
+    }
+    if (
+        memcmp(header->magic, FONT8X8_FILE_MAGIC, 4) != 0 ||
+        header->byte_order_mark != FONT8X8_FILE_BYTE_ORDER_MARK ||
+        header->version != FONT8X8_FILE_VERSION ||
+        header->header_size < sizeof(Font8x8FileHeader) ||
+        header->file_size > (u64)size
+    ) {
+        return false;
+    }
+    if (
+        header->glyph_count == 0 ||
+        header->glyph_count > UINT16_MAX ||
+        header->range_count > UINT16_MAX ||
+        header->fallback_glyph_index >= header->glyph_count ||
+        header->bitmap_count == 0 ||
+        header->bitmap_count > header->glyph_count ||
+        header->string_pool_size == 0
+    ) {
+        return false;
+    }
+
+    u64 glyph_count = header->glyph_count;
+    if (
+        !font8x8_file_section_is_valid(header, header->char_codes_offset, glyph_count * 4, 4) ||
+        !font8x8_file_section_is_valid(header, header->direct_glyph_indices_offset, header->direct_count * 2ull, 2) ||
+        !font8x8_file_section_is_valid(header, header->ranges_offset, header->range_count * sizeof(Font8x8Range), 4) ||
+        !font8x8_file_section_is_valid(header, header->char_data_offsets_offset, glyph_count * 4, 4) ||
+        !font8x8_file_section_is_valid(header, header->glyph_bitmap_indices_offset, glyph_count * 2, 2) ||
+        !font8x8_file_section_is_valid(header, header->string_pool_offset, header->string_pool_size, 1) ||
+        !font8x8_file_section_is_valid(
+            header,
+            header->bitmaps_offset,
+            (u64)header->bitmap_count * header->glyph_stride,
+            FONT8X8_FILE_BITMAP_ALIGNMENT
+        )
+    ) {
+        return false;
+    }
+
+    u8 const *bytes = data;
+    char const *string_pool = (char const *)&bytes[header->string_pool_offset];
+    if (string_pool[header->string_pool_size - 1] != 0) {
+        return false;
+    }
+
+    *file = (Font8x8File){
+        .header = header,
+        .char_codes = (u32 const *)&bytes[header->char_codes_offset],
+        .char_data_offsets = (u32 const *)&bytes[header->char_data_offsets_offset],
+        .glyph_bitmap_indices = (u16 const *)&bytes[header->glyph_bitmap_indices_offset],
+        .string_pool = string_pool,
+        .bitmaps = &bytes[header->bitmaps_offset],
+        .index = {
+            .direct_glyph_indices = (u16 const *)&bytes[header->direct_glyph_indices_offset],
+            .direct_count = header->direct_count,
+            .ranges = (Font8x8Range const *)&bytes[header->ranges_offset],
+            .range_count = (u16)header->range_count,
+            .fallback_glyph_index = (u16)header->fallback_glyph_index,
+        },
+    };
+    return true;
+}
+
+// Returns the UTF-8 of the glyph char as a C string.
+static inline char const *font8x8_file_char_data(Font8x8File const *file, isize glyph_index) {
+    assert(0 <= glyph_index && glyph_index < file->header->glyph_count);
+    u32 offset = file->char_data_offsets[glyph_index];
+    return offset < file->header->string_pool_size ? &file->string_pool[offset] : "";
+}
+
+static inline u8 const *font8x8_file_glyph_bitmap(Font8x8File const *file, isize glyph_index) {
+    assert(0 <= glyph_index && glyph_index < file->header->glyph_count);
+    isize bitmap_index = file->glyph_bitmap_indices[glyph_index];
+    if (bitmap_index >= file->header->bitmap_count) {
+        return NULL;
+    }
+    return &file->bitmaps[bitmap_index * file->header->glyph_stride];
+}
+
+// Makes a font for font8x8_draw_string out of a file with packed 8x8 glyphs. The font points into the
+// file struct, so the struct must not be moved while the font is in use.
+static inline bool font8x8_file_to_font(Font8x8File const *file, Font8x8 *font) {
+    Font8x8FileHeader const *header = file->header;
+    if (
+        header->pixel_format != FONT8X8_FILE_PIXEL_FORMAT_PACKED ||
+        header->glyph_width != FONT8X8_GLYPH_WIDTH ||
+        header->glyph_height != FONT8X8_GLYPH_HEIGHT ||
+        header->glyph_stride != FONT8X8_GLYPH_HEIGHT
+    ) {
+        return false;
+    }
+
+    *font = (Font8x8){
+        .bitmap_rows = (u8 const (*)[FONT8X8_GLYPH_HEIGHT])file->bitmaps,
+        .bitmap_count = header->bitmap_count,
+        .glyph_bitmap_indices = file->glyph_bitmap_indices,
+        .glyph_count = header->glyph_count,
+        .index = &file->index,
+    };
+    return true;
+}
+
+#ifndef FONT8X8_FILE_NO_STDIO
+
+// Maps the file into memory where it is possible, otherwise reads it into a heap buffer.
+static inline bool font8x8_file_load(char const *path, Font8x8File *file) {
+#if defined(FONT8X8_FILE_MMAP)
+    int fd = open(path, O_RDONLY);
+    if (fd >= 0) {
+        struct stat file_stat;
+        void *memory = MAP_FAILED;
+        if (fstat(fd, &file_stat) == 0 && file_stat.st_size > 0) {
+            memory = mmap(NULL, (size_t)file_stat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        }
+        close(fd);
+
+        if (memory != MAP_FAILED) {
+            isize memory_size = (isize)file_stat.st_size;
+            if (!font8x8_file_open_memory(memory, memory_size, file)) {
+                munmap(memory, (size_t)memory_size);
+                return false;
+            }
+            file->memory = memory;
+            file->memory_size = memory_size;
+            file->is_mapped = true;
+            return true;
+        }
+    }
+#endif
+
+    FILE *input_file = fopen(path, "rb");
+    if (input_file == NULL) {
+        return false;
+    }
+
+    void *memory = NULL;
+    long memory_size = -1;
+    if (fseek(input_file, 0, SEEK_END) == 0) {
+        memory_size = ftell(input_file);
+    }
+    if (memory_size > 0 && fseek(input_file, 0, SEEK_SET) == 0) {
+        memory = malloc((size_t)memory_size);
+    }
+    if (memory == NULL || fread(memory, 1, (size_t)memory_size, input_file) != (size_t)memory_size) {
+        free(memory);
+        fclose(input_file);
+        return false;
+    }
+    fclose(input_file);
+
+    if (!font8x8_file_open_memory(memory, memory_size, file)) {
+        free(memory);
+        return false;
+    }
+    file->memory = memory;
+    file->memory_size = memory_size;
+    file->is_mapped = false;
+    return true;
+}
+
+static inline void font8x8_file_unload(Font8x8File *file) {
+#if defined(FONT8X8_FILE_MMAP)
+    if (file->is_mapped) {
+        munmap(file->memory, (size_t)file->memory_size);
+    } else {
+        free(file->memory);
+    }
+#else
+    free(file->memory);
+#endif
+    *file = (Font8x8File){0};
+}
+
+#endif // FONT8X8_FILE_NO_STDIO
+
+#endif // FONT8X8_FILE_H
@@ -0,0 +1,347 @@
+// Grid of text cells on top of font8x8_blit_glyph, for console and terminal views where only a few
+// cells change between frames. Every cell has a char code, a foreground and a background color, and
+// the cells which were changed since the last draw are tracked with a bitset (a bit per cell, the
+// rows start at whole u64 words), so that drawing only blits the dirty ones. Dirty cells next to each
+// other in a row are drawn as one span.
+//
+// The grid lives in a single block of memory given by the caller, see font8x8_grid_memory_size. It
+// keeps no pixels of its own: the cells are drawn into the surface given to font8x8_grid_draw, which
+// has to be the same one (with the pixels of the last draw still in it) every time. Otherwise call
+// font8x8_grid_mark_all_dirty to get a full redraw.
+
+#ifndef FONT8X8_GRID_H
+#define FONT8X8_GRID_H
+
+#include <stdbool.h>    // bool, true, false
+#include <string.h>     // memmove, memset
+
+#include "font8x8.h"
+#include "font8x8_draw.h"
+
+typedef struct {
+    u32 char_code;
+    u32 foreground;
+    u32 background;
+    // Looked up once the cell is set, so that drawing doesn't search the font index.
+    u16 glyph_index;
+} Font8x8GridCell;
+
+typedef struct {
+    Font8x8 const *font;
+    i32 column_count;
+    i32 row_count;
+    i32 scale;
+    // Top left corner of the grid in the surface, in pixels.
+    i32 x;
+    i32 y;
+
+    // Row after row.
+    Font8x8GridCell *cells;
+    u64 *dirty_words;
+    isize row_dirty_word_count;
+
+    u64 drawn_cell_count;
+    u64 drawn_span_count;
+} Font8x8Grid;
+
+static inline isize font8x8_grid_row_dirty_word_count(i32 column_count) {
+    return ((isize)column_count + 63) / 64;
+}
+
+static inline isize font8x8_grid_cells_size(i32 column_count, i32 row_count) {
+    isize cells_size = (isize)column_count * row_count * (isize)sizeof(Font8x8GridCell);
+    return (cells_size + 7) & ~(isize)7;
+}
+
+// Bytes of memory font8x8_grid_init needs for the grid.
+static inline isize font8x8_grid_memory_size(i32 column_count, i32 row_count) {
+    isize dirty_words_size = font8x8_grid_row_dirty_word_count(column_count) * row_count * (isize)sizeof(u64);
+    return font8x8_grid_cells_size(column_count, row_count) + dirty_words_size;
+}
+
+static inline Font8x8GridCell font8x8_grid_make_cell(
+    Font8x8 const *font,
+    u32 char_code,
+    u32 foreground,
+    u32 background
+) {
+    return (Font8x8GridCell){
+        .char_code = char_code,
+        .foreground = foreground,
+        .background = background,
+        .glyph_index = font8x8_glyph_index(font->index, char_code),
+    };
+}
+
+static inline void font8x8_grid_mark_dirty(Font8x8Grid *grid, i32 column, i32 row) {
+    grid->dirty_words[row * grid->row_dirty_word_count + column / 64] |= (u64)1 << (column % 64);
+}
+
+static inline void font8x8_grid_mark_all_dirty(Font8x8Grid *grid) {
+    for (i32 row = 0; row < grid->row_count; row += 1) {
+        u64 *row_dirty_words = &grid->dirty_words[row * grid->row_dirty_word_count];
+        for (isize i = 0; i < grid->row_dirty_word_count; i += 1) {
+            i32 column_count = grid->column_count - (i32)i * 64;
+            row_dirty_words[i] = column_count >= 64 ? ~(u64)0 : ((u64)1 << column_count) - 1;
+        }
+    }
+}
+
+// Fills the rows from row_begin up to row_end with spaces in the given colors and marks them dirty.
+static inline void font8x8_grid_clear_rows(
+    Font8x8Grid *grid,
+    i32 row_begin,
+    i32 row_end,
+    u32 foreground,
+    u32 background
+) {
+    Font8x8GridCell blank = font8x8_grid_make_cell(grid->font, ' ', foreground, background);
+    for (i32 row = row_begin; row < row_end; row += 1) {
+        Font8x8GridCell *row_cells = &grid->cells[row * grid->column_count];
+        for (i32 column = 0; column < grid->column_count; column += 1) {
+            row_cells[column] = blank;
+            font8x8_grid_mark_dirty(grid, column, row);
+        }
+    }
+}
+
+// Splits the memory (which has to be 8 byte aligned and font8x8_grid_memory_size bytes) into the cells
+// and the dirty bits. All the cells start as spaces in the given colors and dirty, so the first draw
+// fills the whole grid. Returns false, if the memory is too small.
+static inline bool font8x8_grid_init(
+    Font8x8Grid *grid,
+    void *memory,
+    isize memory_size,
+    Font8x8 const *font,
+    i32 column_count,
+    i32 row_count,
+    i32 scale,
+    i32 x,
+    i32 y,
+    u32 foreground,
+    u32 background
+) {
+    assert((uptr)memory % 8 == 0);
+
+    if (
+        column_count <= 0 || row_count <= 0 || scale <= 0 ||
+        memory_size < font8x8_grid_memory_size(column_count, row_count)
+    ) {
+        return false;
+    }
+
+    *grid = (Font8x8Grid){
+        .font = font,
+        .column_count = column_count,
+        .row_count = row_count,
+        .scale = scale,
+        .x = x,
+        .y = y,
+        .cells = memory,
+        .dirty_words = (u64 *)((u8 *)memory + font8x8_grid_cells_size(column_count, row_count)),
+        .row_dirty_word_count = font8x8_grid_row_dirty_word_count(column_count),
+    };
+    font8x8_grid_clear_rows(grid, 0, row_count, foreground, background);
+    return true;
+}
+
+// Changes the cell, which is marked dirty only if it looks different than before.
+static inline void font8x8_grid_set_cell(
+    Font8x8Grid *grid,
+    i32 column,
+    i32 row,
+    u32 char_code,
+    u32 foreground,
+    u32 background
+) {
+    assert(0 <= column && column < grid->column_count);
+    assert(0 <= row && row < grid->row_count);
+
+    Font8x8GridCell *cell = &grid->cells[row * grid->column_count + column];
+    if (cell->char_code == char_code && cell->foreground == foreground && cell->background == background) {
+        return;
+    }
+    *cell = font8x8_grid_make_cell(grid->font, char_code, foreground, background);
+    font8x8_grid_mark_dirty(grid, column, row);
+}
+
+// Writes UTF-8 text (which has to be valid, see utf8_validate) into the cells starting at (column, row).
+// Each '\n' moves to the starting column of the next row, the chars past the last column or row are
+// dropped.
+static inline void font8x8_grid_write_string(
+    Font8x8Grid *grid,
+    i32 column,
+    i32 row,
+    StringView string,
+    u32 foreground,
+    u32 background
+) {
+    i32 pen_column = column;
+    i32 pen_row = row;
+
+    while (string.size > 0 && pen_row < grid->row_count) {
+        u32 char_code;
+        utf8_chop_char(&string, &char_code);
+
+        if (char_code == '\n') {
+            pen_column = column;
+            pen_row += 1;
+            continue;
+        }
+
+        if (pen_row >= 0 && pen_column >= 0 && pen_column < grid->column_count) {
+            font8x8_grid_set_cell(grid, pen_column, pen_row, char_code, foreground, background);
+        }
+        pen_column += 1;
+    }
+}
+
+// Blits the cells from column_begin up to column_end of the row.
+static inline void font8x8_grid_draw_span(
+    Font8x8Grid *grid,
+    Font8x8Surface surface,
+    i32 row,
+    i32 column_begin,
+    i32 column_end
+) {
+    i32 advance_x = FONT8X8_GLYPH_WIDTH * grid->scale;
+    i32 pen_x = grid->x + column_begin * advance_x;
+    i32 pen_y = grid->y + row * FONT8X8_GLYPH_HEIGHT * grid->scale;
+    Font8x8GridCell const *cells = &grid->cells[row * grid->column_count];
+
+    for (i32 column = column_begin; column < column_end; column += 1) {
+        Font8x8GridCell const *cell = &cells[column];
+        font8x8_blit_glyph(
+            surface,
+            font8x8_glyph_rows(grid->font, cell->glyph_index),
+            pen_x,
+            pen_y,
+            grid->scale,
+            cell->foreground,
+            cell->background
+        );
+        pen_x += advance_x;
+    }
+
+    grid->drawn_cell_count += (u64)(column_end - column_begin);
+    grid->drawn_span_count += 1;
+}
+
+// Draws the dirty cells into the surface and marks them clean. Rows and words without dirty bits are
+// skipped as a whole.
+static inline void font8x8_grid_draw(Font8x8Grid *grid, Font8x8Surface surface) {
+    for (i32 row = 0; row < grid->row_count; row += 1) {
+        u64 *row_dirty_words = &grid->dirty_words[row * grid->row_dirty_word_count];
+        // The first column of the span which is being collected, -1 when there is none.
+        i32 span_begin = -1;
+
+        for (isize word_index = 0; word_index < grid->row_dirty_word_count; word_index += 1) {
+            u64 word = row_dirty_words[word_index];
+            i32 word_column = (i32)word_index * 64;
+            if (word == 0) {
+                if (span_begin >= 0) {
+                    font8x8_grid_draw_span(grid, surface, row, span_begin, word_column);
+                    span_begin = -1;
+                }
+                continue;
+            }
+            if (word == ~(u64)0) {
+                span_begin = span_begin >= 0 ? span_begin : word_column;
+                row_dirty_words[word_index] = 0;
+                continue;
+            }
+
+            for (i32 bit = 0; bit < 64; bit += 1) {
+                bool is_dirty = ((word >> bit) & 1) != 0;
+                if (is_dirty && span_begin < 0) {
+                    span_begin = word_column + bit;
+                } else if (!is_dirty && span_begin >= 0) {
+                    font8x8_grid_draw_span(grid, surface, row, span_begin, word_column + bit);
+                    span_begin = -1;
+                }
+            }
+            row_dirty_words[word_index] = 0;
+        }
+
+        if (span_begin >= 0) {
+            // The bits past the last column are never set, so a span which reaches them is at the end.
+            font8x8_grid_draw_span(grid, surface, row, span_begin, grid->column_count);
+        }
+    }
+}
+
+// Scrolls the grid up by line_count rows (down if it is negative): the cells and their dirty bits are
+// moved, the rows which came in are cleared to spaces in the given colors. When the whole grid is inside
+// the surface, its pixels are moved along with the cells, so only the new rows have to be drawn.
+// Otherwise the pixels which would come in from outside of the surface aren't there and the whole grid
+// is marked dirty.
+static inline void font8x8_grid_scroll(
+    Font8x8Grid *grid,
+    Font8x8Surface surface,
+    i32 line_count,
+    u32 foreground,
+    u32 background
+) {
+    if (line_count == 0) {
+        return;
+    }
+
+    i32 moved_row_count = grid->row_count - (line_count > 0 ? line_count : -line_count);
+    if (moved_row_count <= 0) {
+        font8x8_grid_clear_rows(grid, 0, grid->row_count, foreground, background);
+        return;
+    }
+
+    i32 source_row = line_count > 0 ? line_count : 0;
+    i32 target_row = line_count > 0 ? 0 : -line_count;
+    memmove(
+        &grid->cells[target_row * grid->column_count],
+        &grid->cells[source_row * grid->column_count],
+        (size_t)moved_row_count * (size_t)grid->column_count * sizeof(Font8x8GridCell)
+    );
+    memmove(
+        &grid->dirty_words[target_row * grid->row_dirty_word_count],
+        &grid->dirty_words[source_row * grid->row_dirty_word_count],
+        (size_t)moved_row_count * (size_t)grid->row_dirty_word_count * sizeof(u64)
+    );
+
+    i32 width = grid->column_count * FONT8X8_GLYPH_WIDTH * grid->scale;
+    i32 line_height = FONT8X8_GLYPH_HEIGHT * grid->scale;
+    bool is_inside =
+        grid->x >= 0 && grid->y >= 0 &&
+        grid->x <= surface.width - width &&
+        grid->y <= surface.height - grid->row_count * line_height;
+
+    if (is_inside) {
+        isize bytes_per_pixel = surface.format == FONT8X8_FORMAT_A8 ? 1 : 4;
+        u8 *grid_pixels = surface.pixels + grid->y * surface.stride + grid->x * bytes_per_pixel;
+        isize line_stride = line_height * surface.stride;
+        u8 *source_pixels = grid_pixels + source_row * line_stride;
+        u8 *target_pixels = grid_pixels + target_row * line_stride;
+        isize pixel_row_count = (isize)moved_row_count * line_height;
+        size_t pixel_row_size = (size_t)(width * bytes_per_pixel);
+
+        if (surface.stride == width * bytes_per_pixel) {
+            memmove(target_pixels, source_pixels, (size_t)pixel_row_count * pixel_row_size);
+        } else if (line_count > 0) {
+            for (isize i = 0; i < pixel_row_count; i += 1) {
+                memmove(target_pixels + i * surface.stride, source_pixels + i * surface.stride, pixel_row_size);
+            }
+        } else {
+            // Bottom up, so that the rows are read before they are overwritten.
+            for (isize i = pixel_row_count - 1; i >= 0; i -= 1) {
+                memmove(target_pixels + i * surface.stride, source_pixels + i * surface.stride, pixel_row_size);
+            }
+        }
+    } else {
+        font8x8_grid_mark_all_dirty(grid);
+    }
+
+    if (line_count > 0) {
+        font8x8_grid_clear_rows(grid, moved_row_count, grid->row_count, foreground, background);
+    } else {
+        font8x8_grid_clear_rows(grid, 0, -line_count, foreground, background);
+    }
+}
+
+#endif // FONT8X8_GRID_H
@@ -0,0 +1,214 @@
+// Text layout with the fixed advance of the 8x8 glyphs: line breaks, line extents and the bounds of the
+// text, without drawing anything. Lines end at each '\n' and are wrapped at the spaces (see
+// char_is_space) to fit the max width, a word longer than a whole line is broken between its chars.
+// To draw the text, draw every line with font8x8_draw_string at y + line_index * line height.
+
+#ifndef FONT8X8_LAYOUT_H
+#define FONT8X8_LAYOUT_H
+
+#include <stdbool.h>    // bool, true, false
+#include <stdint.h>     // INT32_MAX
+
+#include "font8x8.h"
+
+typedef struct {
+    // Bytes of the line in the string. Neither the break nor the spaces at the end of the line are
+    // included, so that they don't count into the width.
+    isize offset;
+    isize size;
+    i32 char_count;
+    // In pixels.
+    i32 width;
+} Font8x8Line;
+
+typedef struct {
+    // All the lines, also the ones which didn't fit into the line buffer.
+    isize line_count;
+    // Bounds of all the lines in pixels.
+    i32 width;
+    i32 height;
+} Font8x8Layout;
+
+static inline void font8x8_layout_push_line(
+    Font8x8Layout *layout,
+    Font8x8Line *lines,
+    isize line_capacity,
+    Font8x8Line line
+) {
+    if (layout->line_count < line_capacity) {
+        lines[layout->line_count] = line;
+    }
+    layout->line_count += 1;
+    if (line.width > layout->width) {
+        layout->width = line.width;
+    }
+}
+
+// Lays out UTF-8 text (which has to be valid, see utf8_validate) into lines no wider than max_width
+// pixels, or unlimited lines if it is 0 or less. At most line_capacity lines are written, pass no
+// buffer to only measure the text. The line after the last '\n' counts even if it is empty, like the
+// pen of font8x8_draw_string moves down for it.
+static inline Font8x8Layout font8x8_layout_text(
+    StringView string,
+    i32 max_width,
+    i32 scale,
+    Font8x8Line *lines,
+    isize line_capacity
+) {
+    Font8x8Layout layout = {0};
+    if (scale <= 0 || string.size == 0) {
+        return layout;
+    }
+
+    i32 advance_x = FONT8X8_GLYPH_WIDTH * scale;
+    // At least one char per line, so that the layout always moves on.
+    i32 max_char_count = max_width > 0 ? max_width / advance_x : INT32_MAX;
+    max_char_count = max_char_count > 0 ? max_char_count : 1;
+
+    u8 const *string_begin = string.data;
+    // The current line, its visible part ends with its last non-space char.
+    isize line_offset = 0;
+    i32 line_char_count = 0;
+    isize visible_end = 0;
+    i32 visible_char_count = 0;
+    // Where the line would be wrapped at its last run of spaces: the visible part before the run and
+    // the start of the next line after it.
+    bool has_break = false;
+    isize break_visible_end = 0;
+    i32 break_visible_char_count = 0;
+    isize break_resume_offset = 0;
+    i32 break_resume_char_count = 0;
+    // Spaces at the start of a wrapped line are dropped.
+    bool is_wrapped = false;
+
+    while (string.size > 0) {
+        isize char_offset = string.data - string_begin;
+        u32 char_code;
+        utf8_chop_char(&string, &char_code);
+        isize char_end = string.data - string_begin;
+
+        bool is_space = char_is_space(char_code);
+        bool is_line_full = line_char_count == max_char_count;
+
+        if (char_code == '\n' || (is_space && is_line_full)) {
+            // The spaces which wrapped the line hang at its end, so a '\n' right after them ends the
+            // same line rather than an empty one.
+            if (!(char_code == '\n' && is_wrapped && line_char_count == 0)) {
+                font8x8_layout_push_line(&layout, lines, line_capacity, (Font8x8Line){
+                    .offset = line_offset,
+                    .size = visible_end - line_offset,
+                    .char_count = visible_char_count,
+                    .width = visible_char_count * advance_x,
+                });
+            }
+            line_offset = char_end;
+            line_char_count = 0;
+            visible_end = char_end;
+            visible_char_count = 0;
+            has_break = false;
+            is_wrapped = char_code != '\n';
+            continue;
+        }
+
+        if (is_space) {
+            if (is_wrapped && line_char_count == 0) {
+                line_offset = char_end;
+                visible_end = char_end;
+                continue;
+            }
+
+            // A run of spaces starts right after the visible part.
+            if (!has_break || break_visible_end != visible_end) {
+                has_break = true;
+                break_visible_end = visible_end;
+                break_visible_char_count = visible_char_count;
+            }
+            line_char_count += 1;
+            break_resume_offset = char_end;
+            break_resume_char_count = line_char_count;
+            continue;
+        }
+
+        if (is_line_full) {
+            if (has_break) {
+                font8x8_layout_push_line(&layout, lines, line_capacity, (Font8x8Line){
+                    .offset = line_offset,
+                    .size = break_visible_end - line_offset,
+                    .char_count = break_visible_char_count,
+                    .width = break_visible_char_count * advance_x,
+                });
+                // Everything after the spaces is a part of the word, which goes to the next line.
+                line_offset = break_resume_offset;
+                line_char_count -= break_resume_char_count;
+            } else {
+                font8x8_layout_push_line(&layout, lines, line_capacity, (Font8x8Line){
+                    .offset = line_offset,
+                    .size = visible_end - line_offset,
+                    .char_count = visible_char_count,
+                    .width = visible_char_count * advance_x,
+                });
+                line_offset = char_offset;
+                line_char_count = 0;
+            }
+            has_break = false;
+            is_wrapped = true;
+        }
+
+        line_char_count += 1;
+        visible_end = char_end;
+        visible_char_count = line_char_count;
+    }
+
+    // Wrapping at the spaces at the end of the text doesn't make another line.
+    if (!is_wrapped || visible_char_count > 0) {
+        font8x8_layout_push_line(&layout, lines, line_capacity, (Font8x8Line){
+            .offset = line_offset,
+            .size = visible_end - line_offset,
+            .char_count = visible_char_count,
+            .width = visible_char_count * advance_x,
+        });
+    }
+
+    layout.height = (i32)layout.line_count * FONT8X8_GLYPH_HEIGHT * scale;
+    return layout;
+}
+
+typedef struct {
+    StringView string;
+    i32 max_width;
+    // Filled by font8x8_layout_texts: the lines of the text start at this index of the line buffer.
+    isize first_line_index;
+    Font8x8Layout layout;
+} Font8x8Text;
+
+// Lays out many texts at the same scale into one line buffer, the lines of each text follow the ones of
+// the text before it. Returns the number of lines written. Once the buffer is full, the rest of the
+// texts are only measured (their line count is still right, but they have fewer lines in the buffer).
+static inline isize font8x8_layout_texts(
+    Font8x8Text *texts,
+    isize text_count,
+    i32 scale,
+    Font8x8Line *lines,
+    isize line_capacity
+) {
+    isize line_count = 0;
+
+    for (isize i = 0; i < text_count; i += 1) {
+        Font8x8Text *text = &texts[i];
+        text->first_line_index = line_count;
+        text->layout = font8x8_layout_text(
+            text->string,
+            text->max_width,
+            scale,
+            lines != NULL ? lines + line_count : NULL,
+            line_capacity - line_count
+        );
+
+        isize line_space = line_capacity - line_count;
+        line_count += text->layout.line_count < line_space ? text->layout.line_count : line_space;
+    }
+
+    return line_count;
+}
+
+#endif // FONT8X8_LAYOUT_H
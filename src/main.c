@@ -1,22 +1,62 @@
-// TODO: Add PCF format and try it out within xterm (xterm -fa 'font name').
-// TODO: Add BDF format, because it's easier to write a BDF parser than a PCF parser.
-// TODO: Add XNA style image format, so that you could load it into raylib with LoadFontFromImage.
-// TODO: Raylib as well https://www.reddit.com/r/raylib/comments/1b96jcb/how_to_use_bitmap_fonts
 // TODO: Try to vectorize the font and export it into TTF just as an excuse to learn about TTF?
 
+// MAP_ANONYMOUS, MAP_NORESERVE and madvise are not a part of POSIX.
+#define _DEFAULT_SOURCE
+
 #include <stdbool.h>    // bool, true, false
-#include <assert.h>     // assert
+#include <assert.h>     // assert, static_assert
 #include <stddef.h>     // NULL, size_t
-#include <string.h>     // memcpy, strcpy
-#include <stdlib.h>     // abort, malloc, free, qsort
-#include <stdio.h>      // FILE, fopen, fclose, ftell, fseek, fread, ferror, fprintf, stderr,
-                        // fflush, printf
+#include <string.h>     // memcpy, memset, memcmp, strcpy, strcmp, strlen
+#include <stdlib.h>     // abort, malloc, free, qsort, abs
+#include <stdio.h>      // FILE, fopen, fclose, ftell, fseek, fread, fwrite, ferror, fprintf,
+                        // snprintf, vsnprintf, stderr, fflush, printf
+#include <stdarg.h>     // va_list, va_start, va_end
+#include <math.h>       // sqrtf, lroundf
+#include <stdatomic.h>  // atomic_long, atomic_bool, atomic_fetch_add
+#include <threads.h>    // thrd_t, thrd_create, thrd_join, once_flag, call_once
+#include <time.h>       // timespec, timespec_get
+
+#if defined(__unix__) || defined(__APPLE__)
+    #define ARENA_VIRTUAL_MEMORY
+    #define EXPORT_WRITEV
+    #include <unistd.h>     // sysconf, lseek
+    #include <sys/mman.h>   // mmap, madvise
+    #include <sys/uio.h>    // writev, iovec
+    #include <errno.h>      // errno, EINTR
+#endif
+
+// Decoded images and the scratch buffers of stb_image go into the arena of the current thread (see
+// stbi_arena_malloc), so they are released with the rest of the job.
+void *stbi_arena_malloc(size_t size);
+void *stbi_arena_realloc(void *ptr, size_t old_size, size_t new_size);
+#define STBI_MALLOC(size) stbi_arena_malloc(size)
+#define STBI_REALLOC_SIZED(ptr, old_size, new_size) stbi_arena_realloc(ptr, old_size, new_size)
+#define STBI_FREE(ptr) ((void)(ptr))
 
 #define STBI_NO_LINEAR
 #define STBI_NO_HDR
 #define STB_IMAGE_IMPLEMENTATION
 #include "../lib/stb_image.h"
 
+#include "font8x8.h"
+#include "font8x8_file.h"
+#include "font8x8_draw.h"
+#include "font8x8_cache.h"
+#include "font8x8_grid.h"
+
+#if !defined(FONT8X8_NO_SIMD)
+    #if defined(__SSSE3__) || defined(__AVX__)
+        #define UTF8_VALIDATE_SSSE3
+        #include <tmmintrin.h>
+    #elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+        #define UTF8_VALIDATE_SSE2
+        #include <emmintrin.h>
+    #elif defined(__aarch64__) || defined(_M_ARM64)
+        #define UTF8_VALIDATE_NEON
+        #include <arm_neon.h>
+    #endif
+#endif
+
 // Redefinition of typedefs is a C11 feature.
 // This is the official™ guard, which is used across different headers to protect u8 and friends.
 // (Or just add a #define before including this header, if you already have short names defined.)
@@ -45,14 +85,6 @@
 
 #define sizeof(expression) (isize)sizeof(expression)
 
-#if defined(__GCC__) || defined(__clang__)
-    #define UNREACHABLE() __builtin_unreachable()
-#elif defined(_MSC_VER)
-    #define UNREACHABLE() __assume(0)
-#else
-    #define UNREACHABLE() assert(0)
-#endif
-
 #define LOG_ERROR(...)                                                          \
     do {                                                                        \
         fprintf(stderr, "[ERROR] \"");                                          \
@@ -61,13 +93,86 @@
         fflush(stderr);                                                         \
     } while (0)
 
+// Expands the macro first, so that STRINGIFY(GLYPH_WIDTH) is "8".
+#define STRINGIFY(expression) STRINGIFY_UNEXPANDED(expression)
+#define STRINGIFY_UNEXPANDED(expression) #expression
+
 #define ARENA_DEFAULT_ALIGNMENT 16
 
+// The arena reserves this much of the address space. The OS commits the pages as they are touched for
+// the first time, so the memory use follows what was allocated. Without virtual memory it is just
+// malloc, which commits everything right away, so the capacity is much smaller.
+// Where the mapping is refused (strict overcommit, ulimit -v or the memory limit of a container), the
+// size is halved down to ARENA_MIN_CAPACITY, and then malloc is tried the same way.
+#define ARENA_MALLOC_CAPACITY ((isize)256 * 1024 * 1024)
+#define ARENA_MIN_CAPACITY ((isize)64 * 1024 * 1024)
+#if defined(ARENA_VIRTUAL_MEMORY) && UINTPTR_MAX > 0xffffffff
+    #define ARENA_RESERVE_CAPACITY ((isize)16 * 1024 * 1024 * 1024)
+#else
+    #define ARENA_RESERVE_CAPACITY ARENA_MALLOC_CAPACITY
+#endif
+
+// A copy of the arena is a marker: allocations from the copy are released by dropping it, which is how
+// the scratch space is scoped everywhere (Arena temp_arena = *arena).
 typedef struct {
     u8 *begin;
     u8 *end;
 } Arena;
 
+// The furthest position any arena of the thread has reached since this was reset (see FontJobStats).
+// Copies of the arenas are included, since the scratch space counts as well.
+static _Thread_local u8 *arena_high_water = NULL;
+
+// The arena may end up smaller than the capacity (see ARENA_MIN_CAPACITY), its end tells the size.
+bool arena_reserve(Arena *arena, isize capacity) {
+    assert(capacity >= ARENA_MIN_CAPACITY);
+    isize size = capacity;
+
+#if defined(ARENA_VIRTUAL_MEMORY)
+    for (; size >= ARENA_MIN_CAPACITY; size /= 2) {
+        void *memory = mmap(NULL, (size_t)size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+        if (memory != MAP_FAILED) {
+            *arena = (Arena){memory, (u8 *)memory + size};
+            return true;
+        }
+    }
+    size = capacity < ARENA_MALLOC_CAPACITY ? capacity : ARENA_MALLOC_CAPACITY;
+#endif
+
+    for (; size >= ARENA_MIN_CAPACITY; size /= 2) {
+        void *memory = malloc((size_t)size);
+        if (memory != NULL) {
+            *arena = (Arena){memory, (u8 *)memory + size};
+            return true;
+        }
+    }
+    return false;
+}
+
+// Gives the whole pages between the arena position and its end back to the OS, so that a big job
+// doesn't keep the memory for the rest of the run. They stay reserved and read as zeros when touched
+// again. Pass only the part which was used (up to the high water mark, see arena_used_part), madvise
+// over the untouched rest of a big reservation is a waste of time.
+void arena_release_pages(Arena const *arena) {
+#if defined(ARENA_VIRTUAL_MEMORY)
+    isize page_size = sysconf(_SC_PAGESIZE);
+    u8 *pages_begin = (u8 *)(((uptr)arena->begin + (uptr)page_size - 1) & ~((uptr)page_size - 1));
+    // Rounded down, so that the memory after a malloc fallback arena isn't touched.
+    u8 *pages_end = (u8 *)((uptr)arena->end & ~((uptr)page_size - 1));
+    if (pages_begin < pages_end) {
+        madvise(pages_begin, (size_t)(pages_end - pages_begin), MADV_DONTNEED);
+    }
+#else
+    (void)arena;
+#endif
+}
+
+// The part of the arena from its position up to the high water mark of the thread.
+Arena arena_used_part(Arena const *arena) {
+    bool is_inside = (uptr)arena_high_water > (uptr)arena->begin && (uptr)arena_high_water <= (uptr)arena->end;
+    return (Arena){arena->begin, is_inside ? arena_high_water : arena->begin};
+}
+
 void *arena_alloc_aligned(Arena *arena, isize size, isize alignment) {
     assert(alignment > 0 && (alignment & (alignment - 1)) == 0);
 
@@ -84,6 +189,9 @@ void *arena_alloc_aligned(Arena *arena, isize size, isize alignment) {
 
     void *ptr = arena->begin + padding;
     arena->begin += padding + size;
+    if ((uptr)arena->begin > (uptr)arena_high_water) {
+        arena_high_water = arena->begin;
+    }
     return ptr;
 }
 
@@ -106,125 +214,285 @@ void *arena_realloc(Arena *arena, void *old_ptr, isize old_size, isize new_size)
     }
 }
 
-typedef struct {
-    u8 *data;
-    isize size;
-} StringView;
+static _Thread_local Arena *stbi_arena = NULL;
 
-// 1 byte:  0b00000000 .. 0b01111111 = 0x00 .. 0x7f
-//
-// (Codes from 0x20 to 0x7f are covered by 1 byte case, so 0xc0 or 0xc1 as first byte is invalid.)
-// 2 bytes: 0b11000010 .. 0b11011111 = 0xc2 .. 0xdf
-//
-// 3 bytes: 0b11100000 .. 0b11101111 = 0xe0 .. 0xef
-//
-// (Codes greater than 0x10ffff are invalid.)
-// 4 bytes: 0b11110000 .. 0b11110100 = 0xf0 .. 0xf4
-u8 utf8_char_size[] = {
-//  0  1  2  3  4  5  6  7  8  9  A  B  C  D  E  F
-    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, // 0
-    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, // 1
-    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, // 2
-    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, // 3
-    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, // 4
-    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, // 5
-    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, // 6
-    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, // 7
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // 8
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // 9
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // A
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // B
-    0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, // C
-    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, // D
-    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, // E
-    4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // F
-};
+void *stbi_arena_malloc(size_t size) {
+    assert(stbi_arena != NULL);
+    return arena_alloc(stbi_arena, (isize)size);
+}
 
-// Unsafe function: passing invalid UTF-8 here will cause all sorts of UB.
-StringView utf8_chop_char(StringView *string, u32 *char_code) {
+void *stbi_arena_realloc(void *ptr, size_t old_size, size_t new_size) {
+    assert(stbi_arena != NULL);
+    return arena_realloc(stbi_arena, ptr, (isize)old_size, (isize)new_size);
+}
+
+// Validates one char and chops it off the string.
+bool utf8_validate_char(StringView *string) {
     isize char_size = utf8_char_size[string->data[0]];
+    if (char_size == 0 || string->size < char_size) {
+        return false;
+    }
 
-    switch (char_size) {
-    case 1: {
-        *char_code =
-            (u32)(string->data[0]);
-    } break;
+    // Validate UTF8 tail bytes.
+    for (isize i = 1; i < char_size; i += 1) {
+        if ((string->data[i] & 0xc0) != 0x80) {
+            return false;
+        }
+    }
 
-    case 2: {
-        *char_code =
-            (u32)(string->data[0] & 0x1f) << 6 |
-            (u32)(string->data[1] & 0x3f);
-    } break;
+    u32 char_code;
+    utf8_chop_char(string, &char_code);
 
-    case 3: {
-        *char_code =
-            (u32)(string->data[0] & 0x0f) << 12 |
-            (u32)(string->data[1] & 0x3f) << 6 |
-            (u32)(string->data[2] & 0x3f);
-    } break;
+    if (char_size == 3) {
+        if (char_code < 0x0800 || char_code > 0xffff) {
+            return false;
+        }
+        // Reserved for UTF-16 surrogate pairs.
+        if (char_code >= 0xd800 && char_code <= 0xdfff) {
+            return false;
+        }
+    }
+    if (char_size == 4) {
+        if (char_code < 0x10000 || char_code > 0x10ffff) {
+            return false;
+        }
+    }
 
-    case 4: {
-        *char_code =
-            (u32)(string->data[0] & 0x07) << 18 |
-            (u32)(string->data[1] & 0x3f) << 12 |
-            (u32)(string->data[2] & 0x3f) << 6 |
-            (u32)(string->data[3] & 0x3f);
-    } break;
+    return true;
+}
 
-    default: {
-        UNREACHABLE();
-    } break;
+// Reference implementation, which is also used for the tails left after the SIMD versions.
+bool utf8_validate_scalar(StringView string) {
+    while (string.size > 0) {
+        if (!utf8_validate_char(&string)) {
+            return false;
+        }
     }
 
-    StringView result = {string->data, char_size};
-    string->data += char_size;
-    string->size -= char_size;
-    return result;
+    return true;
 }
 
+#if defined(UTF8_VALIDATE_SSSE3) || defined(UTF8_VALIDATE_NEON)
+
+// Error flags of the lookup algorithm by John Keiser and Daniel Lemire ("Validating UTF-8 In Less
+// Than One Instruction Per Byte"). Each pair of consecutive bytes is classified by three table
+// lookups (high nibble of the first byte, low nibble of the first byte, high nibble of the second
+// byte), all the three classes have to share an error bit for the pair to be invalid.
+#define UTF8_TOO_SHORT (1 << 0)         // Lead byte followed by a lead byte or ASCII
+#define UTF8_TOO_LONG (1 << 1)          // ASCII followed by a continuation byte
+#define UTF8_OVERLONG_3 (1 << 2)        // 0xe0, 0x80 .. 0x9f
+#define UTF8_TOO_LARGE (1 << 3)         // 0xf4, 0x90 .. 0xbf or 0xf5 .. 0xff
+#define UTF8_SURROGATE (1 << 4)         // 0xed, 0xa0 .. 0xbf
+#define UTF8_OVERLONG_2 (1 << 5)        // 0xc0 .. 0xc1
+#define UTF8_TOO_LARGE_1000 (1 << 6)    // 0xf5 .. 0xff, 0x80 .. 0x8f
+#define UTF8_OVERLONG_4 (1 << 6)        // 0xf0, 0x80 .. 0x8f
+#define UTF8_TWO_CONTS (1 << 7)         // Two continuation bytes in a row
+#define UTF8_CARRY (UTF8_TOO_SHORT | UTF8_TOO_LONG | UTF8_TWO_CONTS)
+
+static u8 const utf8_byte_1_high[16] = {
+    UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG,
+    UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG,
+    UTF8_TWO_CONTS, UTF8_TWO_CONTS, UTF8_TWO_CONTS, UTF8_TWO_CONTS,
+    UTF8_TOO_SHORT | UTF8_OVERLONG_2,
+    UTF8_TOO_SHORT,
+    UTF8_TOO_SHORT | UTF8_OVERLONG_3 | UTF8_SURROGATE,
+    UTF8_TOO_SHORT | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000 | UTF8_OVERLONG_4,
+};
+
+static u8 const utf8_byte_1_low[16] = {
+    UTF8_CARRY | UTF8_OVERLONG_3 | UTF8_OVERLONG_2 | UTF8_OVERLONG_4,
+    UTF8_CARRY | UTF8_OVERLONG_2,
+    UTF8_CARRY,
+    UTF8_CARRY,
+    UTF8_CARRY | UTF8_TOO_LARGE,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000 | UTF8_SURROGATE,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+};
+
+static u8 const utf8_byte_2_high[16] = {
+    UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT,
+    UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT,
+    UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS | UTF8_OVERLONG_3 | UTF8_TOO_LARGE_1000 | UTF8_OVERLONG_4,
+    UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS | UTF8_OVERLONG_3 | UTF8_TOO_LARGE,
+    UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS | UTF8_SURROGATE | UTF8_TOO_LARGE,
+    UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS | UTF8_SURROGATE | UTF8_TOO_LARGE,
+    UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT,
+};
+
+// Lead bytes, which need more continuation bytes than there are left in the block, are greater than
+// these (the last 3 bytes of the block).
+static u8 const utf8_block_incomplete_max[16] = {
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0 - 1, 0xe0 - 1, 0xc0 - 1,
+};
+
+#endif
+
+// Validates 16 or 32 bytes per step with SIMD (the blocks consisting only of ASCII chars are skipped
+// with a single compare), the rest of the string is handled by utf8_validate_scalar. The rules are
+// the same: no overlong encodings, no surrogates and no char codes above 0x10ffff.
 bool utf8_validate(StringView string) {
-    while (string.size > 0) {
-        isize char_size = utf8_char_size[string.data[0]];
-        if (char_size == 0 || string.size < char_size) {
+#if defined(UTF8_VALIDATE_SSSE3) || defined(UTF8_VALIDATE_NEON)
+    isize const block_size = 16;
+    u8 const *block = string.data;
+    u8 const *blocks_end = string.data + (string.size & ~(block_size - 1));
+
+    #if defined(UTF8_VALIDATE_SSSE3)
+        __m128i const byte_1_high = _mm_loadu_si128((__m128i const *)utf8_byte_1_high);
+        __m128i const byte_1_low = _mm_loadu_si128((__m128i const *)utf8_byte_1_low);
+        __m128i const byte_2_high = _mm_loadu_si128((__m128i const *)utf8_byte_2_high);
+        __m128i const incomplete_max = _mm_loadu_si128((__m128i const *)utf8_block_incomplete_max);
+        __m128i const low_nibble_mask = _mm_set1_epi8(0x0f);
+
+        __m128i error = _mm_setzero_si128();
+        __m128i prev_input = _mm_setzero_si128();
+        __m128i prev_incomplete = _mm_setzero_si128();
+
+        while (block < blocks_end) {
+            __m128i input = _mm_loadu_si128((__m128i const *)block);
+
+            if (_mm_movemask_epi8(input) == 0) {
+                // ASCII block is only valid, if the previous block did not end in the middle of a char.
+                error = _mm_or_si128(error, prev_incomplete);
+            } else {
+                __m128i prev1 = _mm_alignr_epi8(input, prev_input, 16 - 1);
+                __m128i prev2 = _mm_alignr_epi8(input, prev_input, 16 - 2);
+                __m128i prev3 = _mm_alignr_epi8(input, prev_input, 16 - 3);
+
+                __m128i prev1_high = _mm_and_si128(_mm_srli_epi16(prev1, 4), low_nibble_mask);
+                __m128i prev1_low = _mm_and_si128(prev1, low_nibble_mask);
+                __m128i input_high = _mm_and_si128(_mm_srli_epi16(input, 4), low_nibble_mask);
+
+                __m128i special_cases = _mm_and_si128(
+                    _mm_and_si128(
+                        _mm_shuffle_epi8(byte_1_high, prev1_high),
+                        _mm_shuffle_epi8(byte_1_low, prev1_low)
+                    ),
+                    _mm_shuffle_epi8(byte_2_high, input_high)
+                );
+
+                // The 2nd and 3rd continuation bytes of 3 and 4 byte chars are not covered by the
+                // tables, so they get their 0x80 bit flipped here (it's set for TWO_CONTS).
+                __m128i is_third_byte = _mm_subs_epu8(prev2, _mm_set1_epi8((char)(0xe0 - 0x80)));
+                __m128i is_fourth_byte = _mm_subs_epu8(prev3, _mm_set1_epi8((char)(0xf0 - 0x80)));
+                __m128i must_be_2_3_continuation = _mm_and_si128(
+                    _mm_or_si128(is_third_byte, is_fourth_byte),
+                    _mm_set1_epi8((char)0x80)
+                );
+
+                error = _mm_or_si128(error, _mm_xor_si128(must_be_2_3_continuation, special_cases));
+            }
+
+            prev_incomplete = _mm_subs_epu8(input, incomplete_max);
+            prev_input = input;
+            block += block_size;
+        }
+
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(error, _mm_setzero_si128())) != 0xffff) {
             return false;
         }
+    #else
+        uint8x16_t const byte_1_high = vld1q_u8(utf8_byte_1_high);
+        uint8x16_t const byte_1_low = vld1q_u8(utf8_byte_1_low);
+        uint8x16_t const byte_2_high = vld1q_u8(utf8_byte_2_high);
+        uint8x16_t const incomplete_max = vld1q_u8(utf8_block_incomplete_max);
+        uint8x16_t const low_nibble_mask = vdupq_n_u8(0x0f);
 
-        // Validate UTF8 tail bytes.
-        for (isize i = 1; i < char_size; i += 1) {
-            if ((string.data[i] & 0xc0) != 0x80) {
-                return false;
+        uint8x16_t error = vdupq_n_u8(0);
+        uint8x16_t prev_input = vdupq_n_u8(0);
+        uint8x16_t prev_incomplete = vdupq_n_u8(0);
+
+        while (block < blocks_end) {
+            uint8x16_t input = vld1q_u8(block);
+
+            if (vmaxvq_u8(input) < 0x80) {
+                // ASCII block is only valid, if the previous block did not end in the middle of a char.
+                error = vorrq_u8(error, prev_incomplete);
+            } else {
+                uint8x16_t prev1 = vextq_u8(prev_input, input, 16 - 1);
+                uint8x16_t prev2 = vextq_u8(prev_input, input, 16 - 2);
+                uint8x16_t prev3 = vextq_u8(prev_input, input, 16 - 3);
+
+                uint8x16_t special_cases = vandq_u8(
+                    vandq_u8(
+                        vqtbl1q_u8(byte_1_high, vshrq_n_u8(prev1, 4)),
+                        vqtbl1q_u8(byte_1_low, vandq_u8(prev1, low_nibble_mask))
+                    ),
+                    vqtbl1q_u8(byte_2_high, vshrq_n_u8(input, 4))
+                );
+
+                // The 2nd and 3rd continuation bytes of 3 and 4 byte chars are not covered by the
+                // tables, so they get their 0x80 bit flipped here (it's set for TWO_CONTS).
+                uint8x16_t is_third_byte = vqsubq_u8(prev2, vdupq_n_u8(0xe0 - 0x80));
+                uint8x16_t is_fourth_byte = vqsubq_u8(prev3, vdupq_n_u8(0xf0 - 0x80));
+                uint8x16_t must_be_2_3_continuation = vandq_u8(
+                    vorrq_u8(is_third_byte, is_fourth_byte),
+                    vdupq_n_u8(0x80)
+                );
+
+                error = vorrq_u8(error, veorq_u8(must_be_2_3_continuation, special_cases));
             }
+
+            prev_incomplete = vqsubq_u8(input, incomplete_max);
+            prev_input = input;
+            block += block_size;
         }
 
-        u32 char_code;
-        utf8_chop_char(&string, &char_code);
+        if (vmaxvq_u8(error) != 0) {
+            return false;
+        }
+    #endif
 
-        if (char_size == 3) {
-            if (char_code < 0x0800 || char_code > 0xffff) {
-                return false;
-            }
-            // Reserved for UTF-16 surrogate pairs.
-            if (char_code >= 0xd800 && char_code <= 0xdfff) {
-                return false;
-            }
+    // The char at the end of the last block might continue past it, so the scalar validation starts
+    // over from its lead byte.
+    u8 const *tail = block;
+    for (isize i = 1; i <= 3 && tail - i >= string.data; i += 1) {
+        u8 byte = tail[-i];
+        if (byte >= 0xc0) {
+            tail -= i;
+            break;
+        }
+        if (byte < 0x80) {
+            break;
+        }
+    }
+
+    string.size -= tail - string.data;
+    string.data = (u8 *)tail;
+#elif defined(UTF8_VALIDATE_SSE2)
+    // No byte shuffles in SSE2, so only the blocks of ASCII chars are skipped here.
+    isize const block_size = 32;
+
+    while (string.size >= block_size) {
+        __m128i input_low = _mm_loadu_si128((__m128i const *)string.data);
+        __m128i input_high = _mm_loadu_si128((__m128i const *)(string.data + 16));
+
+        if (_mm_movemask_epi8(_mm_or_si128(input_low, input_high)) == 0) {
+            string.data += block_size;
+            string.size -= block_size;
+            continue;
         }
-        if (char_size == 4) {
-            if (char_code < 0x10000 || char_code > 0x10ffff) {
+
+        // Validate chars one at a time until the start of the next block, which can be skipped.
+        u8 const *block_end = string.data + block_size;
+        while (string.data < block_end) {
+            if (!utf8_validate_char(&string)) {
                 return false;
             }
         }
     }
+#endif
 
-    return true;
-}
-
-bool char_is_space(u32 char_code) {
-    return
-        char_code == 0x0020 ||  // Space
-        char_code == 0x0009 ||  // Character Tabulation
-        char_code == 0x000a ||  // End of Line
-        char_code == 0x000c ||  // Form Feed
-        char_code == 0x000d;    // Carriage Return
+    return utf8_validate_scalar(string);
 }
 
 typedef struct {
@@ -276,272 +544,5046 @@ bool file_read_to_string(char const *file_path, String *string, Arena *arena) {
     return true;
 }
 
+// Defaults for the generator run without a manifest.
 #define FONT_NAME "font8x8"
 #define FONT_SCALE 2
+#define FONT_IMAGE_PATH "./res/font8x8.png"
+#define FONT_CHARS_PATH "./res/font8x8.txt"
+#define FONT_OUTPUT_DIRECTORY "./out"
+// See PixelFormat. Colors are in the layout of the glyph bitmaps: 0xAABBGGRR, which is R G B A in
+// memory on little-endian machines.
+#define FONT_PIXEL_FORMAT PIXEL_FORMAT_DEFAULT
+#define FONT_INK_COLOR 0xffffffff
+#define FONT_BACKGROUND_COLOR 0x00000000
+// GlyphStyle bits of the style planes in the packed C array, none by default.
+#define FONT_STYLES 0
+// Bit order of the column bytes for page-addressed displays, SSD1306 and ST7565 put the top pixel of a
+// page into the least significant bit.
+#define FONT_COLUMNS_LSB_TOP true
+// Upsampling of the glyphs in the distance field atlas and the pixels of the field around them.
+#define FONT_SDF_SCALE 4
+#define FONT_SDF_SPREAD 4
+
+#define FONT_JOB_NAME_CAPACITY 64
+#define FONT_JOB_PATH_CAPACITY 256
+#define FONT_SCALE_MAX 16
+#define FONT_SUBSET_RANGE_MAX_COUNT 32
+#define SDF_SCALE_MAX 16
+#define SDF_SPREAD_MAX 32
+
 #define GLYPH_WIDTH 8
 #define GLYPH_HEIGHT 8
 
+#if GLYPH_WIDTH > 8
+    #error "Packed glyph rows are stored as bytes, so glyphs wider than 8 pixels are not supported."
+#endif
+
+typedef enum {
+    OUTPUT_FORMAT_C_ARRAY = 1 << 0,
+    OUTPUT_FORMAT_PACKED_C_ARRAY = 1 << 1,
+    OUTPUT_FORMAT_BDF = 1 << 2,
+    OUTPUT_FORMAT_PCF = 1 << 3,
+    OUTPUT_FORMAT_FONT_FILE = 1 << 4,
+    // The atlas image along with its rects.
+    OUTPUT_FORMAT_ATLAS = 1 << 5,
+    // Column bytes for page-addressed monochrome displays.
+    OUTPUT_FORMAT_COLUMNS_C_ARRAY = 1 << 6,
+    // The signed distance field atlas along with its rects, for scaling in a shader.
+    OUTPUT_FORMAT_SDF_ATLAS = 1 << 7,
+    // Glyph masks for a GPU buffer along with the shader which draws text from them.
+    OUTPUT_FORMAT_GPU_BUFFER = 1 << 8,
+} OutputFormat;
+
+#define OUTPUT_FORMAT_ALL ((1 << 9) - 1)
+
+// Pixels of the bitmap outputs (the C array, the atlas and the binary file), so that they can be used
+// as is by the GPU or the display. The byte formats are named by the order of the bytes in memory
+// and the rest by the bits of the word, which is in the byte order of the machine.
+typedef enum {
+    // Each output keeps its own format: RGBA8888 for the C array, ATLAS_FILE_FORMAT for the atlas and
+    // FONT_FILE_PIXEL_FORMAT for the binary file.
+    PIXEL_FORMAT_DEFAULT,
+    // Rows padded to whole bytes, the most significant bit is the leftmost pixel. Pixels of the ink
+    // color are set.
+    PIXEL_FORMAT_1BPP,
+    // Alpha of the colors.
+    PIXEL_FORMAT_A8,
+    // 0bRRRRRGGGGGGBBBBB, the colors are truncated.
+    PIXEL_FORMAT_RGB565,
+    PIXEL_FORMAT_RGBA8888,
+    PIXEL_FORMAT_BGRA8888,
+    // 0xAARRGGBB with the color channels multiplied by the alpha (the Cairo or Skia N32 layout).
+    PIXEL_FORMAT_ARGB8888_PREMULTIPLIED,
+    PIXEL_FORMAT_COUNT,
+} PixelFormat;
+
+static char const *const pixel_format_names[PIXEL_FORMAT_COUNT] = {
+    [PIXEL_FORMAT_DEFAULT] = "default",
+    [PIXEL_FORMAT_1BPP] = "1bpp",
+    [PIXEL_FORMAT_A8] = "a8",
+    [PIXEL_FORMAT_RGB565] = "rgb565",
+    [PIXEL_FORMAT_RGBA8888] = "rgba8888",
+    [PIXEL_FORMAT_BGRA8888] = "bgra8888",
+    [PIXEL_FORMAT_ARGB8888_PREMULTIPLIED] = "argb8888_premultiplied",
+};
+
+// Synthesized variants of the glyphs, which the packed C array adds as extra planes of bitmap rows.
+typedef enum {
+    GLYPH_STYLE_BOLD = 1 << 0,
+    GLYPH_STYLE_ITALIC = 1 << 1,
+    GLYPH_STYLE_UNDERLINE = 1 << 2,
+    GLYPH_STYLE_STRIKE = 1 << 3,
+} GlyphStyle;
+
+#define GLYPH_STYLE_COUNT 4
+
+static char const *const glyph_style_names[GLYPH_STYLE_COUNT] = {"bold", "italic", "underline", "strike"};
+
+typedef struct {
+    u32 first_char_code;
+    u32 last_char_code;
+} CharCodeRange;
+
+// One font to convert. The name is used for the output files and as the prefix of the C symbols.
+typedef struct {
+    char name[FONT_JOB_NAME_CAPACITY];
+    char image_path[FONT_JOB_PATH_CAPACITY];
+    char chars_path[FONT_JOB_PATH_CAPACITY];
+    char output_directory[FONT_JOB_PATH_CAPACITY];
+    // Of the RGBA C array and the atlas, the rest of the outputs are always at the native size.
+    i32 scale;
+    u32 output_formats;
+    PixelFormat pixel_format;
+    u32 ink_color;
+    u32 background_color;
+    // GlyphStyle bits.
+    u32 styles;
+    // Of the columns C array, see FONT_COLUMNS_LSB_TOP.
+    bool is_columns_lsb_top;
+    // Of the distance field atlas, see FONT_SDF_SCALE and FONT_SDF_SPREAD.
+    i32 sdf_scale;
+    i32 sdf_spread;
+    // Glyphs to keep, all of them if there are no ranges. The fallback glyph is always kept.
+    CharCodeRange subset_ranges[FONT_SUBSET_RANGE_MAX_COUNT];
+    isize subset_range_count;
+} FontJob;
+
 typedef struct {
     u32 char_code;
     char *char_data;
     u32 *bitmap;
+    // Native size 1-bit mask, one byte per row, the most significant bit is the leftmost pixel.
+    u8 rows[GLYPH_HEIGHT];
+    // Glyphs which look the same (A, Cyrillic A and Greek Alpha) share a bitmap. Bitmaps are numbered
+    // in the order of their first glyph, see glyphs_dedup_bitmaps.
+    isize bitmap_index;
+    // The next glyph with the same bitmap, or -1 for the last one.
+    isize next_glyph_index;
 } Glyph;
 
 int glyph_compare(void const *left, void const *right) {
     return (i32)((Glyph const *)left)->char_code - (i32)((Glyph const *)right)->char_code;
 }
 
-void glyphs_print(Glyph *glyphs, isize glyph_count) {
-    Glyph *glyph_iter = glyphs;
-    Glyph *glyphs_end = glyphs + glyph_count;
+// Packs a cell of a single channel image into a mask, one byte per row (the most significant bit is
+// the leftmost pixel) with the rows going from the least significant byte. Black pixels are set.
+u64 image_cell_extract_mask(u8 const *cell, isize image_width) {
+    u64 mask = 0;
 
-    while (glyph_iter < glyphs_end) {
-        printf("'%s' (U+%x)\n", glyph_iter->char_data, glyph_iter->char_code);
-        for (isize y = 0; y < GLYPH_HEIGHT * FONT_SCALE; y += 1) {
-            for (isize x = 0; x < GLYPH_WIDTH * FONT_SCALE; x += 1) {
-                u8 alpha = (glyph_iter->bitmap[y * (GLYPH_WIDTH * FONT_SCALE) + x] >> 24) & 0xff;
-                printf("%c ", alpha == 0x00 ? ' ' : '@');
+    for (isize cell_y = 0; cell_y < GLYPH_HEIGHT; cell_y += 1) {
+        u8 const *line = cell + cell_y * image_width;
+        u64 row = 0;
+
+    #if GLYPH_WIDTH == 8 && defined(FONT8X8_SSE2)
+        // Each black pixel keeps its bit out of 0x80 .. 0x01, then the sum of the bytes is the row.
+        __m128i const pixel_bits = _mm_setr_epi8(
+            (char)0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01,
+            0, 0, 0, 0, 0, 0, 0, 0
+        );
+        __m128i pixels = _mm_loadl_epi64((__m128i const *)line);
+        __m128i is_black = _mm_cmpeq_epi8(pixels, _mm_setzero_si128());
+        row = (u64)_mm_cvtsi128_si32(_mm_sad_epu8(_mm_and_si128(is_black, pixel_bits), _mm_setzero_si128()));
+    #elif GLYPH_WIDTH == 8 && defined(FONT8X8_NEON)
+        uint8x8_t const pixel_bits = {0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01};
+        uint8x8_t is_black = vceq_u8(vld1_u8(line), vdup_n_u8(0));
+        row = vaddv_u8(vand_u8(is_black, pixel_bits));
+    #elif GLYPH_WIDTH == 8 && defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+        u64 pixels;
+        memcpy(&pixels, line, sizeof(pixels));
+        // 0x80 in each zero byte, then the multiplication gathers the high bits into the top byte.
+        u64 is_black = ~(((pixels & 0x7f7f7f7f7f7f7f7f) + 0x7f7f7f7f7f7f7f7f) | pixels | 0x7f7f7f7f7f7f7f7f);
+        row = ((is_black >> 7) * 0x8040201008040201) >> 56;
+    #else
+        for (isize cell_x = 0; cell_x < GLYPH_WIDTH; cell_x += 1) {
+            if (line[cell_x] == 0x00) {
+                row |= 0x80 >> cell_x;
             }
-            printf("\n");
         }
+    #endif
 
-        printf("\n");
-        glyph_iter += 1;
+        mask |= row << (cell_y * 8);
     }
+
+    return mask;
 }
 
-void glyphs_export_as_c_array(Glyph const *glyphs, isize glyph_count, FILE *output_file) {
-    fprintf(
-        output_file,
-        "// Generated file. Do not edit manually.\n"
-        "\n"
-        "#include <stdint.h>\n"
-        "\n"
-        "#define %s_glyph_width %d\n"
-        "#define %s_glyph_height %d\n"
-        "#define %s_glyph_count %ld\n"
-        "\n"
-        "static struct {\n"
-        "    uint32_t char_code;\n"
-        "    char const *char_data;\n"
-        "    uint32_t bitmap[%s_glyph_width * %s_glyph_height];\n"
-        "} %s_glyphs[%s_glyph_count] = {\n",
-        FONT_NAME, GLYPH_WIDTH * FONT_SCALE,
-        FONT_NAME, GLYPH_HEIGHT * FONT_SCALE,
-        FONT_NAME, glyph_count,
-        FONT_NAME, FONT_NAME,
-        FONT_NAME, FONT_NAME
-    );
+// Fills the scaled RGBA bitmap of the glyph from its rows.
+void glyph_expand_bitmap(Glyph *glyph, isize scale, u32 ink_color, u32 background_color) {
+    isize bitmap_width = GLYPH_WIDTH * scale;
+    u32 *line = glyph->bitmap;
 
-    Glyph const *glyph_iter = glyphs;
-    Glyph const *glyphs_end = glyphs + glyph_count;
-    while (glyph_iter != glyphs_end) {
-        // 1 byte for backslash + 4 bytes for UTF-8 char + 1 byte for null terminator
-        char escaped_char_data[6];
-        {
-            char *escaped_char_iter = escaped_char_data;
-            if (glyph_iter->char_code == '"' || glyph_iter->char_code == '\\') {
-                *escaped_char_iter = '\\';
-                escaped_char_iter += 1;
-            }
-            strcpy(escaped_char_iter, glyph_iter->char_data);
-        }
-
-        fprintf(
-            output_file,
-            "    {\n"
-            "        .char_code = %#x,\n"
-            "        .char_data = \"%s\",\n"
-            "        .bitmap = {\n",
-            glyph_iter->char_code,
-            escaped_char_data
-        );
+    for (isize glyph_y = 0; glyph_y < GLYPH_HEIGHT; glyph_y += 1) {
+        u8 row = glyph->rows[glyph_y];
 
-        for (isize glyph_y = 0; glyph_y < GLYPH_HEIGHT * FONT_SCALE; glyph_y += 1) {
-            fprintf(output_file, "           ");
-            for (isize glyph_x = 0; glyph_x < GLYPH_WIDTH * FONT_SCALE; glyph_x += 1) {
-                isize index = glyph_y * (GLYPH_WIDTH * FONT_SCALE) + glyph_x;
-                fprintf(output_file, " 0x%08x,", glyph_iter->bitmap[index]);
+        for (isize glyph_x = 0; glyph_x < GLYPH_WIDTH; glyph_x += 1) {
+            u32 is_set_mask = 0u - (u32)((row >> (7 - glyph_x)) & 1);
+            u32 color = background_color ^ ((ink_color ^ background_color) & is_set_mask);
+            for (isize pixel_x = 0; pixel_x < scale; pixel_x += 1) {
+                line[glyph_x * scale + pixel_x] = color;
             }
-            fprintf(output_file, "\n");
         }
 
-        fprintf(
-            output_file,
-            "        },\n"
-            "    },\n"
-        );
-
-        glyph_iter += 1;
+        for (isize pixel_y = 1; pixel_y < scale; pixel_y += 1) {
+            memcpy(line + pixel_y * bitmap_width, line, (size_t)(bitmap_width * sizeof(u32)));
+        }
+        line += scale * bitmap_width;
     }
+}
 
-    fprintf(output_file, "};\n");
-    fflush(output_file);
+// Bytes per pixel, 1bpp takes a byte for up to 8 pixels (see pixel_format_row_size).
+isize pixel_format_pixel_size(PixelFormat format) {
+    switch (format) {
+    case PIXEL_FORMAT_1BPP: return 1;
+    case PIXEL_FORMAT_A8: return 1;
+    case PIXEL_FORMAT_RGB565: return 2;
+    case PIXEL_FORMAT_RGBA8888: return 4;
+    case PIXEL_FORMAT_BGRA8888: return 4;
+    case PIXEL_FORMAT_ARGB8888_PREMULTIPLIED: return 4;
+    default: UNREACHABLE(); return 0;
+    }
 }
 
-#define ARENA_CAPACITY (64 * 1024 * 1024)
+isize pixel_format_row_size(PixelFormat format, isize width) {
+    return format == PIXEL_FORMAT_1BPP ? (width + 7) / 8 : width * pixel_format_pixel_size(format);
+}
 
-int main(void) {
-    u8 *arena_memory = malloc(ARENA_CAPACITY);
-    if (arena_memory == NULL) {
-        LOG_ERROR("Failed to allocate the arena.");
-        return 1;
-    }
-    Arena arena = {arena_memory, arena_memory + ARENA_CAPACITY};
+// Converts a color of the bitmaps into a pixel of any format but 1bpp. The byte formats are returned
+// as the little-endian word of their bytes.
+u32 pixel_convert(u32 color, PixelFormat format) {
+    u32 red = color & 0xff;
+    u32 green = (color >> 8) & 0xff;
+    u32 blue = (color >> 16) & 0xff;
+    u32 alpha = color >> 24;
 
-    String font_chars = {0};
-    if (!file_read_to_string("./res/font8x8.txt", &font_chars, &arena)) {
-        LOG_ERROR("Failed to load font chars from the file.");
-        return 1;
+    switch (format) {
+    case PIXEL_FORMAT_A8: return alpha;
+    case PIXEL_FORMAT_RGB565: return (red >> 3) << 11 | (green >> 2) << 5 | blue >> 3;
+    case PIXEL_FORMAT_RGBA8888: return color;
+    case PIXEL_FORMAT_BGRA8888: return alpha << 24 | red << 16 | green << 8 | blue;
+    case PIXEL_FORMAT_ARGB8888_PREMULTIPLIED: {
+        // Rounded division by 255.
+        red = (red * alpha + 127) / 255;
+        green = (green * alpha + 127) / 255;
+        blue = (blue * alpha + 127) / 255;
+        return alpha << 24 | red << 16 | green << 8 | blue;
     }
-    if (!utf8_validate(as_string_view(font_chars))) {
-        LOG_ERROR("Failed to load font chars due to invalid UTF-8.");
-        return 1;
+    default: UNREACHABLE(); return 0;
     }
+}
 
-    isize font_char_count = 0;
-    {
-        StringView font_char_iter = as_string_view(font_chars);
-        while (font_char_iter.size > 0) {
-            u32 char_code;
-            utf8_chop_char(&font_char_iter, &char_code);
-            if (!char_is_space(char_code)) {
-                font_char_count += 1;
+// Converts rows of the bitmap colors into rows of pixel_format_row_size bytes.
+void pixels_encode(u32 const *colors, isize width, isize height, PixelFormat format, u32 ink_color, u8 *output) {
+    isize pixel_size = pixel_format_pixel_size(format);
+    isize row_size = pixel_format_row_size(format, width);
+
+    for (isize y = 0; y < height; y += 1) {
+        u32 const *line = colors + y * width;
+        u8 *output_line = output + y * row_size;
+
+        if (format == PIXEL_FORMAT_1BPP) {
+            memset(output_line, 0, (size_t)row_size);
+            for (isize x = 0; x < width; x += 1) {
+                if (line[x] == ink_color) {
+                    output_line[x / 8] |= (u8)(0x80 >> (x % 8));
+                }
+            }
+            continue;
+        }
+
+        for (isize x = 0; x < width; x += 1) {
+            u32 pixel = pixel_convert(line[x], format);
+            u8 *output_pixel = output_line + x * pixel_size;
+
+            if (format == PIXEL_FORMAT_RGB565) {
+                u16 word = (u16)pixel;
+                memcpy(output_pixel, &word, sizeof(word));
+            } else if (format == PIXEL_FORMAT_ARGB8888_PREMULTIPLIED) {
+                memcpy(output_pixel, &pixel, sizeof(pixel));
+            } else {
+                for (isize i = 0; i < pixel_size; i += 1) {
+                    output_pixel[i] = (u8)(pixel >> (i * 8));
+                }
             }
         }
     }
-    // +1 for the whitespace character.
-    font_char_count += 1;
-
-    struct {
-        int width;
-        int height;
-        int bytes_per_color;
-        u8 *data;
-    } font;
-
-    font.data = stbi_load(
-        "./res/font8x8.png",
-        &font.width,
-        &font.height,
-        &font.bytes_per_color,
-        0
-    );
-    if (font.data == NULL) {
-        LOG_ERROR("Failed to load font glyphs from the file.");
-        return 1;
+}
+
+// Assigns bitmap indices to the glyphs, so that the exporters can write every distinct bitmap once,
+// links the glyphs of each bitmap and returns the bitmap count. The scaled bitmaps are made from the
+// rows, so comparing rows is enough.
+isize glyphs_dedup_bitmaps(Glyph *glyphs, isize glyph_count, Arena *arena) {
+    Arena temp_arena = *arena;
+    // By bitmap index, the bitmaps are never more than the glyphs.
+    isize *last_glyph_indices = arena_alloc(&temp_arena, glyph_count * sizeof(isize));
+
+    // Open addressing with the load factor of at most 1/2, slots keep glyph indices + 1.
+    isize slot_count = 1;
+    while (slot_count < glyph_count * 2) {
+        slot_count *= 2;
     }
-    if (font.width % GLYPH_WIDTH != 0 || font.height % GLYPH_HEIGHT != 0) {
-        LOG_ERROR("Font bitmap dimensions are not divisble by the glyph dimensions.");
-        return 1;
+    isize *slots = arena_alloc(&temp_arena, slot_count * sizeof(isize));
+    memset(slots, 0, (size_t)(slot_count * sizeof(isize)));
+
+    isize bitmap_count = 0;
+    for (isize glyph_index = 0; glyph_index < glyph_count; glyph_index += 1) {
+        Glyph *glyph = &glyphs[glyph_index];
+
+        u64 mask = 0;
+        memcpy(&mask, glyph->rows, sizeof(glyph->rows));
+        isize slot = (isize)((mask * 0x9e3779b97f4a7c15) >> 32) & (slot_count - 1);
+
+        while (slots[slot] != 0 && memcmp(glyphs[slots[slot] - 1].rows, glyph->rows, sizeof(glyph->rows)) != 0) {
+            slot = (slot + 1) & (slot_count - 1);
+        }
+
+        glyph->next_glyph_index = -1;
+        if (slots[slot] == 0) {
+            slots[slot] = glyph_index + 1;
+            glyph->bitmap_index = bitmap_count;
+            bitmap_count += 1;
+        } else {
+            glyph->bitmap_index = glyphs[slots[slot] - 1].bitmap_index;
+            glyphs[last_glyph_indices[glyph->bitmap_index]].next_glyph_index = glyph_index;
+        }
+        last_glyph_indices[glyph->bitmap_index] = glyph_index;
     }
 
-    Glyph *glyphs = arena_alloc(&arena, font_char_count * sizeof(Glyph));
-    Glyph *glyph_iter = glyphs;
-    Glyph *glyphs_end = glyphs + font_char_count;
+    return bitmap_count;
+}
 
-    StringView font_char_iter = as_string_view(font_chars);
+// Bitmaps are numbered in the order of their first glyph, so the glyph is the first one, if its
+// bitmap index is the count of the bitmaps seen before it.
+isize glyphs_bitmap_count(Glyph const *glyphs, isize glyph_count) {
+    isize bitmap_count = 0;
+    for (isize glyph_index = 0; glyph_index < glyph_count; glyph_index += 1) {
+        if (glyphs[glyph_index].bitmap_index == bitmap_count) {
+            bitmap_count += 1;
+        }
+    }
+    return bitmap_count;
+}
 
-    for (isize font_grid_y = 0; font_grid_y < font.height; font_grid_y += GLYPH_HEIGHT) {
-        for (isize font_grid_x = 0; font_grid_x < font.width; font_grid_x += GLYPH_WIDTH) {
-            isize font_data_index = font_grid_y * font.width + font_grid_x;
+// The first glyph of each bitmap, by bitmap index.
+isize *glyphs_find_bitmap_glyph_indices(Glyph const *glyphs, isize glyph_count, isize bitmap_count, Arena *arena) {
+    isize *bitmap_glyph_indices = arena_alloc(arena, bitmap_count * sizeof(isize));
+    isize seen_bitmap_count = 0;
+    for (isize glyph_index = 0; glyph_index < glyph_count; glyph_index += 1) {
+        if (glyphs[glyph_index].bitmap_index == seen_bitmap_count) {
+            bitmap_glyph_indices[seen_bitmap_count] = glyph_index;
+            seen_bitmap_count += 1;
+        }
+    }
+    return bitmap_glyph_indices;
+}
 
-            bool glyph_is_empty = true;
-            {
-                u8 *glyph_line_start = &font.data[font_data_index * font.bytes_per_color];
-
-                for (isize glyph_y = 0; glyph_is_empty && glyph_y < GLYPH_HEIGHT; glyph_y += 1) {
-                    for (isize glyph_x = 0; glyph_is_empty && glyph_x < GLYPH_WIDTH; glyph_x += 1) {
-                        u8 color = glyph_line_start[glyph_x * font.bytes_per_color];
-                        if (color == 0x00) {
-                            glyph_is_empty = false;
-                        }
-                    }
+#define BUFFERED_WRITER_CAPACITY (64 * 1024)
 
-                    glyph_line_start += font.width * font.bytes_per_color;
-                }
-            }
+// Collects the output in a buffer and writes it to the file only once the buffer is full. Growable
+// writers keep the whole output in the arena instead and write it with a single fwrite on flush.
+typedef struct {
+    FILE *file;
+    u8 *data;
+    isize size;
+    isize capacity;
+    // NULL for the writers with a fixed buffer.
+    Arena *arena;
+    bool has_failed;
+} BufferedWriter;
 
-            if (!glyph_is_empty) {
-                if (glyph_iter == glyphs_end) {
-                    LOG_ERROR("There are more glyphs in the bitmap than chars in the text file.");
-                    return 1;
-                }
+BufferedWriter buffered_writer_make(FILE *file, Arena *arena) {
+    return (BufferedWriter){
+        .file = file,
+        .data = arena_alloc(arena, BUFFERED_WRITER_CAPACITY),
+        .size = 0,
+        .capacity = BUFFERED_WRITER_CAPACITY,
+        .arena = NULL,
+        .has_failed = false,
+    };
+}
 
-                u32 char_code;
-                StringView char_data;
-                do {
-                    char_data = utf8_chop_char(&font_char_iter, &char_code);
-                } while (char_is_space(char_code));
+// The buffer grows in place as long as nothing else is allocated from the arena in the meantime.
+BufferedWriter buffered_writer_make_growable(FILE *file, Arena *arena) {
+    BufferedWriter writer = buffered_writer_make(file, arena);
+    writer.arena = arena;
+    return writer;
+}
 
-                glyph_iter->char_code = char_code;
+// Returns false, if any of the writes since the writer was made have failed.
+bool buffered_writer_flush(BufferedWriter *writer) {
+    if (writer->size > 0 && !writer->has_failed) {
+        if (fwrite(writer->data, 1, (size_t)writer->size, writer->file) != (size_t)writer->size) {
+            writer->has_failed = true;
+        }
+    }
+    writer->size = 0;
 
-                glyph_iter->char_data = arena_alloc_aligned(&arena, char_data.size + 1, 1);
-                memcpy(glyph_iter->char_data, char_data.data, (size_t)char_data.size);
-                glyph_iter->char_data[char_data.size] = 0;
+    if (fflush(writer->file) != 0) {
+        writer->has_failed = true;
+    }
+    return !writer->has_failed;
+}
 
-                glyph_iter->bitmap = arena_alloc_aligned(
-                    &arena,
-                    (GLYPH_WIDTH * FONT_SCALE) * (GLYPH_HEIGHT * FONT_SCALE) * sizeof(u32),
-                    4
-                );
+// Makes sure that there is room for size more bytes, returns false if it's not possible.
+bool buffered_writer_reserve(BufferedWriter *writer, isize size) {
+    if (writer->size + size <= writer->capacity) {
+        return true;
+    }
 
-                u8 *glyph_line_start = &font.data[font_data_index * font.bytes_per_color];
-
-                for (isize glyph_y = 0; glyph_y < GLYPH_HEIGHT; glyph_y += 1) {
-                    for (isize glyph_x = 0; glyph_x < GLYPH_WIDTH; glyph_x += 1) {
-                        u8 color = glyph_line_start[glyph_x * font.bytes_per_color];
-
-                        for (isize pixel_y = 0; pixel_y < FONT_SCALE; pixel_y += 1) {
-                            for (isize pixel_x = 0; pixel_x < FONT_SCALE; pixel_x += 1) {
-                                isize index =
-                                    (glyph_y * FONT_SCALE + pixel_y) * (GLYPH_WIDTH * FONT_SCALE) +
-                                    (glyph_x * FONT_SCALE + pixel_x);
-
-                                if (color == 0x00) {
-                                    glyph_iter->bitmap[index] = 0xffffffff;
-                                } else {
-                                    glyph_iter->bitmap[index] = 0x00000000;
-                                }
-                            }
-                        }
-                    }
+    if (writer->arena != NULL) {
+        isize new_capacity = writer->capacity;
+        while (writer->size + size > new_capacity) {
+            new_capacity *= 2;
+        }
+        writer->data = arena_realloc(writer->arena, writer->data, writer->capacity, new_capacity);
+        writer->capacity = new_capacity;
+        return true;
+    }
 
-                    glyph_line_start += font.width * font.bytes_per_color;
-                }
+    buffered_writer_flush(writer);
+    return size <= writer->capacity;
+}
 
-                glyph_iter += 1;
-            }
+void buffered_writer_write(BufferedWriter *writer, void const *data, isize size) {
+    if (!buffered_writer_reserve(writer, size)) {
+        if (!writer->has_failed && fwrite(data, 1, (size_t)size, writer->file) != (size_t)size) {
+            writer->has_failed = true;
         }
+        return;
     }
 
-    // Add the whitespace character.
-    glyph_iter->char_code = 0x0020;
-    glyph_iter->char_data = " ";
-    glyph_iter->bitmap = arena_alloc_aligned(
-        &arena,
-        (GLYPH_WIDTH * FONT_SCALE) * (GLYPH_HEIGHT * FONT_SCALE) * sizeof(u32),
-        4
-    );
-    for (isize i = 0; i < (GLYPH_WIDTH * FONT_SCALE) * (GLYPH_HEIGHT * FONT_SCALE); i += 1) {
-        glyph_iter->bitmap[i] = 0x00000000;
+    memcpy(writer->data + writer->size, data, (size_t)size);
+    writer->size += size;
+}
+
+void buffered_writer_write_cstring(BufferedWriter *writer, char const *string) {
+    buffered_writer_write(writer, string, (isize)strlen(string));
+}
+
+// For the things, which are not worth a dedicated function (floats and such).
+void buffered_writer_write_format(BufferedWriter *writer, char const *format, ...) {
+    va_list args;
+    va_start(args, format);
+    int size = vsnprintf(NULL, 0, format, args);
+    va_end(args);
+
+    if (size < 0) {
+        writer->has_failed = true;
+        return;
+    }
+    // +1 for the null terminator, which vsnprintf always writes.
+    if (!buffered_writer_reserve(writer, size + 1)) {
+        writer->has_failed = true;
+        return;
     }
-    glyph_iter += 1;
 
-    if (glyph_iter != glyphs_end) {
-        LOG_ERROR("There are more chars in the text file than glyphs in the bitmap.");
-        return 1;
+    va_start(args, format);
+    vsnprintf((char *)writer->data + writer->size, (size_t)(size + 1), format, args);
+    va_end(args);
+    writer->size += size;
+}
+
+void buffered_writer_write_i64(BufferedWriter *writer, i64 value) {
+    // 19 digits of INT64_MAX + 1 byte for the minus sign.
+    char digits[20];
+    char *digits_end = digits + sizeof(digits);
+    char *digits_iter = digits_end;
+
+    // Negative modulo keeps INT64_MIN from overflowing.
+    bool is_negative = value < 0;
+    do {
+        i64 digit = value % 10;
+        digits_iter -= 1;
+        *digits_iter = (char)('0' + (digit < 0 ? -digit : digit));
+        value /= 10;
+    } while (value != 0);
+
+    if (is_negative) {
+        digits_iter -= 1;
+        *digits_iter = '-';
     }
 
-    qsort(glyphs, (size_t)(glyphs_end - glyphs), sizeof(Glyph), glyph_compare);
+    buffered_writer_write(writer, digits_iter, digits_end - digits_iter);
+}
 
-    FILE *output_file = fopen("./out/font8x8.c", "wb");
-    if (output_file == NULL) {
-        LOG_ERROR("Failed to open an output file.");
-        return 1;
+// Two hex digits for each byte value.
+static char hex_byte_digits[2][256 * 2];
+static once_flag hex_byte_digits_once_flag = ONCE_FLAG_INIT;
+
+void hex_byte_digits_fill(void) {
+    static char const hex_digits[2][16] = {"0123456789abcdef", "0123456789ABCDEF"};
+
+    for (isize letter_case = 0; letter_case < 2; letter_case += 1) {
+        for (isize byte = 0; byte < 256; byte += 1) {
+            hex_byte_digits[letter_case][byte * 2 + 0] = hex_digits[letter_case][byte >> 4];
+            hex_byte_digits[letter_case][byte * 2 + 1] = hex_digits[letter_case][byte & 0xf];
+        }
     }
-    glyphs_export_as_c_array(glyphs, glyphs_end - glyphs, output_file);
-    fclose(output_file);
+}
 
-    return 0;
+// Two hex digits for each byte value. Filled once, since the fonts are converted on several threads.
+char const *hex_digits_for_bytes(bool is_upper_case) {
+    call_once(&hex_byte_digits_once_flag, hex_byte_digits_fill);
+    return hex_byte_digits[is_upper_case ? 1 : 0];
+}
+
+// Writes at least min_digit_count hex digits (no prefix) of the value, like %0*x or %0*X would.
+void buffered_writer_write_hex(BufferedWriter *writer, u64 value, isize min_digit_count, bool is_upper_case) {
+    static char const hex_digits[2][16] = {"0123456789abcdef", "0123456789ABCDEF"};
+
+    char digits[16];
+    assert(min_digit_count > 0 && min_digit_count <= sizeof(digits));
+    char *digits_end = digits + sizeof(digits);
+    char *digits_iter = digits_end;
+    do {
+        digits_iter -= 1;
+        *digits_iter = hex_digits[is_upper_case ? 1 : 0][value & 0xf];
+        value >>= 4;
+    } while (value != 0 || digits_end - digits_iter < min_digit_count);
+
+    buffered_writer_write(writer, digits_iter, digits_end - digits_iter);
+}
+
+// Writes " 0x%08x," for each word.
+void buffered_writer_write_c_hex_u32s(BufferedWriter *writer, u32 const *words, isize word_count) {
+    char const *hex_bytes = hex_digits_for_bytes(false);
+
+    if (!buffered_writer_reserve(writer, word_count * 12)) {
+        writer->has_failed = true;
+        return;
+    }
+
+    char *output = (char *)writer->data + writer->size;
+    for (isize i = 0; i < word_count; i += 1) {
+        u32 word = words[i];
+        memcpy(output, " 0x", 3);
+        memcpy(output + 3, &hex_bytes[(word >> 24) * 2], 2);
+        memcpy(output + 5, &hex_bytes[((word >> 16) & 0xff) * 2], 2);
+        memcpy(output + 7, &hex_bytes[((word >> 8) & 0xff) * 2], 2);
+        memcpy(output + 9, &hex_bytes[(word & 0xff) * 2], 2);
+        output[11] = ',';
+        output += 12;
+    }
+    writer->size += word_count * 12;
+}
+
+isize hardware_thread_count(void) {
+#if defined(_SC_NPROCESSORS_ONLN)
+    long thread_count = sysconf(_SC_NPROCESSORS_ONLN);
+    return thread_count > 0 ? thread_count : 1;
+#else
+    return 1;
+#endif
+}
+
+// Glyphs of the exporters are encoded in chunks of EXPORT_CHUNK_ITEM_COUNT items, which are spread
+// across threads once there are at least two of them. Each chunk goes into a buffer of its own, the
+// buffers are then written in order, so the file is the same as if the items were written one by one.
+#define EXPORT_CHUNK_ITEM_COUNT 256
+#define EXPORT_THREAD_MAX_COUNT 16
+// Buffers per writev call.
+#define EXPORT_WRITE_BATCH_COUNT 64
+
+// Writes the items from item_begin up to item_end.
+typedef void ChunkEncode(void const *context, isize item_begin, isize item_end, BufferedWriter *writer);
+
+typedef struct {
+    ChunkEncode *encode;
+    void const *context;
+    isize item_count;
+    isize chunk_count;
+    BufferedWriter *chunk_writers;
+    atomic_long next_chunk_index;
+} ChunkTask;
+
+typedef struct {
+    ChunkTask *task;
+    // A slice of the arena of the export, the chunk buffers grow in it.
+    Arena arena;
+} ChunkWorker;
+
+int chunk_worker_run(void *argument) {
+    ChunkWorker *worker = argument;
+    ChunkTask *task = worker->task;
+
+    while (true) {
+        isize chunk_index = atomic_fetch_add(&task->next_chunk_index, 1);
+        if (chunk_index >= task->chunk_count) {
+            break;
+        }
+
+        isize item_begin = chunk_index * EXPORT_CHUNK_ITEM_COUNT;
+        isize item_end = item_begin + EXPORT_CHUNK_ITEM_COUNT;
+        item_end = item_end < task->item_count ? item_end : task->item_count;
+        BufferedWriter *chunk_writer = &task->chunk_writers[chunk_index];
+        *chunk_writer = buffered_writer_make_growable(NULL, &worker->arena);
+        task->encode(task->context, item_begin, item_end, chunk_writer);
+    }
+
+    return 0;
+}
+
+// Writes out what is buffered in the writer, followed by the chunks. Where there is writev, all of it
+// goes in one call (or one per EXPORT_WRITE_BATCH_COUNT buffers) past the buffer of the file.
+void buffered_writer_write_chunks(BufferedWriter *writer, BufferedWriter const *chunk_writers, isize chunk_count) {
+    if (writer->has_failed) {
+        return;
+    }
+    for (isize i = 0; i < chunk_count; i += 1) {
+        if (chunk_writers[i].has_failed) {
+            writer->has_failed = true;
+            return;
+        }
+    }
+
+#if defined(EXPORT_WRITEV)
+    if (fflush(writer->file) != 0) {
+        writer->has_failed = true;
+        return;
+    }
+    int fd = fileno(writer->file);
+
+    // Buffer 0 is the one of the writer, the chunks follow.
+    isize buffer_index = 0;
+    isize buffer_offset = 0;
+    while (buffer_index <= chunk_count) {
+        struct iovec batch[EXPORT_WRITE_BATCH_COUNT];
+        int batch_count = 0;
+        for (isize i = buffer_index; i <= chunk_count && batch_count < EXPORT_WRITE_BATCH_COUNT; i += 1) {
+            BufferedWriter const *source = i == 0 ? writer : &chunk_writers[i - 1];
+            isize offset = i == buffer_index ? buffer_offset : 0;
+            if (source->size > offset) {
+                batch[batch_count] = (struct iovec){source->data + offset, (size_t)(source->size - offset)};
+                batch_count += 1;
+            }
+        }
+        if (batch_count == 0) {
+            break;
+        }
+
+        ssize_t written_size = writev(fd, batch, batch_count);
+        if (written_size < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            writer->has_failed = true;
+            return;
+        }
+
+        // Short writes stop anywhere, also in the middle of a buffer.
+        while (buffer_index <= chunk_count) {
+            BufferedWriter const *source = buffer_index == 0 ? writer : &chunk_writers[buffer_index - 1];
+            isize size_left = source->size - buffer_offset;
+            if (written_size < size_left) {
+                buffer_offset += written_size;
+                break;
+            }
+            written_size -= size_left;
+            buffer_index += 1;
+            buffer_offset = 0;
+        }
+    }
+
+    // The file position of the stream has to follow the descriptor for the writes and ftell after this.
+    off_t position = lseek(fd, 0, SEEK_CUR);
+    if (position < 0 || fseeko(writer->file, position, SEEK_SET) != 0) {
+        writer->has_failed = true;
+    }
+#else
+    if (writer->size > 0 && fwrite(writer->data, 1, (size_t)writer->size, writer->file) != (size_t)writer->size) {
+        writer->has_failed = true;
+    }
+    for (isize i = 0; i < chunk_count && !writer->has_failed; i += 1) {
+        BufferedWriter const *chunk_writer = &chunk_writers[i];
+        if (fwrite(chunk_writer->data, 1, (size_t)chunk_writer->size, writer->file) != (size_t)chunk_writer->size) {
+            writer->has_failed = true;
+        }
+    }
+#endif
+    writer->size = 0;
+}
+
+// Encodes item_count items into the writer, in chunks across threads if there are enough of them.
+// The threads get equal slices of what is left in the arena.
+void buffered_writer_write_in_chunks(
+    BufferedWriter *writer,
+    ChunkEncode *encode,
+    void const *context,
+    isize item_count,
+    Arena *arena
+) {
+    isize chunk_count = (item_count + EXPORT_CHUNK_ITEM_COUNT - 1) / EXPORT_CHUNK_ITEM_COUNT;
+    isize thread_count = hardware_thread_count();
+    thread_count = thread_count < EXPORT_THREAD_MAX_COUNT ? thread_count : EXPORT_THREAD_MAX_COUNT;
+    thread_count = thread_count < chunk_count ? thread_count : chunk_count;
+    if (thread_count <= 1) {
+        encode(context, 0, item_count, writer);
+        return;
+    }
+
+    Arena temp_arena = *arena;
+    ChunkTask task = {
+        .encode = encode,
+        .context = context,
+        .item_count = item_count,
+        .chunk_count = chunk_count,
+        .chunk_writers = arena_alloc(&temp_arena, chunk_count * sizeof(BufferedWriter)),
+    };
+    atomic_init(&task.next_chunk_index, 0);
+
+    isize slice_size = (temp_arena.end - temp_arena.begin) / thread_count;
+    slice_size &= ~(isize)(ARENA_DEFAULT_ALIGNMENT - 1);
+    ChunkWorker workers[EXPORT_THREAD_MAX_COUNT];
+    thrd_t threads[EXPORT_THREAD_MAX_COUNT];
+    for (isize i = 0; i < thread_count; i += 1) {
+        u8 *slice_begin = temp_arena.begin + i * slice_size;
+        workers[i] = (ChunkWorker){.task = &task, .arena = {slice_begin, slice_begin + slice_size}};
+    }
+
+    // The current thread is the first worker, whatever couldn't be started is done by the rest.
+    isize started_thread_count = 1;
+    while (started_thread_count < thread_count) {
+        if (thrd_create(&threads[started_thread_count], chunk_worker_run, &workers[started_thread_count]) != thrd_success) {
+            break;
+        }
+        started_thread_count += 1;
+    }
+    chunk_worker_run(&workers[0]);
+    for (isize i = 1; i < started_thread_count; i += 1) {
+        thrd_join(threads[i], NULL);
+    }
+
+    // What the other threads used of their slices counts into the high water mark of this thread, as if
+    // it was allocated right after the slice of the first worker.
+    u8 *high_water = workers[0].arena.begin;
+    for (isize i = 1; i < started_thread_count; i += 1) {
+        high_water += workers[i].arena.begin - (temp_arena.begin + i * slice_size);
+    }
+    if ((uptr)high_water > (uptr)arena_high_water) {
+        arena_high_water = high_water;
+    }
+
+    buffered_writer_write_chunks(writer, task.chunk_writers, chunk_count);
+
+    // The slices of the other threads lie past the high water mark, so releasing the pages of the job
+    // (see arena_used_part) wouldn't reach them.
+    for (isize i = 1; i < started_thread_count; i += 1) {
+        Arena used_slice = {temp_arena.begin + i * slice_size, workers[i].arena.begin};
+        arena_release_pages(&used_slice);
+    }
+}
+
+// Unicode quadrant blocks indexed by the set pixels of a 2x2 square: 1 is the upper left, 2 the upper
+// right, 4 the lower left and 8 the lower right pixel.
+static char const *const preview_quadrants[16] = {
+    " ", "\u2598", "\u259d", "\u2580", "\u2596", "\u258c", "\u259e", "\u259b",
+    "\u2597", "\u259a", "\u2590", "\u259c", "\u2584", "\u2599", "\u259f", "\u2588",
+};
+
+#define PREVIEW_CELL_WIDTH (GLYPH_WIDTH / 2)
+#define PREVIEW_CELL_HEIGHT (GLYPH_HEIGHT / 2)
+
+// Draws the glyphs at the native size in a grid of column_count glyphs per row, with every terminal
+// cell showing 2x2 pixels. Each row of the grid starts with a line of its chars, which is prefixed with
+// the char code of the first one.
+void glyphs_preview(Glyph const *glyphs, isize glyph_count, isize column_count, BufferedWriter *writer) {
+    for (isize row_start = 0; row_start < glyph_count; row_start += column_count) {
+        isize row_end = row_start + column_count < glyph_count ? row_start + column_count : glyph_count;
+
+        buffered_writer_write_cstring(writer, "U+");
+        buffered_writer_write_hex(writer, glyphs[row_start].char_code, 6, true);
+        for (isize i = row_start; i < row_end; i += 1) {
+            buffered_writer_write_cstring(writer, "  ");
+            buffered_writer_write_cstring(writer, glyphs[i].char_data);
+            buffered_writer_write_cstring(writer, "  ");
+        }
+        buffered_writer_write_cstring(writer, "\n");
+
+        for (isize cell_y = 0; cell_y < PREVIEW_CELL_HEIGHT; cell_y += 1) {
+            buffered_writer_write_cstring(writer, "        ");
+            for (isize i = row_start; i < row_end; i += 1) {
+                u8 top_row = glyphs[i].rows[cell_y * 2];
+                u8 bottom_row = glyphs[i].rows[cell_y * 2 + 1];
+
+                buffered_writer_write_cstring(writer, " ");
+                for (isize cell_x = 0; cell_x < PREVIEW_CELL_WIDTH; cell_x += 1) {
+                    isize shift = GLYPH_WIDTH - 2 - cell_x * 2;
+                    isize quadrant =
+                        ((top_row >> (shift + 1)) & 1) << 0 |
+                        ((top_row >> shift) & 1) << 1 |
+                        ((bottom_row >> (shift + 1)) & 1) << 2 |
+                        ((bottom_row >> shift) & 1) << 3;
+                    buffered_writer_write_cstring(writer, preview_quadrants[quadrant]);
+                }
+            }
+            buffered_writer_write_cstring(writer, "\n");
+        }
+    }
+}
+
+// Char codes below this limit (ASCII, Latin-1, Greek and Cyrillic) are mapped to glyph indices with
+// a direct table, the rest of them are put into the range table.
+#define GLYPH_INDEX_DIRECT_LIMIT 0x0500
+// The direct table has at least one glyph per this many entries.
+#define GLYPH_INDEX_DIRECT_MIN_DENSITY 8
+#define GLYPH_INDEX_FALLBACK_CHAR_CODE 0xfffd
+
+bool font_job_includes_char(FontJob const *job, u32 char_code) {
+    if (job->subset_range_count == 0 || char_code == GLYPH_INDEX_FALLBACK_CHAR_CODE) {
+        return true;
+    }
+    for (isize i = 0; i < job->subset_range_count; i += 1) {
+        CharCodeRange range = job->subset_ranges[i];
+        if (range.first_char_code <= char_code && char_code <= range.last_char_code) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Drops the glyphs outside of the job subset keeping the order, returns the new glyph count. Everything
+// after it (the index, bitmap dedup and the exporters) works on what is left.
+isize glyphs_select_subset(FontJob const *job, Glyph *glyphs, isize glyph_count) {
+    isize subset_glyph_count = 0;
+    for (isize glyph_index = 0; glyph_index < glyph_count; glyph_index += 1) {
+        if (font_job_includes_char(job, glyphs[glyph_index].char_code)) {
+            glyphs[subset_glyph_count] = glyphs[glyph_index];
+            subset_glyph_count += 1;
+        }
+    }
+    return subset_glyph_count;
+}
+
+// Builds the tables for font8x8_glyph_index (see font8x8.h), glyphs must be sorted by char code.
+Font8x8Index glyphs_build_index(Glyph const *glyphs, isize glyph_count, Arena *arena) {
+    assert(glyph_count <= UINT16_MAX);
+
+    isize fallback_glyph_index = 0;
+    u32 direct_count = 0;
+    isize direct_glyph_count = 0;
+    for (isize glyph_index = 0; glyph_index < glyph_count; glyph_index += 1) {
+        u32 char_code = glyphs[glyph_index].char_code;
+
+        if (char_code == GLYPH_INDEX_FALLBACK_CHAR_CODE) {
+            fallback_glyph_index = glyph_index;
+        }
+        // Subsets can leave the direct table mostly empty, then the glyphs go into the ranges.
+        bool is_dense_enough = (glyph_index + 1) * GLYPH_INDEX_DIRECT_MIN_DENSITY >= (isize)char_code + 1;
+        if (char_code < GLYPH_INDEX_DIRECT_LIMIT && is_dense_enough) {
+            direct_count = char_code + 1;
+            direct_glyph_count = glyph_index + 1;
+        }
+    }
+
+    u16 *direct_glyph_indices = arena_alloc(arena, direct_count * sizeof(u16));
+    {
+        isize glyph_index = 0;
+        for (u32 char_code = 0; char_code < direct_count; char_code += 1) {
+            // Skips duplicates, so the first glyph with the given char code wins.
+            while (glyphs[glyph_index].char_code < char_code) {
+                glyph_index += 1;
+            }
+
+            direct_glyph_indices[char_code] = (u16)fallback_glyph_index;
+            if (glyphs[glyph_index].char_code == char_code) {
+                direct_glyph_indices[char_code] = (u16)glyph_index;
+            }
+        }
+    }
+
+    // There can't be more ranges than the remaining glyphs.
+    Font8x8Range *ranges = arena_alloc(arena, (glyph_count - direct_glyph_count) * sizeof(Font8x8Range));
+    isize range_count = 0;
+    {
+        isize glyph_index = direct_glyph_count;
+        while (glyph_index < glyph_count) {
+            isize first_glyph_index = glyph_index;
+            glyph_index += 1;
+            while (
+                glyph_index < glyph_count &&
+                glyphs[glyph_index - 1].char_code + 1 == glyphs[glyph_index].char_code
+            ) {
+                glyph_index += 1;
+            }
+            isize char_count = glyph_index - first_glyph_index;
+
+            while (
+                glyph_index < glyph_count &&
+                glyphs[glyph_index - 1].char_code == glyphs[glyph_index].char_code
+            ) {
+                glyph_index += 1;
+            }
+
+            ranges[range_count] = (Font8x8Range){
+                .first_char_code = glyphs[first_glyph_index].char_code,
+                .char_count = (u16)char_count,
+                .first_glyph_index = (u16)first_glyph_index,
+            };
+            range_count += 1;
+        }
+    }
+
+    return (Font8x8Index){
+        .direct_glyph_indices = direct_glyph_indices,
+        .direct_count = direct_count,
+        .ranges = ranges,
+        .range_count = (u16)range_count,
+        .fallback_glyph_index = (u16)fallback_glyph_index,
+    };
+}
+
+// Writes the index built by glyphs_build_index as C arrays.
+void glyphs_export_index(Font8x8Index const *index, char const *name, BufferedWriter *writer) {
+    if (index->direct_count > 0) {
+        buffered_writer_write_format(
+            writer,
+            "\n"
+            "static uint16_t const %s_direct_glyph_indices[%u] = {\n",
+            name, index->direct_count
+        );
+
+        for (u32 char_code = 0; char_code < index->direct_count; char_code += 1) {
+            if (char_code % 16 == 0) {
+                buffered_writer_write_cstring(writer, "   ");
+            }
+            buffered_writer_write_cstring(writer, " ");
+            buffered_writer_write_i64(writer, index->direct_glyph_indices[char_code]);
+            buffered_writer_write_cstring(writer, ",");
+            if (char_code % 16 == 15 || char_code == index->direct_count - 1) {
+                buffered_writer_write_cstring(writer, "\n");
+            }
+        }
+
+        buffered_writer_write_cstring(writer, "};\n");
+    }
+
+    if (index->range_count > 0) {
+        buffered_writer_write_format(
+            writer,
+            "\n"
+            "static Font8x8Range const %s_ranges[] = {\n",
+            name
+        );
+
+        for (isize i = 0; i < index->range_count; i += 1) {
+            Font8x8Range const *range = &index->ranges[i];
+            buffered_writer_write_format(
+                writer,
+                "    {0x%04x, %d, %d},\n",
+                range->first_char_code,
+                range->char_count,
+                range->first_glyph_index
+            );
+        }
+
+        buffered_writer_write_cstring(writer, "};\n");
+    }
+
+    buffered_writer_write_format(
+        writer,
+        "\n"
+        "static Font8x8Index const %s_index = {\n",
+        name
+    );
+    if (index->direct_count > 0) {
+        buffered_writer_write_format(writer, "    .direct_glyph_indices = %s_direct_glyph_indices,\n", name);
+    }
+    buffered_writer_write_format(writer, "    .direct_count = %u,\n", index->direct_count);
+    if (index->range_count > 0) {
+        buffered_writer_write_format(writer, "    .ranges = %s_ranges,\n", name);
+    }
+    buffered_writer_write_format(
+        writer,
+        "    .range_count = %d,\n"
+        "    .fallback_glyph_index = %d,\n"
+        "};\n",
+        index->range_count,
+        index->fallback_glyph_index
+    );
+}
+
+// Writes "U+XXXX 'c', ..." for every glyph with the bitmap of the first glyph, see next_glyph_index.
+void glyphs_write_bitmap_chars(Glyph const *glyphs, isize first_glyph_index, BufferedWriter *writer) {
+    bool is_first = true;
+    for (isize glyph_index = first_glyph_index; glyph_index >= 0; glyph_index = glyphs[glyph_index].next_glyph_index) {
+        Glyph const *glyph = &glyphs[glyph_index];
+        buffered_writer_write_cstring(writer, is_first ? "U+" : ", U+");
+        buffered_writer_write_hex(writer, glyph->char_code, 4, true);
+        buffered_writer_write_cstring(writer, " '");
+        buffered_writer_write_cstring(writer, glyph->char_data);
+        buffered_writer_write_cstring(writer, "'");
+        is_first = false;
+    }
+}
+
+// Writes the body of the char code array, 8 codes per line.
+void glyphs_write_char_codes(Glyph const *glyphs, isize glyph_count, BufferedWriter *writer) {
+    for (isize glyph_index = 0; glyph_index < glyph_count; glyph_index += 1) {
+        if (glyph_index % 8 == 0) {
+            buffered_writer_write_cstring(writer, "   ");
+        }
+        buffered_writer_write_cstring(writer, " 0x");
+        buffered_writer_write_hex(writer, glyphs[glyph_index].char_code, 4, false);
+        buffered_writer_write_cstring(writer, ",");
+        if (glyph_index % 8 == 7 || glyph_index == glyph_count - 1) {
+            buffered_writer_write_cstring(writer, "\n");
+        }
+    }
+}
+
+void glyphs_write_bitmap_indices(Glyph const *glyphs, isize glyph_count, char const *name, BufferedWriter *writer) {
+    buffered_writer_write_format(
+        writer,
+        "\n"
+        "static uint16_t const %s_glyph_bitmap_indices[%s_glyph_count] = {\n",
+        name, name
+    );
+
+    for (isize glyph_index = 0; glyph_index < glyph_count; glyph_index += 1) {
+        if (glyph_index % 16 == 0) {
+            buffered_writer_write_cstring(writer, "   ");
+        }
+        buffered_writer_write_cstring(writer, " ");
+        buffered_writer_write_i64(writer, glyphs[glyph_index].bitmap_index);
+        buffered_writer_write_cstring(writer, ",");
+        if (glyph_index % 16 == 15 || glyph_index == glyph_count - 1) {
+            buffered_writer_write_cstring(writer, "\n");
+        }
+    }
+
+    buffered_writer_write_cstring(writer, "};\n");
+}
+
+// Writes a row of the bitmap colors as the elements of a C array of the pixel format (see
+// pixel_format_c_type).
+void buffered_writer_write_c_hex_pixels(
+    BufferedWriter *writer,
+    u32 const *colors,
+    isize pixel_count,
+    PixelFormat format,
+    u32 ink_color
+) {
+    if (format == PIXEL_FORMAT_RGBA8888) {
+        buffered_writer_write_c_hex_u32s(writer, colors, pixel_count);
+        return;
+    }
+
+    if (format == PIXEL_FORMAT_1BPP) {
+        u8 row[(GLYPH_WIDTH * FONT_SCALE_MAX + 7) / 8];
+        assert(pixel_count <= GLYPH_WIDTH * FONT_SCALE_MAX);
+        pixels_encode(colors, pixel_count, 1, format, ink_color, row);
+        for (isize i = 0; i < pixel_format_row_size(format, pixel_count); i += 1) {
+            buffered_writer_write_cstring(writer, " 0x");
+            buffered_writer_write_hex(writer, row[i], 2, false);
+            buffered_writer_write_cstring(writer, ",");
+        }
+        return;
+    }
+
+    isize digit_count = pixel_format_pixel_size(format) * 2;
+    for (isize i = 0; i < pixel_count; i += 1) {
+        buffered_writer_write_cstring(writer, " 0x");
+        buffered_writer_write_hex(writer, pixel_convert(colors[i], format), digit_count, false);
+        buffered_writer_write_cstring(writer, ",");
+    }
+}
+
+char const *pixel_format_c_type(PixelFormat format) {
+    switch (pixel_format_pixel_size(format)) {
+    case 1: return "uint8_t";
+    case 2: return "uint16_t";
+    case 4: return "uint32_t";
+    default: UNREACHABLE(); return NULL;
+    }
+}
+
+// What the C array chunks are encoded from, see c_array_write_bitmaps and c_array_write_glyphs.
+typedef struct {
+    FontJob const *job;
+    Glyph const *glyphs;
+    isize const *bitmap_glyph_indices;
+    // Where the char of each glyph starts in the char data pool.
+    u32 const *char_data_offsets;
+    PixelFormat pixel_format;
+} CArrayChunkContext;
+
+// Writes the chars of the glyphs as one pool of NUL terminated UTF-8 strings, 8 per line. The glyphs
+// point into it with offsets rather than pointers, so the tables need no relocations when loading.
+void glyphs_write_char_data_pool(Glyph const *glyphs, isize glyph_count, char const *name, BufferedWriter *writer) {
+    buffered_writer_write_format(writer, "static char const %s_char_data[] =\n", name);
+
+    for (isize glyph_index = 0; glyph_index < glyph_count; glyph_index += 1) {
+        Glyph const *glyph = &glyphs[glyph_index];
+        buffered_writer_write_cstring(writer, glyph_index % 8 == 0 ? "    \"" : " \"");
+        if (glyph->char_code == '"' || glyph->char_code == '\\') {
+            buffered_writer_write_cstring(writer, "\\");
+        }
+        buffered_writer_write_cstring(writer, glyph->char_data);
+        // The terminator ends each literal, so that the next char can't be read as a part of its escape.
+        buffered_writer_write_cstring(writer, "\\0\"");
+        if (glyph_index == glyph_count - 1) {
+            buffered_writer_write_cstring(writer, ";\n");
+        } else if (glyph_index % 8 == 7) {
+            buffered_writer_write_cstring(writer, "\n");
+        }
+    }
+}
+
+// ChunkEncode of the bitmaps array.
+void c_array_write_bitmaps(void const *context, isize bitmap_begin, isize bitmap_end, BufferedWriter *writer) {
+    CArrayChunkContext const *c_array = context;
+    FontJob const *job = c_array->job;
+
+    for (isize bitmap_index = bitmap_begin; bitmap_index < bitmap_end; bitmap_index += 1) {
+        Glyph const *glyph = &c_array->glyphs[c_array->bitmap_glyph_indices[bitmap_index]];
+
+        buffered_writer_write_cstring(writer, "    { // ");
+        glyphs_write_bitmap_chars(c_array->glyphs, c_array->bitmap_glyph_indices[bitmap_index], writer);
+        buffered_writer_write_cstring(writer, "\n");
+
+        for (isize glyph_y = 0; glyph_y < GLYPH_HEIGHT * job->scale; glyph_y += 1) {
+            buffered_writer_write_cstring(writer, "       ");
+            buffered_writer_write_c_hex_pixels(
+                writer,
+                &glyph->bitmap[glyph_y * (GLYPH_WIDTH * job->scale)],
+                GLYPH_WIDTH * job->scale,
+                c_array->pixel_format,
+                job->ink_color
+            );
+            buffered_writer_write_cstring(writer, "\n");
+        }
+
+        buffered_writer_write_cstring(writer, "    },\n");
+    }
+}
+
+// ChunkEncode of the glyphs array.
+void c_array_write_glyphs(void const *context, isize glyph_begin, isize glyph_end, BufferedWriter *writer) {
+    CArrayChunkContext const *c_array = context;
+
+    for (isize glyph_index = glyph_begin; glyph_index < glyph_end; glyph_index += 1) {
+        Glyph const *glyph = &c_array->glyphs[glyph_index];
+
+        buffered_writer_write_cstring(writer, "    {\n        .char_code = 0x");
+        buffered_writer_write_hex(writer, glyph->char_code, 1, false);
+        buffered_writer_write_cstring(writer, ",\n        .char_data_offset = ");
+        buffered_writer_write_i64(writer, c_array->char_data_offsets[glyph_index]);
+        buffered_writer_write_cstring(writer, ",\n        .char_data_size = ");
+        buffered_writer_write_i64(writer, (i64)strlen(glyph->char_data));
+        buffered_writer_write_cstring(writer, ",\n        .bitmap_index = ");
+        buffered_writer_write_i64(writer, glyph->bitmap_index);
+        buffered_writer_write_cstring(writer, ",\n    },\n");
+    }
+}
+
+// Renders the file into the arena, the bitmaps and the glyph table in chunks across threads (see
+// buffered_writer_write_in_chunks), and writes it in order.
+bool glyphs_export_as_c_array(FontJob const *job, Glyph const *glyphs, isize glyph_count, FILE *output_file, Arena *arena) {
+    Arena temp_arena = *arena;
+    Font8x8Index index = glyphs_build_index(glyphs, glyph_count, &temp_arena);
+    isize bitmap_count = glyphs_bitmap_count(glyphs, glyph_count);
+    PixelFormat pixel_format = job->pixel_format != PIXEL_FORMAT_DEFAULT ? job->pixel_format : PIXEL_FORMAT_RGBA8888;
+    char const *pixel_c_type = pixel_format_c_type(pixel_format);
+    u32 *char_data_offsets = arena_alloc(&temp_arena, glyph_count * sizeof(u32));
+    isize char_data_size = 0;
+    for (isize glyph_index = 0; glyph_index < glyph_count; glyph_index += 1) {
+        char_data_offsets[glyph_index] = (u32)char_data_size;
+        char_data_size += (isize)strlen(glyphs[glyph_index].char_data) + 1;
+    }
+    CArrayChunkContext context = {
+        .job = job,
+        .glyphs = glyphs,
+        .bitmap_glyph_indices = glyphs_find_bitmap_glyph_indices(glyphs, glyph_count, bitmap_count, &temp_arena),
+        .char_data_offsets = char_data_offsets,
+        .pixel_format = pixel_format,
+    };
+    BufferedWriter writer = buffered_writer_make_growable(output_file, &temp_arena);
+
+    buffered_writer_write_format(
+        &writer,
+        "// Generated file. Do not edit manually.\n"
+        "\n"
+        "#include <stdint.h>\n"
+        "\n"
+        "#include \"font8x8.h\"\n"
+        "\n"
+        "#define %s_glyph_width %d\n"
+        "#define %s_glyph_height %d\n"
+        "#define %s_glyph_count %ld\n"
+        "#define %s_bitmap_count %ld\n"
+        "\n",
+        job->name, GLYPH_WIDTH * job->scale,
+        job->name, GLYPH_HEIGHT * job->scale,
+        job->name, glyph_count,
+        job->name, bitmap_count
+    );
+    if (job->pixel_format != PIXEL_FORMAT_DEFAULT) {
+        buffered_writer_write_format(
+            &writer,
+            "// Pixels are %s, the ink is 0x%08x and the background is 0x%08x (0xAABBGGRR).\n",
+            pixel_format_names[pixel_format], job->ink_color, job->background_color
+        );
+    }
+    buffered_writer_write_format(
+        &writer,
+        pixel_format == PIXEL_FORMAT_1BPP
+            ? "// Glyphs which look the same share a bitmap.\n"
+              "static %s const %s_bitmaps[%s_bitmap_count][(%s_glyph_width + 7) / 8 * %s_glyph_height] = {\n"
+            : "// Glyphs which look the same share a bitmap.\n"
+              "static %s const %s_bitmaps[%s_bitmap_count][%s_glyph_width * %s_glyph_height] = {\n",
+        pixel_c_type, job->name, job->name, job->name, job->name
+    );
+
+    buffered_writer_write_in_chunks(&writer, c_array_write_bitmaps, &context, bitmap_count, &temp_arena);
+
+    buffered_writer_write_cstring(&writer, "};\n\n");
+    glyphs_write_char_data_pool(glyphs, glyph_count, job->name, &writer);
+    buffered_writer_write_format(
+        &writer,
+        "\n"
+        "// The char of a glyph is the C string at &%s_char_data[char_data_offset], its bitmap is\n"
+        "// %s_bitmaps[bitmap_index].\n"
+        "static struct {\n"
+        "    uint32_t char_code;\n"
+        "    uint32_t char_data_offset;\n"
+        "    uint16_t char_data_size;\n"
+        "    uint16_t bitmap_index;\n"
+        "} const %s_glyphs[%s_glyph_count] = {\n",
+        job->name, job->name, job->name, job->name
+    );
+
+    buffered_writer_write_in_chunks(&writer, c_array_write_glyphs, &context, glyph_count, &temp_arena);
+
+    buffered_writer_write_cstring(&writer, "};\n");
+    glyphs_export_index(&index, job->name, &writer);
+    return buffered_writer_flush(&writer);
+}
+
+// Glyph styles are made from the packed rows. Bold smears every row a pixel to the right, italic shears
+// the rows a pixel every STYLE_ITALIC_ROWS_PER_PIXEL rows away from STYLE_ITALIC_BASE_ROW (the last row
+// above the baseline), right above it and left below it, and the lines fill a whole row. Pixels which
+// are moved past the edges of the cell are dropped.
+#define STYLE_ITALIC_ROWS_PER_PIXEL 4
+#define STYLE_ITALIC_BASE_ROW 6
+#define STYLE_UNDERLINE_ROW 7
+#define STYLE_STRIKE_ROW 4
+
+u8 glyph_style_row(u8 const rows[GLYPH_HEIGHT], isize glyph_y, u32 styles) {
+    u8 row = rows[glyph_y];
+
+    if ((styles & GLYPH_STYLE_BOLD) != 0) {
+        row |= (u8)(row >> 1);
+    }
+    if ((styles & GLYPH_STYLE_ITALIC) != 0) {
+        isize base_distance = STYLE_ITALIC_BASE_ROW - glyph_y;
+        if (base_distance >= 0) {
+            row = (u8)(row >> (base_distance / STYLE_ITALIC_ROWS_PER_PIXEL));
+        } else {
+            row = (u8)(row << ((-base_distance + STYLE_ITALIC_ROWS_PER_PIXEL - 1) / STYLE_ITALIC_ROWS_PER_PIXEL));
+        }
+    }
+    if ((styles & GLYPH_STYLE_UNDERLINE) != 0 && glyph_y == STYLE_UNDERLINE_ROW) {
+        row = 0xff;
+    }
+    if ((styles & GLYPH_STYLE_STRIKE) != 0 && glyph_y == STYLE_STRIKE_ROW) {
+        row = 0xff;
+    }
+    return row;
+}
+
+// Writes a plane of rows for every combination of the styles of the job but the regular one, and a
+// font for each plane, all sharing the index and the bitmap indices of the regular font. The styles get
+// consecutive bits in the order of GlyphStyle, so the style bits are the index of the font.
+void glyphs_export_style_planes(
+    FontJob const *job,
+    Glyph const *glyphs,
+    isize const *bitmap_glyph_indices,
+    isize bitmap_count,
+    BufferedWriter *writer
+) {
+    char const *hex_bytes = hex_digits_for_bytes(false);
+    // The index into glyph_style_names of each plane bit.
+    isize plane_styles[GLYPH_STYLE_COUNT];
+    isize plane_style_count = 0;
+
+    buffered_writer_write_cstring(
+        writer,
+        "\n"
+        "// Synthesized styles, the bits are combined into the index of the font in the styled fonts.\n"
+    );
+    for (isize i = 0; i < GLYPH_STYLE_COUNT; i += 1) {
+        if ((job->styles & (1u << i)) != 0) {
+            plane_styles[plane_style_count] = i;
+            buffered_writer_write_format(
+                writer,
+                "#define %s_style_%s %d\n",
+                job->name, glyph_style_names[i], 1 << plane_style_count
+            );
+            plane_style_count += 1;
+        }
+    }
+    isize plane_count = (isize)1 << plane_style_count;
+    buffered_writer_write_format(
+        writer,
+        "#define %s_styled_font_count %ld\n"
+        "\n"
+        "// Rows of the styled fonts after the regular one.\n"
+        "static uint8_t const %s_styled_bitmap_rows[%s_styled_font_count - 1][%s_bitmap_count][%s_glyph_height] = {\n",
+        job->name, plane_count,
+        job->name, job->name, job->name, job->name
+    );
+
+    for (isize plane_index = 1; plane_index < plane_count; plane_index += 1) {
+        u32 styles = 0;
+        buffered_writer_write_cstring(writer, "    { //");
+        for (isize i = 0; i < plane_style_count; i += 1) {
+            if ((plane_index & ((isize)1 << i)) != 0) {
+                styles |= 1u << plane_styles[i];
+                buffered_writer_write_cstring(writer, " ");
+                buffered_writer_write_cstring(writer, glyph_style_names[plane_styles[i]]);
+            }
+        }
+        buffered_writer_write_cstring(writer, "\n");
+
+        for (isize bitmap_index = 0; bitmap_index < bitmap_count; bitmap_index += 1) {
+            Glyph const *glyph = &glyphs[bitmap_glyph_indices[bitmap_index]];
+            buffered_writer_write_cstring(writer, "        {");
+            for (isize glyph_y = 0; glyph_y < GLYPH_HEIGHT; glyph_y += 1) {
+                buffered_writer_write_cstring(writer, glyph_y == 0 ? "0x" : ", 0x");
+                buffered_writer_write(writer, &hex_bytes[glyph_style_row(glyph->rows, glyph_y, styles) * 2], 2);
+            }
+            buffered_writer_write_cstring(writer, "},\n");
+        }
+
+        buffered_writer_write_cstring(writer, "    },\n");
+    }
+
+    buffered_writer_write_format(writer, "};\n\nstatic Font8x8 const %s_styled_fonts[%s_styled_font_count] = {\n", job->name, job->name);
+    for (isize plane_index = 0; plane_index < plane_count; plane_index += 1) {
+        if (plane_index == 0) {
+            buffered_writer_write_format(writer, "    {\n        .bitmap_rows = %s_bitmap_rows,\n", job->name);
+        } else {
+            buffered_writer_write_format(
+                writer,
+                "    {\n        .bitmap_rows = %s_styled_bitmap_rows[%ld],\n",
+                job->name, plane_index - 1
+            );
+        }
+        buffered_writer_write_format(
+            writer,
+            "        .bitmap_count = %s_bitmap_count,\n"
+            "        .glyph_bitmap_indices = %s_glyph_bitmap_indices,\n"
+            "        .glyph_count = %s_glyph_count,\n"
+            "        .index = &%s_index,\n"
+            "    },\n",
+            job->name, job->name, job->name, job->name
+        );
+    }
+    buffered_writer_write_cstring(writer, "};\n");
+}
+
+// Writes glyphs at the native size as 1-bit masks (one byte per row) instead of scaled RGBA bitmaps,
+// so that the scaling and the colors could be applied when drawing.
+bool glyphs_export_as_packed_c_array(
+    FontJob const *job,
+    Glyph const *glyphs,
+    isize glyph_count,
+    FILE *output_file,
+    Arena *arena
+) {
+    Arena temp_arena = *arena;
+    Font8x8Index index = glyphs_build_index(glyphs, glyph_count, &temp_arena);
+    isize bitmap_count = glyphs_bitmap_count(glyphs, glyph_count);
+    isize *bitmap_glyph_indices = NULL;
+    if (job->styles != 0) {
+        bitmap_glyph_indices = glyphs_find_bitmap_glyph_indices(glyphs, glyph_count, bitmap_count, &temp_arena);
+    }
+    BufferedWriter writer = buffered_writer_make_growable(output_file, &temp_arena);
+    char const *hex_bytes = hex_digits_for_bytes(false);
+
+    buffered_writer_write_format(
+        &writer,
+        "// Generated file. Do not edit manually.\n"
+        "\n"
+        "#include <stdint.h>\n"
+        "\n"
+        "#include \"font8x8.h\"\n"
+        "\n"
+        "#define %s_glyph_width %d\n"
+        "#define %s_glyph_height %d\n"
+        "#define %s_glyph_count %ld\n"
+        "#define %s_bitmap_count %ld\n"
+        "\n"
+        "static uint32_t const %s_char_codes[%s_glyph_count] = {\n",
+        job->name, GLYPH_WIDTH,
+        job->name, GLYPH_HEIGHT,
+        job->name, glyph_count,
+        job->name, bitmap_count,
+        job->name, job->name
+    );
+
+    glyphs_write_char_codes(glyphs, glyph_count, &writer);
+
+    buffered_writer_write_format(
+        &writer,
+        "};\n"
+        "\n"
+        "// One byte per row, the most significant bit is the leftmost pixel. Glyphs which look the same\n"
+        "// share a bitmap.\n"
+        "static uint8_t const %s_bitmap_rows[%s_bitmap_count][%s_glyph_height] = {\n",
+        job->name, job->name, job->name
+    );
+
+    isize written_bitmap_count = 0;
+    for (isize glyph_index = 0; glyph_index < glyph_count; glyph_index += 1) {
+        Glyph const *glyph = &glyphs[glyph_index];
+        if (glyph->bitmap_index != written_bitmap_count) {
+            continue;
+        }
+
+        buffered_writer_write_cstring(&writer, "    {");
+        for (isize glyph_y = 0; glyph_y < GLYPH_HEIGHT; glyph_y += 1) {
+            buffered_writer_write_cstring(&writer, glyph_y == 0 ? "0x" : ", 0x");
+            buffered_writer_write(&writer, &hex_bytes[glyph->rows[glyph_y] * 2], 2);
+        }
+        buffered_writer_write_cstring(&writer, "}, // ");
+        glyphs_write_bitmap_chars(glyphs, glyph_index, &writer);
+        buffered_writer_write_cstring(&writer, "\n");
+
+        written_bitmap_count += 1;
+    }
+
+    buffered_writer_write_cstring(&writer, "};\n");
+    glyphs_write_bitmap_indices(glyphs, glyph_count, job->name, &writer);
+    glyphs_export_index(&index, job->name, &writer);
+
+    buffered_writer_write_format(
+        &writer,
+        "\n"
+        "static Font8x8 const %s_font = {\n"
+        "    .bitmap_rows = %s_bitmap_rows,\n"
+        "    .bitmap_count = %s_bitmap_count,\n"
+        "    .glyph_bitmap_indices = %s_glyph_bitmap_indices,\n"
+        "    .glyph_count = %s_glyph_count,\n"
+        "    .index = &%s_index,\n"
+        "};\n",
+        job->name, job->name, job->name, job->name, job->name, job->name
+    );
+    if (job->styles != 0) {
+        glyphs_export_style_planes(job, glyphs, bitmap_glyph_indices, bitmap_count, &writer);
+    }
+    return buffered_writer_flush(&writer);
+}
+
+// Returns the byte of 8 vertical pixels, which starts at the row page_y of the glyph scaled by scale.
+u8 glyph_column_byte(Glyph const *glyph, isize scale, isize column_x, isize page_y, bool is_lsb_top) {
+    u8 column = 0;
+    for (isize i = 0; i < 8; i += 1) {
+        isize glyph_x = column_x / scale;
+        isize glyph_y = (page_y + i) / scale;
+        u8 pixel = (glyph->rows[glyph_y] >> (GLYPH_WIDTH - 1 - glyph_x)) & 1;
+        column |= (u8)(pixel << (is_lsb_top ? i : 7 - i));
+    }
+    return column;
+}
+
+void glyphs_write_column_bitmaps(
+    Glyph const *glyphs,
+    isize glyph_count,
+    isize scale,
+    bool is_lsb_top,
+    BufferedWriter *writer
+) {
+    char const *hex_bytes = hex_digits_for_bytes(false);
+    isize page_count = GLYPH_HEIGHT * scale / 8;
+    isize column_count = GLYPH_WIDTH * scale;
+
+    isize written_bitmap_count = 0;
+    for (isize glyph_index = 0; glyph_index < glyph_count; glyph_index += 1) {
+        Glyph const *glyph = &glyphs[glyph_index];
+        if (glyph->bitmap_index != written_bitmap_count) {
+            continue;
+        }
+
+        buffered_writer_write_cstring(writer, "    { // ");
+        glyphs_write_bitmap_chars(glyphs, glyph_index, writer);
+        buffered_writer_write_cstring(writer, "\n");
+        for (isize page = 0; page < page_count; page += 1) {
+            buffered_writer_write_cstring(writer, "        {");
+            for (isize column_x = 0; column_x < column_count; column_x += 1) {
+                buffered_writer_write_cstring(writer, column_x == 0 ? "0x" : ", 0x");
+                buffered_writer_write(writer, &hex_bytes[glyph_column_byte(glyph, scale, column_x, page * 8, is_lsb_top) * 2], 2);
+            }
+            buffered_writer_write_cstring(writer, "},\n");
+        }
+        buffered_writer_write_cstring(writer, "    },\n");
+
+        written_bitmap_count += 1;
+    }
+}
+
+// Glyphs transposed for the page-addressed monochrome displays (SSD1306, ST7565 and alike), where each
+// byte of the frame buffer is a column of 8 pixels. A page of a glyph is a run of column bytes, which
+// goes into a page of the frame buffer with a single memcpy. The native bitmaps are always written,
+// the scaled ones only when the job scale is above 1.
+bool glyphs_export_as_columns_c_array(
+    FontJob const *job,
+    Glyph const *glyphs,
+    isize glyph_count,
+    FILE *output_file,
+    Arena *arena
+) {
+    static_assert(GLYPH_HEIGHT % 8 == 0, "Glyphs have to be made of whole pages.");
+
+    Arena temp_arena = *arena;
+    Font8x8Index index = glyphs_build_index(glyphs, glyph_count, &temp_arena);
+    BufferedWriter writer = buffered_writer_make_growable(output_file, &temp_arena);
+    isize bitmap_count = glyphs_bitmap_count(glyphs, glyph_count);
+
+    buffered_writer_write_format(
+        &writer,
+        "// Generated file. Do not edit manually.\n"
+        "\n"
+        "#include <stdint.h>\n"
+        "\n"
+        "#include \"font8x8.h\"\n"
+        "\n"
+        "#define %s_glyph_width %d\n"
+        "#define %s_glyph_height %d\n"
+        "#define %s_glyph_page_count %d\n"
+        "#define %s_glyph_count %ld\n"
+        "#define %s_bitmap_count %ld\n"
+        "#define %s_scale %d\n"
+        "\n"
+        "static uint32_t const %s_char_codes[%s_glyph_count] = {\n",
+        job->name, GLYPH_WIDTH,
+        job->name, GLYPH_HEIGHT,
+        job->name, GLYPH_HEIGHT / 8,
+        job->name, glyph_count,
+        job->name, bitmap_count,
+        job->name, job->scale,
+        job->name, job->name
+    );
+    glyphs_write_char_codes(glyphs, glyph_count, &writer);
+
+    buffered_writer_write_format(
+        &writer,
+        "};\n"
+        "\n"
+        "// Pages of 8 rows, each is one byte per column from left to right and the %s significant\n"
+        "// bit is the top pixel. Glyphs which look the same share a bitmap.\n"
+        "static uint8_t const %s_column_bitmaps[%s_bitmap_count][%s_glyph_page_count][%s_glyph_width] = {\n",
+        job->is_columns_lsb_top ? "least" : "most",
+        job->name, job->name, job->name, job->name
+    );
+    glyphs_write_column_bitmaps(glyphs, glyph_count, 1, job->is_columns_lsb_top, &writer);
+    buffered_writer_write_cstring(&writer, "};\n");
+
+    if (job->scale > 1) {
+        buffered_writer_write_format(
+            &writer,
+            "\n"
+            "// The same bitmaps scaled by %s_scale.\n"
+            "static uint8_t const %s_column_bitmaps_scaled[%s_bitmap_count][%s_glyph_page_count * %s_scale][%s_glyph_width * %s_scale] = {\n",
+            job->name, job->name, job->name, job->name, job->name, job->name, job->name
+        );
+        glyphs_write_column_bitmaps(glyphs, glyph_count, job->scale, job->is_columns_lsb_top, &writer);
+        buffered_writer_write_cstring(&writer, "};\n");
+    }
+
+    glyphs_write_bitmap_indices(glyphs, glyph_count, job->name, &writer);
+    glyphs_export_index(&index, job->name, &writer);
+    return buffered_writer_flush(&writer);
+}
+
+// Writes the mask of every glyph (not only of the distinct bitmaps, so that the glyph index from the
+// index picks the mask) as a pair of words, which match uvec2 of a std430 storage buffer.
+bool glyphs_export_as_gpu_buffer(
+    FontJob const *job,
+    Glyph const *glyphs,
+    isize glyph_count,
+    FILE *output_file,
+    Arena *arena
+) {
+    static_assert(GLYPH_WIDTH == 8 && GLYPH_HEIGHT == 8, "Glyph masks have to fit into 64 bits.");
+
+    Arena temp_arena = *arena;
+    Font8x8Index index = glyphs_build_index(glyphs, glyph_count, &temp_arena);
+    BufferedWriter writer = buffered_writer_make_growable(output_file, &temp_arena);
+
+    buffered_writer_write_format(
+        &writer,
+        "// Generated file. Do not edit manually.\n"
+        "\n"
+        "#include <stdint.h>\n"
+        "\n"
+        "#include \"font8x8.h\"\n"
+        "\n"
+        "#define %s_glyph_width %d\n"
+        "#define %s_glyph_height %d\n"
+        "#define %s_glyph_count %ld\n"
+        "\n"
+        "// Masks of the glyphs by the glyph index, to be uploaded as uvec2[] into a storage buffer (see\n"
+        "// %s_gpu.glsl). Every byte is a row, the top row is the least significant byte of the first word\n"
+        "// and the most significant bit of a row is its leftmost pixel.\n"
+        "static uint32_t const %s_gpu_masks[%s_glyph_count][2] = {\n",
+        job->name, GLYPH_WIDTH,
+        job->name, GLYPH_HEIGHT,
+        job->name, glyph_count,
+        job->name,
+        job->name, job->name
+    );
+
+    for (isize glyph_index = 0; glyph_index < glyph_count; glyph_index += 1) {
+        Glyph const *glyph = &glyphs[glyph_index];
+        u32 words[2] = {0};
+        for (isize glyph_y = 0; glyph_y < GLYPH_HEIGHT; glyph_y += 1) {
+            words[glyph_y / 4] |= (u32)glyph->rows[glyph_y] << (glyph_y % 4 * 8);
+        }
+
+        buffered_writer_write_format(&writer, "    {0x%08x, 0x%08x}, // U+%04X\n", words[0], words[1], glyph->char_code);
+    }
+
+    buffered_writer_write_cstring(&writer, "};\n");
+    glyphs_export_index(&index, job->name, &writer);
+    return buffered_writer_flush(&writer);
+}
+
+// Writes the reference shader for the masks of glyphs_export_as_gpu_buffer. The whole text is a
+// single instanced draw of cells, with no texture.
+bool glyphs_export_gpu_shader(FontJob const *job, FILE *output_file, Arena *arena) {
+    Arena temp_arena = *arena;
+    BufferedWriter writer = buffered_writer_make_growable(output_file, &temp_arena);
+
+    buffered_writer_write_format(
+        &writer,
+        "// Generated file. Do not edit manually.\n"
+        "//\n"
+        "// Draws text as instanced cells right from the glyph masks of %s_gpu.c, which are bound as the\n"
+        "// storage buffer 0. The same source is both stages: put \"#version 430\" and then the define of\n"
+        "// VERTEX_SHADER or FRAGMENT_SHADER in front of it.\n"
+        "//\n"
+        "// Each instance is a cell: its column and row and the glyph index (from %s_index, see\n"
+        "// font8x8_glyph_index), as integer attributes with the divisor of 1. Draw 6 vertices per\n"
+        "// instance, with no vertex buffer:\n"
+        "//\n"
+        "//     glDrawArraysInstanced(GL_TRIANGLES, 0, 6, cell_count);\n"
+        "\n"
+        "const uint %s_glyph_width = %du;\n"
+        "const uint %s_glyph_height = %du;\n"
+        "\n"
+        "// In pixels, with the origin at the top left corner.\n"
+        "uniform vec2 %s_screen_size;\n"
+        "uniform vec2 %s_origin;\n"
+        "uniform float %s_scale;\n"
+        "\n",
+        job->name, job->name,
+        job->name, GLYPH_WIDTH,
+        job->name, GLYPH_HEIGHT,
+        job->name, job->name, job->name
+    );
+
+    buffered_writer_write_format(
+        &writer,
+        "#if defined(VERTEX_SHADER)\n"
+        "\n"
+        "layout(location = 0) in ivec2 %s_instance_cell;\n"
+        "layout(location = 1) in uint %s_instance_glyph_index;\n"
+        "\n"
+        "out vec2 %s_glyph_position;\n"
+        "flat out uint %s_glyph_index;\n"
+        "\n"
+        "const vec2 %s_corners[6] = vec2[6](\n"
+        "    vec2(0.0, 0.0), vec2(1.0, 0.0), vec2(0.0, 1.0),\n"
+        "    vec2(0.0, 1.0), vec2(1.0, 0.0), vec2(1.0, 1.0)\n"
+        ");\n"
+        "\n"
+        "void main() {\n"
+        "    vec2 corner = %s_corners[gl_VertexID];\n"
+        "    vec2 glyph_size = vec2(%s_glyph_width, %s_glyph_height);\n"
+        "    vec2 position = %s_origin + (vec2(%s_instance_cell) + corner) * glyph_size * %s_scale;\n"
+        "    vec2 clip_position = position / %s_screen_size * 2.0 - 1.0;\n"
+        "    gl_Position = vec4(clip_position.x, -clip_position.y, 0.0, 1.0);\n"
+        "\n"
+        "    %s_glyph_position = corner * glyph_size;\n"
+        "    %s_glyph_index = %s_instance_glyph_index;\n"
+        "}\n"
+        "\n"
+        "#elif defined(FRAGMENT_SHADER)\n"
+        "\n"
+        "layout(std430, binding = 0) readonly buffer %s_masks_buffer {\n"
+        "    uvec2 %s_masks[];\n"
+        "};\n"
+        "\n"
+        "uniform vec4 %s_ink_color;\n"
+        "uniform vec4 %s_background_color;\n"
+        "\n"
+        "in vec2 %s_glyph_position;\n"
+        "flat in uint %s_glyph_index;\n"
+        "\n"
+        "out vec4 %s_color;\n"
+        "\n"
+        "void main() {\n"
+        "    uvec2 pixel = min(uvec2(%s_glyph_position), uvec2(%s_glyph_width - 1u, %s_glyph_height - 1u));\n"
+        "    uvec2 mask = %s_masks[%s_glyph_index];\n"
+        "    uint rows = pixel.y < 4u ? mask.x : mask.y;\n"
+        "    uint row = (rows >> ((pixel.y & 3u) * 8u)) & 0xffu;\n"
+        "    bool is_set = ((row >> (7u - pixel.x)) & 1u) != 0u;\n"
+        "    %s_color = is_set ? %s_ink_color : %s_background_color;\n"
+        "}\n"
+        "\n"
+        "#endif\n",
+        job->name, job->name,
+        job->name, job->name,
+        job->name,
+        job->name, job->name, job->name, job->name, job->name, job->name, job->name,
+        job->name, job->name, job->name,
+        job->name, job->name,
+        job->name, job->name,
+        job->name, job->name,
+        job->name,
+        job->name, job->name, job->name,
+        job->name, job->name,
+        job->name, job->name, job->name
+    );
+
+    return buffered_writer_flush(&writer);
+}
+
+// Separators between the glyphs of the atlas in the XNA style (the color key, which raylib's
+// LoadFontFromImage expects). Note that raylib assumes that char codes go one after another starting
+// from the first one, which is not the case for this font, so the rect table has to be used anyway.
+#define ATLAS_BORDERS true
+#define ATLAS_KEY_COLOR 0xffff00ff
+#define ATLAS_MAX_SIZE 8192
+
+typedef enum {
+    ATLAS_FILE_PNG,
+    // Just the pixels in the pixel format of the job, RGBA8888 by default.
+    ATLAS_FILE_RAW,
+} AtlasFileFormat;
+
+#define ATLAS_FILE_FORMAT ATLAS_FILE_PNG
+
+// All glyphs packed in a grid into one power of two texture.
+typedef struct {
+    i32 width;
+    i32 height;
+    // Size of the glyph cells without the borders.
+    i32 cell_width;
+    i32 cell_height;
+    i32 column_count;
+    i32 border;
+    // Distance in pixels, which spans the whole alpha range, or 0 if the atlas isn't a distance field.
+    i32 distance_field_spread;
+    u32 *pixels;
+} Atlas;
+
+typedef struct {
+    i32 x;
+    i32 y;
+} AtlasPosition;
+
+AtlasPosition atlas_cell_position(Atlas const *atlas, isize cell_index) {
+    return (AtlasPosition){
+        .x = atlas->border + (i32)(cell_index % atlas->column_count) * (atlas->cell_width + atlas->border),
+        .y = atlas->border + (i32)(cell_index / atlas->column_count) * (atlas->cell_height + atlas->border),
+    };
+}
+
+i32 next_power_of_two(i32 value) {
+    i32 result = 1;
+    while (result < value) {
+        result *= 2;
+    }
+    return result;
+}
+
+// Picks the smallest (and then the most square) power of two texture, which fits all glyph cells.
+bool atlas_init(
+    Atlas *atlas,
+    isize cell_count,
+    i32 cell_width,
+    i32 cell_height,
+    i32 border,
+    Arena *arena
+) {
+    atlas->width = 0;
+    atlas->height = 0;
+    atlas->cell_width = cell_width;
+    atlas->cell_height = cell_height;
+    atlas->border = border;
+    atlas->distance_field_spread = 0;
+
+    for (i32 width = 1; width <= ATLAS_MAX_SIZE; width *= 2) {
+        i32 column_count = (width - border) / (cell_width + border);
+        if (column_count <= 0) {
+            continue;
+        }
+
+        isize row_count = (cell_count + column_count - 1) / column_count;
+        isize min_height = border + row_count * (cell_height + border);
+        if (min_height > ATLAS_MAX_SIZE) {
+            continue;
+        }
+        i32 height = next_power_of_two((i32)min_height);
+
+        bool is_better =
+            atlas->width == 0 ||
+            (isize)width * height < (isize)atlas->width * atlas->height ||
+            (
+                (isize)width * height == (isize)atlas->width * atlas->height &&
+                abs(width - height) < abs(atlas->width - atlas->height)
+            );
+        if (is_better) {
+            atlas->width = width;
+            atlas->height = height;
+            atlas->column_count = column_count;
+        }
+    }
+
+    if (atlas->width == 0) {
+        return false;
+    }
+
+    isize pixel_count = (isize)atlas->width * atlas->height;
+    atlas->pixels = arena_alloc(arena, pixel_count * sizeof(u32));
+    for (isize i = 0; i < pixel_count; i += 1) {
+        atlas->pixels[i] = border > 0 ? ATLAS_KEY_COLOR : 0x00000000;
+    }
+
+    return true;
+}
+
+// Every distinct bitmap gets one cell, glyphs which look the same share it.
+bool glyphs_pack_into_atlas(Glyph const *glyphs, isize glyph_count, i32 scale, Atlas *atlas, Arena *arena) {
+    i32 border = ATLAS_BORDERS ? 1 : 0;
+    isize bitmap_count = glyphs_bitmap_count(glyphs, glyph_count);
+    if (!atlas_init(atlas, bitmap_count, GLYPH_WIDTH * scale, GLYPH_HEIGHT * scale, border, arena)) {
+        return false;
+    }
+
+    isize written_bitmap_count = 0;
+    for (isize glyph_index = 0; glyph_index < glyph_count; glyph_index += 1) {
+        if (glyphs[glyph_index].bitmap_index != written_bitmap_count) {
+            continue;
+        }
+        AtlasPosition position = atlas_cell_position(atlas, written_bitmap_count);
+        written_bitmap_count += 1;
+
+        for (i32 glyph_y = 0; glyph_y < atlas->cell_height; glyph_y += 1) {
+            memcpy(
+                &atlas->pixels[(position.y + glyph_y) * atlas->width + position.x],
+                &glyphs[glyph_index].bitmap[glyph_y * atlas->cell_width],
+                (size_t)(atlas->cell_width * sizeof(u32))
+            );
+        }
+    }
+
+    return true;
+}
+
+// Distance field atlas: each glyph upsampled sdf_scale times, so that the edges of its pixels stay
+// sharp, with the signed distance to the edge in the alpha (inside is above 0.5). Glyph cells are
+// sdf_spread * 2 pixels apart, which leaves every glyph sdf_spread pixels of its field on each side.
+#define SDF_THREAD_MAX_COUNT 16
+// Fewer glyphs per thread don't pay for starting it.
+#define SDF_THREAD_MIN_BITMAP_COUNT 32
+#define SDF_INFINITY 1e20f
+
+static_assert(FONT_SDF_SCALE >= 1 && FONT_SDF_SCALE <= SDF_SCALE_MAX, "FONT_SDF_SCALE is out of range.");
+static_assert(FONT_SDF_SPREAD >= 1 && FONT_SDF_SPREAD <= SDF_SPREAD_MAX, "FONT_SDF_SPREAD must be positive, the field is kept in the borders.");
+static_assert(GLYPH_WIDTH == GLYPH_HEIGHT, "Distance fields are made for square glyphs only.");
+
+// One dimensional squared Euclidean distance transform (Felzenszwalb and Huttenlocher, "Distance
+// Transforms of Sampled Functions"): distances[q] = min over p of (q - p)^2 + costs[p], in linear
+// time with the lower envelope of the parabolas rooted at each p. The parabolas go to parabola_roots
+// and the boundaries between them to boundaries, which has to hold count + 1 values.
+void sdf_transform_1d(
+    f32 const *costs,
+    isize count,
+    f32 *distances,
+    i32 *parabola_roots,
+    f32 *boundaries
+) {
+    isize parabola_index = 0;
+    parabola_roots[0] = 0;
+    boundaries[0] = -SDF_INFINITY;
+    boundaries[1] = SDF_INFINITY;
+
+    for (i32 q = 1; q < count; q += 1) {
+        // Parabolas hidden by the new one are dropped. The first boundary is below any intersection
+        // (the costs are at most SDF_INFINITY), so the loop stops at the first parabola at the latest.
+        f32 intersection;
+        while (true) {
+            i32 p = parabola_roots[parabola_index];
+            intersection = ((costs[q] + (f32)q * q) - (costs[p] + (f32)p * p)) / (f32)(2 * q - 2 * p);
+            if (intersection > boundaries[parabola_index]) {
+                break;
+            }
+            parabola_index -= 1;
+        }
+
+        parabola_index += 1;
+        parabola_roots[parabola_index] = q;
+        boundaries[parabola_index] = intersection;
+        boundaries[parabola_index + 1] = SDF_INFINITY;
+    }
+
+    parabola_index = 0;
+    for (i32 q = 0; q < count; q += 1) {
+        while (boundaries[parabola_index + 1] < (f32)q) {
+            parabola_index += 1;
+        }
+        i32 p = parabola_roots[parabola_index];
+        distances[q] = (f32)(q - p) * (q - p) + costs[p];
+    }
+}
+
+// Scratch space of a single thread, for a field of size * size pixels.
+typedef struct {
+    isize size;
+    f32 *field;
+    f32 *costs;
+    f32 *distances;
+    i32 *parabola_roots;
+    f32 *boundaries;
+} SdfScratch;
+
+SdfScratch sdf_scratch_make(isize size, Arena *arena) {
+    return (SdfScratch){
+        .size = size,
+        .field = arena_alloc(arena, size * size * sizeof(f32)),
+        .costs = arena_alloc(arena, size * sizeof(f32)),
+        .distances = arena_alloc(arena, size * sizeof(f32)),
+        .parabola_roots = arena_alloc(arena, size * sizeof(i32)),
+        .boundaries = arena_alloc(arena, (size + 1) * sizeof(f32)),
+    };
+}
+
+// Transforms the columns and then the rows of the field (the costs, 0 at the feature pixels and
+// SDF_INFINITY elsewhere) into the squared distances to the nearest feature pixel.
+void sdf_transform_2d(SdfScratch *scratch) {
+    isize size = scratch->size;
+    f32 *field = scratch->field;
+
+    for (isize x = 0; x < size; x += 1) {
+        for (isize y = 0; y < size; y += 1) {
+            scratch->costs[y] = field[y * size + x];
+        }
+        sdf_transform_1d(scratch->costs, size, scratch->distances, scratch->parabola_roots, scratch->boundaries);
+        for (isize y = 0; y < size; y += 1) {
+            field[y * size + x] = scratch->distances[y];
+        }
+    }
+
+    for (isize y = 0; y < size; y += 1) {
+        memcpy(scratch->costs, &field[y * size], (size_t)(size * sizeof(f32)));
+        sdf_transform_1d(scratch->costs, size, &field[y * size], scratch->parabola_roots, scratch->boundaries);
+    }
+}
+
+bool sdf_is_inside(Glyph const *glyph, i32 scale, i32 spread, isize field_x, isize field_y) {
+    isize glyph_x = field_x - spread;
+    isize glyph_y = field_y - spread;
+    if (glyph_x < 0 || glyph_x >= GLYPH_WIDTH * scale || glyph_y < 0 || glyph_y >= GLYPH_HEIGHT * scale) {
+        return false;
+    }
+    return (glyph->rows[glyph_y / scale] >> (7 - glyph_x / scale) & 1) != 0;
+}
+
+// Writes the field of the glyph around its cell at the position. The outer distance (to the nearest
+// inside pixel) is computed first and kept in the atlas while the field is reused for the inner one.
+void sdf_glyph_write(
+    Glyph const *glyph,
+    AtlasPosition position,
+    u32 ink_color,
+    i32 scale,
+    Atlas *atlas,
+    SdfScratch *scratch
+) {
+    isize size = scratch->size;
+    f32 *field = scratch->field;
+    i32 spread = atlas->distance_field_spread;
+    u32 *origin = &atlas->pixels[(position.y - spread) * atlas->width + (position.x - spread)];
+    u32 ink_rgb = ink_color & 0x00ffffff;
+
+    for (isize pass = 0; pass < 2; pass += 1) {
+        bool is_inner = pass == 1;
+        for (isize y = 0; y < size; y += 1) {
+            for (isize x = 0; x < size; x += 1) {
+                field[y * size + x] = sdf_is_inside(glyph, scale, spread, x, y) != is_inner ? 0.0f : SDF_INFINITY;
+            }
+        }
+        sdf_transform_2d(scratch);
+
+        for (isize y = 0; y < size; y += 1) {
+            for (isize x = 0; x < size; x += 1) {
+                bool is_inside = sdf_is_inside(glyph, scale, spread, x, y);
+                if (is_inside != is_inner) {
+                    continue;
+                }
+                // The edge is half a pixel from the centers of the pixels on either side of it.
+                f32 distance = sqrtf(field[y * size + x]) - 0.5f;
+                f32 signed_distance = is_inner ? distance : -distance;
+                long value = lroundf(127.5f + signed_distance * 127.5f / (f32)spread);
+                value = value < 0 ? 0 : value > 255 ? 255 : value;
+                origin[y * atlas->width + x] = (u32)value << 24 | ink_rgb;
+            }
+        }
+    }
+}
+
+typedef struct {
+    Glyph const *glyphs;
+    // The first glyph of each bitmap.
+    isize const *bitmap_glyph_indices;
+    isize bitmap_count;
+    u32 ink_color;
+    i32 scale;
+    Atlas *atlas;
+    atomic_long next_bitmap_index;
+} SdfTask;
+
+typedef struct {
+    SdfTask *task;
+    SdfScratch scratch;
+} SdfWorker;
+
+// Glyphs take their fields from the task until there are none left. The fields of different glyphs
+// don't overlap in the atlas, so there is nothing else to synchronize.
+int sdf_worker_run(void *argument) {
+    SdfWorker *worker = argument;
+    SdfTask *task = worker->task;
+
+    while (true) {
+        isize bitmap_index = atomic_fetch_add(&task->next_bitmap_index, 1);
+        if (bitmap_index >= task->bitmap_count) {
+            break;
+        }
+        Glyph const *glyph = &task->glyphs[task->bitmap_glyph_indices[bitmap_index]];
+        AtlasPosition position = atlas_cell_position(task->atlas, bitmap_index);
+        sdf_glyph_write(glyph, position, task->ink_color, task->scale, task->atlas, &worker->scratch);
+    }
+
+    return 0;
+}
+
+// Packs the distance fields of the glyphs into an atlas in the same grid as glyphs_pack_into_atlas,
+// the glyphs are spread across threads.
+bool glyphs_pack_into_sdf_atlas(
+    Glyph const *glyphs,
+    isize glyph_count,
+    u32 ink_color,
+    i32 scale,
+    i32 spread,
+    Atlas *atlas,
+    Arena *arena
+) {
+    isize bitmap_count = glyphs_bitmap_count(glyphs, glyph_count);
+    i32 cell_width = GLYPH_WIDTH * scale;
+    i32 cell_height = GLYPH_HEIGHT * scale;
+    if (!atlas_init(atlas, bitmap_count, cell_width, cell_height, spread * 2, arena)) {
+        return false;
+    }
+    atlas->distance_field_spread = spread;
+    isize pixel_count = (isize)atlas->width * atlas->height;
+    for (isize i = 0; i < pixel_count; i += 1) {
+        atlas->pixels[i] = ink_color & 0x00ffffff;
+    }
+
+    SdfTask task = {
+        .glyphs = glyphs,
+        .bitmap_glyph_indices = glyphs_find_bitmap_glyph_indices(glyphs, glyph_count, bitmap_count, arena),
+        .bitmap_count = bitmap_count,
+        .ink_color = ink_color,
+        .scale = scale,
+        .atlas = atlas,
+    };
+    atomic_init(&task.next_bitmap_index, 0);
+
+    isize thread_count = hardware_thread_count();
+    thread_count = thread_count < SDF_THREAD_MAX_COUNT ? thread_count : SDF_THREAD_MAX_COUNT;
+    isize max_thread_count = (bitmap_count + SDF_THREAD_MIN_BITMAP_COUNT - 1) / SDF_THREAD_MIN_BITMAP_COUNT;
+    thread_count = thread_count < max_thread_count ? thread_count : max_thread_count;
+    thread_count = thread_count > 0 ? thread_count : 1;
+
+    isize field_size = cell_width + spread * 2;
+    SdfWorker workers[SDF_THREAD_MAX_COUNT];
+    thrd_t threads[SDF_THREAD_MAX_COUNT];
+    for (isize i = 0; i < thread_count; i += 1) {
+        workers[i] = (SdfWorker){
+            .task = &task,
+            .scratch = sdf_scratch_make(field_size, arena),
+        };
+    }
+
+    // The current thread is the first worker, whatever couldn't be started is done by the rest.
+    isize started_thread_count = 1;
+    while (started_thread_count < thread_count) {
+        if (thrd_create(&threads[started_thread_count], sdf_worker_run, &workers[started_thread_count]) != thrd_success) {
+            break;
+        }
+        started_thread_count += 1;
+    }
+    sdf_worker_run(&workers[0]);
+    for (isize i = 1; i < started_thread_count; i += 1) {
+        thrd_join(threads[i], NULL);
+    }
+
+    return true;
+}
+
+void write_u32_big_endian(u8 *bytes, u32 value) {
+    bytes[0] = (u8)(value >> 24);
+    bytes[1] = (u8)(value >> 16);
+    bytes[2] = (u8)(value >> 8);
+    bytes[3] = (u8)value;
+}
+
+static u32 crc_table[256];
+static once_flag crc_table_once_flag = ONCE_FLAG_INIT;
+
+void crc_table_fill(void) {
+    for (u32 byte = 0; byte < 256; byte += 1) {
+        u32 value = byte;
+        for (isize bit = 0; bit < 8; bit += 1) {
+            value = (value & 1) != 0 ? 0xedb88320 ^ (value >> 1) : value >> 1;
+        }
+        crc_table[byte] = value;
+    }
+}
+
+u32 crc32_update(u32 crc, u8 const *data, isize size) {
+    call_once(&crc_table_once_flag, crc_table_fill);
+
+    crc = ~crc;
+    for (isize i = 0; i < size; i += 1) {
+        crc = crc_table[(crc ^ data[i]) & 0xff] ^ (crc >> 8);
+    }
+    return ~crc;
+}
+
+void png_write_chunk(char const *type, u8 const *data, isize size, FILE *output_file) {
+    u8 header[8];
+    write_u32_big_endian(header, (u32)size);
+    memcpy(header + 4, type, 4);
+
+    u8 footer[4];
+    write_u32_big_endian(footer, crc32_update(crc32_update(0, header + 4, 4), data, size));
+
+    fwrite(header, 1, sizeof(header), output_file);
+    fwrite(data, 1, (size_t)size, output_file);
+    fwrite(footer, 1, sizeof(footer), output_file);
+}
+
+// Deflate (RFC 1951) with a single block of the fixed Huffman codes. Matches are looked up at the
+// last position with the same 3 bytes and one scanline up, which finds the empty space and the
+// scaled rows of the atlases without a full hash chain search.
+#define DEFLATE_WINDOW_SIZE 32768
+#define DEFLATE_MIN_MATCH_LENGTH 3
+#define DEFLATE_MAX_MATCH_LENGTH 258
+#define DEFLATE_HASH_BIT_COUNT 15
+
+static u16 const deflate_length_bases[29] = {
+    3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258,
+};
+static u8 const deflate_length_extra_bit_counts[29] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0,
+};
+static u16 const deflate_distance_bases[30] = {
+    1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385, 513, 769, 1025, 1537, 2049, 3073,
+    4097, 6145, 8193, 12289, 16385, 24577,
+};
+static u8 const deflate_distance_extra_bit_counts[30] = {
+    0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13,
+};
+
+typedef struct {
+    u8 *data;
+    u64 bits;
+    i32 bit_count;
+} BitWriter;
+
+// Deflate packs the bits from the least significant one.
+void bit_writer_write(BitWriter *writer, u32 value, i32 bit_count) {
+    writer->bits |= (u64)value << writer->bit_count;
+    writer->bit_count += bit_count;
+    while (writer->bit_count >= 8) {
+        *writer->data++ = (u8)writer->bits;
+        writer->bits >>= 8;
+        writer->bit_count -= 8;
+    }
+}
+
+void bit_writer_flush(BitWriter *writer) {
+    if (writer->bit_count > 0) {
+        *writer->data++ = (u8)writer->bits;
+    }
+    writer->bits = 0;
+    writer->bit_count = 0;
+}
+
+// Huffman codes go from their most significant bit, unlike the rest of the fields.
+void bit_writer_write_huffman(BitWriter *writer, u32 code, i32 bit_count) {
+    u32 reversed = 0;
+    for (i32 i = 0; i < bit_count; i += 1) {
+        reversed = reversed << 1 | (code >> i & 1);
+    }
+    bit_writer_write(writer, reversed, bit_count);
+}
+
+// Writes a literal byte, the end of the block (256) or a length code (257 to 285).
+void deflate_write_symbol(BitWriter *writer, u32 symbol) {
+    if (symbol < 144) {
+        bit_writer_write_huffman(writer, 0x30 + symbol, 8);
+    } else if (symbol < 256) {
+        bit_writer_write_huffman(writer, 0x190 + symbol - 144, 9);
+    } else if (symbol < 280) {
+        bit_writer_write_huffman(writer, symbol - 256, 7);
+    } else {
+        bit_writer_write_huffman(writer, 0xc0 + symbol - 280, 8);
+    }
+}
+
+void deflate_write_match(BitWriter *writer, isize length, isize distance) {
+    i32 length_code = 28;
+    while (deflate_length_bases[length_code] > length) {
+        length_code -= 1;
+    }
+    deflate_write_symbol(writer, 257 + (u32)length_code);
+    bit_writer_write(writer, (u32)(length - deflate_length_bases[length_code]), deflate_length_extra_bit_counts[length_code]);
+
+    i32 distance_code = 29;
+    while (deflate_distance_bases[distance_code] > distance) {
+        distance_code -= 1;
+    }
+    bit_writer_write_huffman(writer, (u32)distance_code, 5);
+    bit_writer_write(writer, (u32)(distance - deflate_distance_bases[distance_code]), deflate_distance_extra_bit_counts[distance_code]);
+}
+
+isize deflate_match_length(u8 const *data, isize size, isize position, isize candidate) {
+    isize max_length = size - position < DEFLATE_MAX_MATCH_LENGTH ? size - position : DEFLATE_MAX_MATCH_LENGTH;
+    isize length = 0;
+    while (length < max_length && data[candidate + length] == data[position + length]) {
+        length += 1;
+    }
+    return length;
+}
+
+// Literals take at most 9 bits and matches at most 25 bits for 3 bytes, so the output is never more
+// than an eighth larger than the data.
+isize deflate_max_size(isize size) {
+    return size + size / 8 + 16;
+}
+
+// Compresses the data into output (of deflate_max_size bytes) and returns the compressed size.
+// row_size is the distance of the second match candidate.
+isize deflate_compress(u8 const *data, isize size, isize row_size, u8 *output, Arena *arena) {
+    Arena temp_arena = *arena;
+    isize hash_count = (isize)1 << DEFLATE_HASH_BIT_COUNT;
+    isize *last_positions = arena_alloc(&temp_arena, hash_count * sizeof(isize));
+    for (isize i = 0; i < hash_count; i += 1) {
+        last_positions[i] = -1;
+    }
+
+    BitWriter writer = {.data = output};
+    bit_writer_write(&writer, 1, 1);   // Last block
+    bit_writer_write(&writer, 1, 2);   // Fixed Huffman codes
+
+    isize position = 0;
+    while (position < size) {
+        isize best_length = 0;
+        isize best_distance = 0;
+        if (size - position >= DEFLATE_MIN_MATCH_LENGTH) {
+            u32 key = (u32)data[position] | (u32)data[position + 1] << 8 | (u32)data[position + 2] << 16;
+            u32 hash = (key * 2654435761u) >> (32 - DEFLATE_HASH_BIT_COUNT);
+            isize candidates[2] = {last_positions[hash], position - row_size};
+            last_positions[hash] = position;
+
+            for (isize i = 0; i < 2; i += 1) {
+                isize candidate = candidates[i];
+                if (candidate < 0 || position - candidate > DEFLATE_WINDOW_SIZE || candidate >= position) {
+                    continue;
+                }
+                isize length = deflate_match_length(data, size, position, candidate);
+                if (length > best_length) {
+                    best_length = length;
+                    best_distance = position - candidate;
+                }
+            }
+        }
+
+        if (best_length >= DEFLATE_MIN_MATCH_LENGTH) {
+            deflate_write_match(&writer, best_length, best_distance);
+            position += best_length;
+        } else {
+            deflate_write_symbol(&writer, data[position]);
+            position += 1;
+        }
+    }
+
+    deflate_write_symbol(&writer, 256);
+    bit_writer_flush(&writer);
+    isize output_size = writer.data - output;
+    assert(output_size <= deflate_max_size(size));
+    return output_size;
+}
+
+typedef enum {
+    PNG_COLOR_TYPE_GRAY = 0,
+    PNG_COLOR_TYPE_RGBA = 6,
+} PngColorType;
+
+// Writes the image from its scanlines, each of which is preceded by a filter type byte (0 = no
+// filter). Unfiltered scanlines are enough for deflate_compress, the atlases are mostly runs of
+// empty pixels and rows that repeat the one above.
+void png_write_scanlines(
+    u8 const *raw,
+    isize raw_size,
+    i32 width,
+    i32 height,
+    PngColorType color_type,
+    FILE *output_file,
+    Arena *arena
+) {
+    static u8 const png_signature[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n'};
+    fwrite(png_signature, 1, sizeof(png_signature), output_file);
+
+    u8 header[13];
+    write_u32_big_endian(header + 0, (u32)width);
+    write_u32_big_endian(header + 4, (u32)height);
+    header[8] = 8;      // Bit depth
+    header[9] = (u8)color_type;
+    header[10] = 0;     // Compression method
+    header[11] = 0;     // Filter method
+    header[12] = 0;     // No interlacing
+    png_write_chunk("IHDR", header, sizeof(header), output_file);
+
+    // 2 bytes of zlib header and 4 bytes of Adler-32 around the deflate stream.
+    u8 *data = arena_alloc(arena, 2 + deflate_max_size(raw_size) + 4);
+    u8 *data_iter = data;
+    *data_iter++ = 0x78;   // Deflate, 32K window
+    *data_iter++ = 0x01;   // No preset dictionary, fastest compression level, FCHECK
+    data_iter += deflate_compress(raw, raw_size, raw_size / height, data_iter, arena);
+
+    u32 adler_a = 1;
+    u32 adler_b = 0;
+    for (isize i = 0; i < raw_size; i += 1) {
+        adler_a = (adler_a + raw[i]) % 65521;
+        adler_b = (adler_b + adler_a) % 65521;
+    }
+    write_u32_big_endian(data_iter, adler_b << 16 | adler_a);
+    data_iter += 4;
+    isize data_size = data_iter - data;
+
+    png_write_chunk("IDAT", data, data_size, output_file);
+    png_write_chunk("IEND", NULL, 0, output_file);
+}
+
+void png_write_rgba(u32 const *pixels, i32 width, i32 height, FILE *output_file, Arena *arena) {
+    Arena temp_arena = *arena;
+    isize scanline_size = 1 + width * 4;
+    isize raw_size = scanline_size * height;
+
+    u8 *raw = arena_alloc(&temp_arena, raw_size);
+    for (isize y = 0; y < height; y += 1) {
+        u8 *scanline = raw + y * scanline_size;
+        scanline[0] = 0;
+        for (isize x = 0; x < width; x += 1) {
+            u32 pixel = pixels[y * width + x];
+            scanline[1 + x * 4 + 0] = (u8)pixel;
+            scanline[1 + x * 4 + 1] = (u8)(pixel >> 8);
+            scanline[1 + x * 4 + 2] = (u8)(pixel >> 16);
+            scanline[1 + x * 4 + 3] = (u8)(pixel >> 24);
+        }
+    }
+
+    png_write_scanlines(raw, raw_size, width, height, PNG_COLOR_TYPE_RGBA, output_file, &temp_arena);
+}
+
+// Writes the alpha of the pixels as a grayscale image.
+void png_write_alpha_as_gray(u32 const *pixels, i32 width, i32 height, FILE *output_file, Arena *arena) {
+    Arena temp_arena = *arena;
+    isize scanline_size = 1 + width;
+    isize raw_size = scanline_size * height;
+
+    u8 *raw = arena_alloc(&temp_arena, raw_size);
+    for (isize y = 0; y < height; y += 1) {
+        u8 *scanline = raw + y * scanline_size;
+        scanline[0] = 0;
+        for (isize x = 0; x < width; x += 1) {
+            scanline[1 + x] = (u8)(pixels[y * width + x] >> 24);
+        }
+    }
+
+    png_write_scanlines(raw, raw_size, width, height, PNG_COLOR_TYPE_GRAY, output_file, &temp_arena);
+}
+
+// A set pixel format makes the atlas a raw image, as the PNG writer only emits RGBA or gray.
+AtlasFileFormat font_job_atlas_file_format(FontJob const *job) {
+    return job->pixel_format != PIXEL_FORMAT_DEFAULT ? ATLAS_FILE_RAW : ATLAS_FILE_FORMAT;
+}
+
+PixelFormat font_job_atlas_pixel_format(FontJob const *job) {
+    return job->pixel_format != PIXEL_FORMAT_DEFAULT ? job->pixel_format : PIXEL_FORMAT_RGBA8888;
+}
+
+void atlas_write(Atlas const *atlas, FontJob const *job, FILE *output_file, Arena *arena) {
+    switch (font_job_atlas_file_format(job)) {
+    case ATLAS_FILE_PNG: {
+        // Only the distances matter, so a single channel is enough.
+        if (atlas->distance_field_spread > 0) {
+            png_write_alpha_as_gray(atlas->pixels, atlas->width, atlas->height, output_file, arena);
+        } else {
+            png_write_rgba(atlas->pixels, atlas->width, atlas->height, output_file, arena);
+        }
+    } break;
+
+    case ATLAS_FILE_RAW: {
+        PixelFormat pixel_format = font_job_atlas_pixel_format(job);
+        isize size = pixel_format_row_size(pixel_format, atlas->width) * atlas->height;
+        u8 *bytes = arena_alloc(arena, size);
+        pixels_encode(atlas->pixels, atlas->width, atlas->height, pixel_format, job->ink_color, bytes);
+        fwrite(bytes, 1, (size_t)size, output_file);
+    } break;
+
+    default: {
+        UNREACHABLE();
+    } break;
+    }
+
+    fflush(output_file);
+}
+
+// Writes the rects of the glyphs within the atlas along with the index to look them up. The name is
+// the prefix of the C symbols.
+bool atlas_export_rects_as_c_array(
+    char const *name,
+    Atlas const *atlas,
+    Glyph const *glyphs,
+    isize glyph_count,
+    FILE *output_file,
+    Arena *arena
+) {
+    Arena temp_arena = *arena;
+    Font8x8Index index = glyphs_build_index(glyphs, glyph_count, &temp_arena);
+    BufferedWriter writer = buffered_writer_make_growable(output_file, &temp_arena);
+
+    buffered_writer_write_format(
+        &writer,
+        "// Generated file. Do not edit manually.\n"
+        "\n"
+        "#include <stdint.h>\n"
+        "\n"
+        "#include \"font8x8.h\"\n"
+        "\n"
+        "#define %s_atlas_width %d\n"
+        "#define %s_atlas_height %d\n"
+        "#define %s_glyph_width %d\n"
+        "#define %s_glyph_height %d\n"
+        "#define %s_glyph_count %ld\n"
+        "\n",
+        name, atlas->width,
+        name, atlas->height,
+        name, atlas->cell_width,
+        name, atlas->cell_height,
+        name, glyph_count
+    );
+    if (atlas->distance_field_spread > 0) {
+        buffered_writer_write_format(
+            &writer,
+            "// Values (the alpha, or the gray of a PNG) are 0.5 + distance / (2 * spread), where the distance\n"
+            "// to the edge is in pixels and positive inside. Each rect has spread pixels of the field around it.\n"
+            "#define %s_distance_field_spread %d\n"
+            "\n",
+            name, atlas->distance_field_spread
+        );
+    }
+    buffered_writer_write_format(
+        &writer,
+        "static Font8x8AtlasRect const %s_atlas_rects[%s_glyph_count] = {\n",
+        name, name
+    );
+
+    for (isize glyph_index = 0; glyph_index < glyph_count; glyph_index += 1) {
+        AtlasPosition position = atlas_cell_position(atlas, glyphs[glyph_index].bitmap_index);
+
+        buffered_writer_write_format(
+            &writer,
+            "    {%d, %d, %d, %d, %.9gf, %.9gf, %.9gf, %.9gf}, // U+%04X\n",
+            position.x,
+            position.y,
+            atlas->cell_width,
+            atlas->cell_height,
+            (f64)position.x / atlas->width,
+            (f64)position.y / atlas->height,
+            (f64)(position.x + atlas->cell_width) / atlas->width,
+            (f64)(position.y + atlas->cell_height) / atlas->height,
+            glyphs[glyph_index].char_code
+        );
+    }
+
+    buffered_writer_write_cstring(&writer, "};\n");
+    glyphs_export_index(&index, name, &writer);
+    return buffered_writer_flush(&writer);
+}
+
+#define FONT_ASCENT 7
+#define FONT_DESCENT (GLYPH_HEIGHT - FONT_ASCENT)
+#define FONT_RESOLUTION 75
+#define FONT_PROPERTY_MAX_COUNT 20
+
+typedef struct {
+    char const *name;
+    // NULL for integer properties.
+    char const *string_value;
+    i64 value;
+} FontProperty;
+
+// X font metadata shared by the BDF and PCF exporters.
+typedef struct {
+    // X logical font description name.
+    char name[128];
+    // In decipoints.
+    i64 point_size;
+    // In 1/1000 of the point size.
+    i64 scalable_width;
+    // Glyphs with duplicate char codes are left out, so the first glyph with the given char code wins.
+    isize unique_glyph_count;
+    bool has_fallback_glyph;
+    FontProperty properties[FONT_PROPERTY_MAX_COUNT];
+    isize property_count;
+} FontDescription;
+
+bool glyph_is_duplicate(Glyph const *glyphs, isize glyph_index) {
+    return glyph_index > 0 && glyphs[glyph_index - 1].char_code == glyphs[glyph_index].char_code;
+}
+
+// The name has to outlive the description.
+void font_description_init(
+    FontDescription *description,
+    char const *name,
+    Glyph const *glyphs,
+    isize glyph_count
+) {
+    description->unique_glyph_count = 0;
+    description->has_fallback_glyph = false;
+    for (isize glyph_index = 0; glyph_index < glyph_count; glyph_index += 1) {
+        if (!glyph_is_duplicate(glyphs, glyph_index)) {
+            description->unique_glyph_count += 1;
+        }
+        if (glyphs[glyph_index].char_code == GLYPH_INDEX_FALLBACK_CHAR_CODE) {
+            description->has_fallback_glyph = true;
+        }
+    }
+
+    // Point size in decipoints: pixels * 72.27 / dpi * 10, rounded to the nearest integer.
+    description->point_size = (GLYPH_HEIGHT * 72270 / FONT_RESOLUTION + 50) / 100;
+    description->scalable_width =
+        GLYPH_WIDTH * 1000 * 72270 / (description->point_size * FONT_RESOLUTION * 100);
+
+    snprintf(
+        description->name,
+        sizeof(description->name),
+        "-misc-%s-medium-r-normal--%d-%ld-%d-%d-c-%d-iso10646-1",
+        name,
+        GLYPH_HEIGHT,
+        description->point_size,
+        FONT_RESOLUTION,
+        FONT_RESOLUTION,
+        GLYPH_WIDTH * 10
+    );
+
+    FontProperty properties[] = {
+        {"FOUNDRY", "misc", 0},
+        {"FAMILY_NAME", name, 0},
+        {"WEIGHT_NAME", "Medium", 0},
+        {"SLANT", "R", 0},
+        {"SETWIDTH_NAME", "Normal", 0},
+        {"SPACING", "C", 0},
+        {"CHARSET_REGISTRY", "ISO10646", 0},
+        {"CHARSET_ENCODING", "1", 0},
+        {"PIXEL_SIZE", NULL, GLYPH_HEIGHT},
+        {"POINT_SIZE", NULL, description->point_size},
+        {"RESOLUTION_X", NULL, FONT_RESOLUTION},
+        {"RESOLUTION_Y", NULL, FONT_RESOLUTION},
+        {"AVERAGE_WIDTH", NULL, GLYPH_WIDTH * 10},
+        {"FONT_ASCENT", NULL, FONT_ASCENT},
+        {"FONT_DESCENT", NULL, FONT_DESCENT},
+        {"DEFAULT_CHAR", NULL, GLYPH_INDEX_FALLBACK_CHAR_CODE},
+    };
+    description->property_count = sizeof(properties) / sizeof(properties[0]);
+    if (!description->has_fallback_glyph) {
+        description->property_count -= 1;
+    }
+    assert(description->property_count <= FONT_PROPERTY_MAX_COUNT);
+    memcpy(description->properties, properties, (size_t)(description->property_count * sizeof(FontProperty)));
+}
+
+// What the BDF chunks are encoded from, see bdf_write_glyphs.
+typedef struct {
+    Glyph const *glyphs;
+    FontDescription const *description;
+} BdfChunkContext;
+
+// ChunkEncode of the glyphs.
+void bdf_write_glyphs(void const *context, isize glyph_begin, isize glyph_end, BufferedWriter *writer) {
+    BdfChunkContext const *bdf = context;
+    Glyph const *glyphs = bdf->glyphs;
+    FontDescription const *description = bdf->description;
+
+    for (isize glyph_index = glyph_begin; glyph_index < glyph_end; glyph_index += 1) {
+        Glyph const *glyph = &glyphs[glyph_index];
+        if (glyph_is_duplicate(glyphs, glyph_index)) {
+            continue;
+        }
+
+        buffered_writer_write_cstring(writer, glyph->char_code > 0xffff ? "STARTCHAR u" : "STARTCHAR uni");
+        buffered_writer_write_hex(writer, glyph->char_code, glyph->char_code > 0xffff ? 6 : 4, true);
+        buffered_writer_write_cstring(writer, "\nENCODING ");
+        buffered_writer_write_i64(writer, glyph->char_code);
+        buffered_writer_write_cstring(writer, "\nSWIDTH ");
+        buffered_writer_write_i64(writer, description->scalable_width);
+        buffered_writer_write_cstring(writer, " 0\nDWIDTH ");
+        buffered_writer_write_i64(writer, GLYPH_WIDTH);
+        buffered_writer_write_cstring(writer, " 0\nBBX ");
+        buffered_writer_write_i64(writer, GLYPH_WIDTH);
+        buffered_writer_write_cstring(writer, " ");
+        buffered_writer_write_i64(writer, GLYPH_HEIGHT);
+        buffered_writer_write_cstring(writer, " 0 ");
+        buffered_writer_write_i64(writer, -FONT_DESCENT);
+        buffered_writer_write_cstring(writer, "\nBITMAP\n");
+
+        for (isize glyph_y = 0; glyph_y < GLYPH_HEIGHT; glyph_y += 1) {
+            buffered_writer_write_hex(writer, glyph->rows[glyph_y], 2, true);
+            buffered_writer_write_cstring(writer, "\n");
+        }
+
+        buffered_writer_write_cstring(writer, "ENDCHAR\n");
+    }
+}
+
+// Writes glyphs at the native size into the Glyph Bitmap Distribution Format (version 2.1).
+bool glyphs_export_as_bdf(FontJob const *job, Glyph const *glyphs, isize glyph_count, FILE *output_file, Arena *arena) {
+    Arena temp_arena = *arena;
+    BufferedWriter writer = buffered_writer_make(output_file, &temp_arena);
+
+    FontDescription description;
+    font_description_init(&description, job->name, glyphs, glyph_count);
+
+    buffered_writer_write_cstring(&writer, "STARTFONT 2.1\nFONT ");
+    buffered_writer_write_cstring(&writer, description.name);
+    buffered_writer_write_cstring(&writer, "\nSIZE ");
+    buffered_writer_write_i64(&writer, GLYPH_HEIGHT);
+    buffered_writer_write_cstring(&writer, " ");
+    buffered_writer_write_i64(&writer, FONT_RESOLUTION);
+    buffered_writer_write_cstring(&writer, " ");
+    buffered_writer_write_i64(&writer, FONT_RESOLUTION);
+    buffered_writer_write_cstring(&writer, "\nFONTBOUNDINGBOX ");
+    buffered_writer_write_i64(&writer, GLYPH_WIDTH);
+    buffered_writer_write_cstring(&writer, " ");
+    buffered_writer_write_i64(&writer, GLYPH_HEIGHT);
+    buffered_writer_write_cstring(&writer, " 0 ");
+    buffered_writer_write_i64(&writer, -FONT_DESCENT);
+
+    buffered_writer_write_cstring(&writer, "\nSTARTPROPERTIES ");
+    buffered_writer_write_i64(&writer, description.property_count);
+    buffered_writer_write_cstring(&writer, "\n");
+    for (isize i = 0; i < description.property_count; i += 1) {
+        FontProperty const *property = &description.properties[i];
+
+        buffered_writer_write_cstring(&writer, property->name);
+        if (property->string_value != NULL) {
+            buffered_writer_write_cstring(&writer, " \"");
+            buffered_writer_write_cstring(&writer, property->string_value);
+            buffered_writer_write_cstring(&writer, "\"\n");
+        } else {
+            buffered_writer_write_cstring(&writer, " ");
+            buffered_writer_write_i64(&writer, property->value);
+            buffered_writer_write_cstring(&writer, "\n");
+        }
+    }
+    buffered_writer_write_cstring(&writer, "ENDPROPERTIES\nCHARS ");
+    buffered_writer_write_i64(&writer, description.unique_glyph_count);
+    buffered_writer_write_cstring(&writer, "\n");
+
+    BdfChunkContext context = {.glyphs = glyphs, .description = &description};
+    buffered_writer_write_in_chunks(&writer, bdf_write_glyphs, &context, glyph_count, &temp_arena);
+
+    buffered_writer_write_cstring(&writer, "ENDFONT\n");
+    return buffered_writer_flush(&writer);
+}
+
+// Row padding of the PCF bitmaps in bytes (1, 2, 4 or 8) and the bit and byte order of all tables.
+// These are the bdftopcf defaults, X servers convert bitmaps into their own format when loading.
+#define PCF_GLYPH_PAD 4
+#define PCF_MSB_BIT_FIRST true
+#define PCF_MSB_BYTE_FIRST true
+
+#define PCF_PROPERTIES (1 << 0)
+#define PCF_ACCELERATORS (1 << 1)
+#define PCF_METRICS (1 << 2)
+#define PCF_BITMAPS (1 << 3)
+#define PCF_BDF_ENCODINGS (1 << 5)
+
+#define PCF_DEFAULT_FORMAT 0x00000000
+#define PCF_COMPRESSED_METRICS 0x00000100
+#define PCF_BYTE_MASK (1 << 2)
+#define PCF_BIT_MASK (1 << 3)
+
+#define PCF_TABLE_COUNT 5
+
+// One table of the PCF file, written in the byte order of its format.
+typedef struct {
+    i32 type;
+    i32 format;
+    u8 *data;
+    isize size;
+    isize capacity;
+} PcfTable;
+
+PcfTable pcf_table_make(i32 type, i32 format, isize capacity, Arena *arena) {
+    // Tables are 4 byte aligned within the file, the padding is a part of the table.
+    capacity = (capacity + 3) & ~(isize)3;
+
+    PcfTable table = {
+        .type = type,
+        .format = format,
+        .data = arena_alloc(arena, capacity),
+        .size = 0,
+        .capacity = capacity,
+    };
+    memset(table.data, 0, (size_t)capacity);
+    return table;
+}
+
+void pcf_table_write_bytes(PcfTable *table, void const *data, isize size) {
+    assert(table->size + size <= table->capacity);
+    memcpy(table->data + table->size, data, (size_t)size);
+    table->size += size;
+}
+
+void pcf_table_write_u8(PcfTable *table, u8 value) {
+    pcf_table_write_bytes(table, &value, 1);
+}
+
+void pcf_table_write_i16(PcfTable *table, i32 value) {
+    u8 bytes[2] = {(u8)value, (u8)(value >> 8)};
+    if ((table->format & PCF_BYTE_MASK) != 0) {
+        bytes[0] = (u8)(value >> 8);
+        bytes[1] = (u8)value;
+    }
+    pcf_table_write_bytes(table, bytes, 2);
+}
+
+void pcf_table_write_i32(PcfTable *table, i64 value) {
+    u8 bytes[4] = {(u8)value, (u8)(value >> 8), (u8)(value >> 16), (u8)(value >> 24)};
+    if ((table->format & PCF_BYTE_MASK) != 0) {
+        bytes[0] = (u8)(value >> 24);
+        bytes[1] = (u8)(value >> 16);
+        bytes[2] = (u8)(value >> 8);
+        bytes[3] = (u8)value;
+    }
+    pcf_table_write_bytes(table, bytes, 4);
+}
+
+// The format itself always goes in the LSB byte order.
+void pcf_table_write_format(PcfTable *table) {
+    u8 bytes[4] = {
+        (u8)table->format,
+        (u8)(table->format >> 8),
+        (u8)(table->format >> 16),
+        (u8)(table->format >> 24),
+    };
+    pcf_table_write_bytes(table, bytes, 4);
+}
+
+void pcf_table_write_metrics(PcfTable *table) {
+    pcf_table_write_i16(table, 0);              // Left side bearing
+    pcf_table_write_i16(table, GLYPH_WIDTH);    // Right side bearing
+    pcf_table_write_i16(table, GLYPH_WIDTH);    // Character width
+    pcf_table_write_i16(table, FONT_ASCENT);    // Ascent
+    pcf_table_write_i16(table, FONT_DESCENT);   // Descent
+    pcf_table_write_i16(table, 0);              // Attributes
+}
+
+u8 reverse_bits(u8 byte) {
+    byte = (u8)((byte & 0xf0) >> 4 | (byte & 0x0f) << 4);
+    byte = (u8)((byte & 0xcc) >> 2 | (byte & 0x33) << 2);
+    byte = (u8)((byte & 0xaa) >> 1 | (byte & 0x55) << 1);
+    return byte;
+}
+
+// Writes glyphs at the native size into the X11 Portable Compiled Format. Only the glyphs with char
+// codes up to U+FFFF make it into the file, because the encoding table is limited to 2 bytes.
+bool glyphs_export_as_pcf(FontJob const *job, Glyph const *glyphs, isize glyph_count, FILE *output_file, Arena *arena) {
+    static_assert(
+        PCF_GLYPH_PAD == 1 || PCF_GLYPH_PAD == 2 || PCF_GLYPH_PAD == 4 || PCF_GLYPH_PAD == 8,
+        "PCF_GLYPH_PAD must be 1, 2, 4 or 8."
+    );
+
+    Arena temp_arena = *arena;
+
+    FontDescription description;
+    font_description_init(&description, job->name, glyphs, glyph_count);
+
+    isize pcf_glyph_count = 0;
+    u32 min_char_code = 0xffff;
+    u32 max_char_code = 0x0000;
+    isize *pcf_glyph_indices = arena_alloc(&temp_arena, glyph_count * sizeof(isize));
+    for (isize glyph_index = 0; glyph_index < glyph_count; glyph_index += 1) {
+        u32 char_code = glyphs[glyph_index].char_code;
+        if (glyph_is_duplicate(glyphs, glyph_index) || char_code > 0xffff) {
+            continue;
+        }
+
+        pcf_glyph_indices[pcf_glyph_count] = glyph_index;
+        pcf_glyph_count += 1;
+        min_char_code = char_code < min_char_code ? char_code : min_char_code;
+        max_char_code = char_code > max_char_code ? char_code : max_char_code;
+    }
+    if (pcf_glyph_count == 0) {
+        LOG_ERROR("There are no glyphs which could be encoded into PCF.");
+        return false;
+    }
+
+    i32 byte_format =
+        (PCF_MSB_BIT_FIRST ? PCF_BIT_MASK : 0) |
+        (PCF_MSB_BYTE_FIRST ? PCF_BYTE_MASK : 0);
+    PcfTable tables[PCF_TABLE_COUNT];
+
+    {
+        // FONT is a regular property in PCF unlike BDF.
+        FontProperty properties[FONT_PROPERTY_MAX_COUNT + 1];
+        properties[0] = (FontProperty){"FONT", description.name, 0};
+        memcpy(
+            &properties[1],
+            description.properties,
+            (size_t)(description.property_count * sizeof(FontProperty))
+        );
+        isize property_count = description.property_count + 1;
+
+        isize strings_size = 0;
+        for (isize i = 0; i < property_count; i += 1) {
+            strings_size += (isize)strlen(properties[i].name) + 1;
+            if (properties[i].string_value != NULL) {
+                strings_size += (isize)strlen(properties[i].string_value) + 1;
+            }
+        }
+        isize properties_padding = (property_count & 3) == 0 ? 0 : 4 - (property_count & 3);
+
+        PcfTable *table = &tables[0];
+        *table = pcf_table_make(
+            PCF_PROPERTIES,
+            PCF_DEFAULT_FORMAT | byte_format,
+            4 + 4 + property_count * 9 + properties_padding + 4 + strings_size,
+            &temp_arena
+        );
+
+        pcf_table_write_format(table);
+        pcf_table_write_i32(table, property_count);
+
+        isize string_offset = 0;
+        for (isize i = 0; i < property_count; i += 1) {
+            pcf_table_write_i32(table, string_offset);
+            string_offset += (isize)strlen(properties[i].name) + 1;
+
+            if (properties[i].string_value != NULL) {
+                pcf_table_write_u8(table, 1);
+                pcf_table_write_i32(table, string_offset);
+                string_offset += (isize)strlen(properties[i].string_value) + 1;
+            } else {
+                pcf_table_write_u8(table, 0);
+                pcf_table_write_i32(table, properties[i].value);
+            }
+        }
+        table->size += properties_padding;
+
+        pcf_table_write_i32(table, strings_size);
+        for (isize i = 0; i < property_count; i += 1) {
+            pcf_table_write_bytes(table, properties[i].name, (isize)strlen(properties[i].name) + 1);
+            if (properties[i].string_value != NULL) {
+                pcf_table_write_bytes(
+                    table,
+                    properties[i].string_value,
+                    (isize)strlen(properties[i].string_value) + 1
+                );
+            }
+        }
+    }
+
+    {
+        PcfTable *table = &tables[1];
+        *table = pcf_table_make(PCF_ACCELERATORS, PCF_DEFAULT_FORMAT | byte_format, 48, &temp_arena);
+
+        pcf_table_write_format(table);
+        pcf_table_write_u8(table, 1);   // No overlap
+        pcf_table_write_u8(table, 1);   // Constant metrics
+        pcf_table_write_u8(table, 1);   // Terminal font
+        pcf_table_write_u8(table, 1);   // Constant width
+        pcf_table_write_u8(table, 1);   // Ink inside
+        pcf_table_write_u8(table, 0);   // Ink metrics
+        pcf_table_write_u8(table, 0);   // Draw direction: left to right
+        pcf_table_write_u8(table, 0);   // Padding
+        pcf_table_write_i32(table, FONT_ASCENT);
+        pcf_table_write_i32(table, FONT_DESCENT);
+        pcf_table_write_i32(table, 0);  // Max overlap
+        // Min and max bounds, which are the same, because every glyph has the same metrics.
+        pcf_table_write_metrics(table);
+        pcf_table_write_metrics(table);
+    }
+
+    {
+        PcfTable *table = &tables[2];
+        *table = pcf_table_make(
+            PCF_METRICS,
+            PCF_COMPRESSED_METRICS | byte_format,
+            4 + 2 + pcf_glyph_count * 5,
+            &temp_arena
+        );
+
+        pcf_table_write_format(table);
+        pcf_table_write_i16(table, (i32)pcf_glyph_count);
+        for (isize i = 0; i < pcf_glyph_count; i += 1) {
+            // Compressed metrics are stored as unsigned bytes offset by 0x80.
+            pcf_table_write_u8(table, 0x80 + 0);               // Left side bearing
+            pcf_table_write_u8(table, 0x80 + GLYPH_WIDTH);     // Right side bearing
+            pcf_table_write_u8(table, 0x80 + GLYPH_WIDTH);     // Character width
+            pcf_table_write_u8(table, 0x80 + FONT_ASCENT);     // Ascent
+            pcf_table_write_u8(table, 0x80 + FONT_DESCENT);    // Descent
+        }
+    }
+
+    {
+        isize glyph_pad_index = PCF_GLYPH_PAD == 1 ? 0 : PCF_GLYPH_PAD == 2 ? 1 : PCF_GLYPH_PAD == 4 ? 2 : 3;
+        isize glyph_size = GLYPH_HEIGHT * PCF_GLYPH_PAD;
+
+        // Glyphs which look the same point at the same bitmap data. Some of the bitmaps might be used
+        // by the left out glyphs only, so they are renumbered.
+        isize *pcf_bitmap_indices = arena_alloc(&temp_arena, glyph_count * sizeof(isize));
+        for (isize i = 0; i < glyph_count; i += 1) {
+            pcf_bitmap_indices[i] = -1;
+        }
+        isize pcf_bitmap_count = 0;
+        for (isize i = 0; i < pcf_glyph_count; i += 1) {
+            isize bitmap_index = glyphs[pcf_glyph_indices[i]].bitmap_index;
+            if (pcf_bitmap_indices[bitmap_index] < 0) {
+                pcf_bitmap_indices[bitmap_index] = pcf_bitmap_count;
+                pcf_bitmap_count += 1;
+            }
+        }
+
+        PcfTable *table = &tables[3];
+        *table = pcf_table_make(
+            PCF_BITMAPS,
+            (i32)glyph_pad_index | byte_format,
+            4 + 4 + pcf_glyph_count * 4 + 4 * 4 + pcf_bitmap_count * glyph_size,
+            &temp_arena
+        );
+
+        pcf_table_write_format(table);
+        pcf_table_write_i32(table, pcf_glyph_count);
+        for (isize i = 0; i < pcf_glyph_count; i += 1) {
+            pcf_table_write_i32(table, pcf_bitmap_indices[glyphs[pcf_glyph_indices[i]].bitmap_index] * glyph_size);
+        }
+        // Sizes of the bitmap data for each of the possible paddings.
+        for (isize pad = 1; pad <= 8; pad *= 2) {
+            pcf_table_write_i32(table, pcf_bitmap_count * GLYPH_HEIGHT * pad);
+        }
+
+        isize written_bitmap_count = 0;
+        for (isize i = 0; i < pcf_glyph_count; i += 1) {
+            Glyph const *glyph = &glyphs[pcf_glyph_indices[i]];
+            if (pcf_bitmap_indices[glyph->bitmap_index] != written_bitmap_count) {
+                continue;
+            }
+            written_bitmap_count += 1;
+
+            for (isize glyph_y = 0; glyph_y < GLYPH_HEIGHT; glyph_y += 1) {
+                u8 row = PCF_MSB_BIT_FIRST ? glyph->rows[glyph_y] : reverse_bits(glyph->rows[glyph_y]);
+                pcf_table_write_u8(table, row);
+                // Scan unit is 1 byte, so the padding always goes after the row regardless of the byte order.
+                table->size += PCF_GLYPH_PAD - 1;
+            }
+        }
+    }
+
+    {
+        u32 min_byte1 = min_char_code >> 8;
+        u32 max_byte1 = max_char_code >> 8;
+        u32 min_byte2 = 0xff;
+        u32 max_byte2 = 0x00;
+        for (isize i = 0; i < pcf_glyph_count; i += 1) {
+            u32 byte2 = glyphs[pcf_glyph_indices[i]].char_code & 0xff;
+            min_byte2 = byte2 < min_byte2 ? byte2 : min_byte2;
+            max_byte2 = byte2 > max_byte2 ? byte2 : max_byte2;
+        }
+        isize row_size = (isize)(max_byte2 - min_byte2 + 1);
+        isize encoding_count = row_size * (isize)(max_byte1 - min_byte1 + 1);
+
+        PcfTable *table = &tables[4];
+        *table = pcf_table_make(
+            PCF_BDF_ENCODINGS,
+            PCF_DEFAULT_FORMAT | byte_format,
+            4 + 5 * 2 + encoding_count * 2,
+            &temp_arena
+        );
+
+        pcf_table_write_format(table);
+        pcf_table_write_i16(table, (i32)min_byte2);
+        pcf_table_write_i16(table, (i32)max_byte2);
+        pcf_table_write_i16(table, (i32)min_byte1);
+        pcf_table_write_i16(table, (i32)max_byte1);
+        pcf_table_write_i16(table, description.has_fallback_glyph ? GLYPH_INDEX_FALLBACK_CHAR_CODE : 0xffff);
+
+        // Missing char codes are marked with 0xffff.
+        isize encodings_start = table->size;
+        memset(table->data + encodings_start, 0xff, (size_t)(encoding_count * 2));
+        for (isize i = 0; i < pcf_glyph_count; i += 1) {
+            u32 char_code = glyphs[pcf_glyph_indices[i]].char_code;
+            isize encoding_index = (isize)((char_code >> 8) - min_byte1) * row_size +
+                (isize)((char_code & 0xff) - min_byte2);
+
+            table->size = encodings_start + encoding_index * 2;
+            pcf_table_write_i16(table, (i32)i);
+        }
+        table->size = encodings_start + encoding_count * 2;
+    }
+
+    BufferedWriter writer = buffered_writer_make(output_file, &temp_arena);
+
+    // The header and the table of contents are always in the LSB byte order.
+    PcfTable header = pcf_table_make(0, PCF_DEFAULT_FORMAT, 8 + PCF_TABLE_COUNT * 16, &temp_arena);
+    pcf_table_write_bytes(&header, "\1fcp", 4);
+    pcf_table_write_i32(&header, PCF_TABLE_COUNT);
+
+    isize table_offset = header.capacity;
+    for (isize i = 0; i < PCF_TABLE_COUNT; i += 1) {
+        pcf_table_write_i32(&header, tables[i].type);
+        pcf_table_write_i32(&header, tables[i].format);
+        pcf_table_write_i32(&header, tables[i].capacity);
+        pcf_table_write_i32(&header, table_offset);
+        table_offset += tables[i].capacity;
+    }
+
+    buffered_writer_write(&writer, header.data, header.size);
+    for (isize i = 0; i < PCF_TABLE_COUNT; i += 1) {
+        buffered_writer_write(&writer, tables[i].data, tables[i].capacity);
+    }
+    return buffered_writer_flush(&writer);
+}
+
+// Pixel format of the bitmaps in the binary font file, unless the job sets one.
+#define FONT_FILE_PIXEL_FORMAT PIXEL_FORMAT_1BPP
+
+static u8 const font_file_pixel_formats[PIXEL_FORMAT_COUNT] = {
+    [PIXEL_FORMAT_1BPP] = FONT8X8_FILE_PIXEL_FORMAT_PACKED,
+    [PIXEL_FORMAT_A8] = FONT8X8_FILE_PIXEL_FORMAT_A8,
+    [PIXEL_FORMAT_RGB565] = FONT8X8_FILE_PIXEL_FORMAT_RGB565,
+    [PIXEL_FORMAT_RGBA8888] = FONT8X8_FILE_PIXEL_FORMAT_RGBA8888,
+    [PIXEL_FORMAT_BGRA8888] = FONT8X8_FILE_PIXEL_FORMAT_BGRA8888,
+    [PIXEL_FORMAT_ARGB8888_PREMULTIPLIED] = FONT8X8_FILE_PIXEL_FORMAT_ARGB8888_PREMULTIPLIED,
+};
+
+isize align_forward(isize offset, isize alignment) {
+    return (offset + alignment - 1) & ~(alignment - 1);
+}
+
+// Writes glyphs at the native size into the binary font file, which can be loaded at runtime without
+// any parsing (see font8x8_file.h).
+bool glyphs_export_as_font_file(
+    FontJob const *job,
+    Glyph const *glyphs,
+    isize glyph_count,
+    FILE *output_file,
+    Arena *arena
+) {
+    static_assert(
+        FONT_FILE_PIXEL_FORMAT != PIXEL_FORMAT_DEFAULT,
+        "FONT_FILE_PIXEL_FORMAT must be a PixelFormat other than the default."
+    );
+    PixelFormat pixel_format = job->pixel_format != PIXEL_FORMAT_DEFAULT ? job->pixel_format : FONT_FILE_PIXEL_FORMAT;
+
+    Arena temp_arena = *arena;
+    Font8x8Index index = glyphs_build_index(glyphs, glyph_count, &temp_arena);
+    isize bitmap_count = glyphs_bitmap_count(glyphs, glyph_count);
+
+    isize string_pool_size = 0;
+    for (isize glyph_index = 0; glyph_index < glyph_count; glyph_index += 1) {
+        string_pool_size += (isize)strlen(glyphs[glyph_index].char_data) + 1;
+    }
+    isize glyph_stride = pixel_format_row_size(pixel_format, GLYPH_WIDTH) * GLYPH_HEIGHT;
+
+    Font8x8FileHeader header = {
+        .magic = FONT8X8_FILE_MAGIC,
+        .byte_order_mark = FONT8X8_FILE_BYTE_ORDER_MARK,
+        .version = FONT8X8_FILE_VERSION,
+        .header_size = sizeof(Font8x8FileHeader),
+        .glyph_width = GLYPH_WIDTH,
+        .glyph_height = GLYPH_HEIGHT,
+        .pixel_format = font_file_pixel_formats[pixel_format],
+        .glyph_count = (u32)glyph_count,
+        .bitmap_count = (u32)bitmap_count,
+        .glyph_stride = (u32)glyph_stride,
+        .direct_count = index.direct_count,
+        .range_count = index.range_count,
+        .fallback_glyph_index = index.fallback_glyph_index,
+        .string_pool_size = (u32)string_pool_size,
+    };
+
+    isize file_size = sizeof(Font8x8FileHeader);
+    header.char_codes_offset = (u32)file_size;
+    file_size += glyph_count * sizeof(u32);
+    header.direct_glyph_indices_offset = (u32)file_size;
+    file_size += index.direct_count * sizeof(u16);
+    file_size = align_forward(file_size, 4);
+    header.ranges_offset = (u32)file_size;
+    file_size += index.range_count * sizeof(Font8x8Range);
+    header.char_data_offsets_offset = (u32)file_size;
+    file_size += glyph_count * sizeof(u32);
+    header.glyph_bitmap_indices_offset = (u32)file_size;
+    file_size += glyph_count * sizeof(u16);
+    header.string_pool_offset = (u32)file_size;
+    file_size += string_pool_size;
+    file_size = align_forward(file_size, FONT8X8_FILE_BITMAP_ALIGNMENT);
+    header.bitmaps_offset = (u32)file_size;
+    file_size += bitmap_count * glyph_stride;
+    header.file_size = (u32)file_size;
+
+    u8 *file_data = arena_alloc_aligned(&temp_arena, file_size, FONT8X8_FILE_BITMAP_ALIGNMENT);
+    memset(file_data, 0, (size_t)file_size);
+    memcpy(file_data, &header, sizeof(header));
+
+    u32 *char_codes = (u32 *)&file_data[header.char_codes_offset];
+    u32 *char_data_offsets = (u32 *)&file_data[header.char_data_offsets_offset];
+    u16 *glyph_bitmap_indices = (u16 *)&file_data[header.glyph_bitmap_indices_offset];
+    char *string_pool = (char *)&file_data[header.string_pool_offset];
+    u8 *bitmaps = &file_data[header.bitmaps_offset];
+
+    memcpy(
+        &file_data[header.direct_glyph_indices_offset],
+        index.direct_glyph_indices,
+        (size_t)(index.direct_count * sizeof(u16))
+    );
+    memcpy(&file_data[header.ranges_offset], index.ranges, (size_t)(index.range_count * sizeof(Font8x8Range)));
+
+    isize string_offset = 0;
+    isize written_bitmap_count = 0;
+    for (isize glyph_index = 0; glyph_index < glyph_count; glyph_index += 1) {
+        Glyph const *glyph = &glyphs[glyph_index];
+
+        char_codes[glyph_index] = glyph->char_code;
+
+        isize char_data_size = (isize)strlen(glyph->char_data) + 1;
+        char_data_offsets[glyph_index] = (u32)string_offset;
+        memcpy(&string_pool[string_offset], glyph->char_data, (size_t)char_data_size);
+        string_offset += char_data_size;
+
+        glyph_bitmap_indices[glyph_index] = (u16)glyph->bitmap_index;
+        if (glyph->bitmap_index != written_bitmap_count) {
+            continue;
+        }
+        written_bitmap_count += 1;
+
+        // The bitmaps are always at the native size, unlike the glyph bitmaps.
+        u8 *bitmap = &bitmaps[glyph->bitmap_index * glyph_stride];
+        if (pixel_format == PIXEL_FORMAT_1BPP) {
+            memcpy(bitmap, glyph->rows, GLYPH_HEIGHT);
+        } else {
+            Glyph native_glyph = *glyph;
+            u32 colors[GLYPH_WIDTH * GLYPH_HEIGHT];
+            native_glyph.bitmap = colors;
+            glyph_expand_bitmap(&native_glyph, 1, job->ink_color, job->background_color);
+            pixels_encode(colors, GLYPH_WIDTH, GLYPH_HEIGHT, pixel_format, job->ink_color, bitmap);
+        }
+    }
+
+    return fwrite(file_data, 1, (size_t)file_size, output_file) == (size_t)file_size && fflush(output_file) == 0;
+}
+
+// The sidecar cache of the previous run. When the inputs and the generator itself are the same, the
+// run is skipped, otherwise the cells are compared with the cached ones to report what changed.
+// Delete it to force a full regeneration.
+#define GLYPH_CACHE_SUFFIX ".cache"
+#define GLYPH_CACHE_MAGIC 0x43583846 // "F8XC"
+// Bump the version whenever an exporter starts to write something different for the same inputs.
+#define GLYPH_CACHE_VERSION 3
+// The compile-time settings which change the outputs (the settings of the jobs are hashed on their
+// own), so that rebuilding the same generator keeps the caches valid.
+#define GLYPH_CACHE_GENERATOR_KEY                                                                       \
+    "version=" STRINGIFY(GLYPH_CACHE_VERSION)                                                           \
+    " glyph=" STRINGIFY(GLYPH_WIDTH) "x" STRINGIFY(GLYPH_HEIGHT)                                        \
+    " index=" STRINGIFY(GLYPH_INDEX_DIRECT_LIMIT) "," STRINGIFY(GLYPH_INDEX_DIRECT_MIN_DENSITY)         \
+        "," STRINGIFY(GLYPH_INDEX_FALLBACK_CHAR_CODE)                                                   \
+    " style=" STRINGIFY(STYLE_ITALIC_ROWS_PER_PIXEL) "," STRINGIFY(STYLE_ITALIC_BASE_ROW)               \
+        "," STRINGIFY(STYLE_UNDERLINE_ROW) "," STRINGIFY(STYLE_STRIKE_ROW)                              \
+    " atlas=" STRINGIFY(ATLAS_BORDERS) "," STRINGIFY(ATLAS_KEY_COLOR) "," STRINGIFY(ATLAS_MAX_SIZE)     \
+        "," STRINGIFY(ATLAS_FILE_FORMAT)                                                                \
+    " bdf=" STRINGIFY(FONT_ASCENT) "," STRINGIFY(FONT_RESOLUTION)                                       \
+    " pcf=" STRINGIFY(PCF_GLYPH_PAD) "," STRINGIFY(PCF_MSB_BIT_FIRST) "," STRINGIFY(PCF_MSB_BYTE_FIRST) \
+    " f8x8=" STRINGIFY(FONT_FILE_PIXEL_FORMAT)
+
+// Outputs are written into a temporary file next to them, which replaces the output only if the
+// content differs, so that the unchanged files keep their timestamps and don't trigger rebuilds.
+#define OUTPUT_TEMP_SUFFIX ".tmp"
+#define OUTPUT_PATH_CAPACITY 256
+
+typedef struct {
+    u32 cell_index;
+    u32 char_code;
+    u64 mask;
+} GlyphCacheCell;
+
+typedef struct {
+    u32 magic;
+    u32 version;
+    u64 input_hash;
+    u64 cell_count;
+} GlyphCacheHeader;
+
+typedef struct {
+    GlyphCacheHeader header;
+    GlyphCacheCell *cells;
+} GlyphCache;
+
+u64 fnv1a_update(u64 hash, u8 const *data, isize size) {
+    for (isize i = 0; i < size; i += 1) {
+        hash = (hash ^ data[i]) * 0x00000100000001b3;
+    }
+    return hash;
+}
+
+#define FNV1A_INITIAL_HASH 0xcbf29ce484222325
+
+bool glyph_cache_read(char const *file_path, GlyphCache *cache, Arena *arena) {
+    FILE *file = fopen(file_path, "rb");
+    if (file == NULL) {
+        return false;
+    }
+
+    bool is_valid =
+        fread(&cache->header, sizeof(GlyphCacheHeader), 1, file) == 1 &&
+        cache->header.magic == GLYPH_CACHE_MAGIC &&
+        cache->header.version == GLYPH_CACHE_VERSION &&
+        cache->header.cell_count <= 0xffff;
+    if (is_valid) {
+        isize cells_size = (isize)cache->header.cell_count * sizeof(GlyphCacheCell);
+        cache->cells = arena_alloc(arena, cells_size);
+        is_valid = fread(cache->cells, 1, (size_t)cells_size, file) == (size_t)cells_size;
+    }
+
+    fclose(file);
+    return is_valid;
+}
+
+bool glyph_cache_write(char const *file_path, GlyphCache const *cache) {
+    FILE *file = fopen(file_path, "wb");
+    if (file == NULL) {
+        return false;
+    }
+
+    isize cells_size = (isize)cache->header.cell_count * sizeof(GlyphCacheCell);
+    bool is_written =
+        fwrite(&cache->header, sizeof(GlyphCacheHeader), 1, file) == 1 &&
+        fwrite(cache->cells, 1, (size_t)cells_size, file) == (size_t)cells_size;
+    return fclose(file) == 0 && is_written;
+}
+
+// Counts the cells which were added, removed, redrawn or assigned to another char. Both arrays are
+// sorted by cell index.
+isize glyph_cache_count_dirty_cells(GlyphCache const *old_cache, GlyphCache const *new_cache) {
+    isize dirty_cell_count = 0;
+    isize old_index = 0;
+    isize new_index = 0;
+    while (old_index < (isize)old_cache->header.cell_count || new_index < (isize)new_cache->header.cell_count) {
+        GlyphCacheCell const *old_cell =
+            old_index < (isize)old_cache->header.cell_count ? &old_cache->cells[old_index] : NULL;
+        GlyphCacheCell const *new_cell =
+            new_index < (isize)new_cache->header.cell_count ? &new_cache->cells[new_index] : NULL;
+
+        if (new_cell == NULL || (old_cell != NULL && old_cell->cell_index < new_cell->cell_index)) {
+            old_index += 1;
+        } else if (old_cell == NULL || new_cell->cell_index < old_cell->cell_index) {
+            new_index += 1;
+        } else {
+            old_index += 1;
+            new_index += 1;
+            if (old_cell->char_code == new_cell->char_code && old_cell->mask == new_cell->mask) {
+                continue;
+            }
+        }
+        dirty_cell_count += 1;
+    }
+    return dirty_cell_count;
+}
+
+FILE *output_file_open(char const *file_path, char *temp_file_path) {
+    int temp_file_path_size = snprintf(
+        temp_file_path,
+        OUTPUT_PATH_CAPACITY,
+        "%s" OUTPUT_TEMP_SUFFIX,
+        file_path
+    );
+    if (temp_file_path_size < 0 || temp_file_path_size >= OUTPUT_PATH_CAPACITY) {
+        return NULL;
+    }
+    return fopen(temp_file_path, "wb");
+}
+
+// Closes the temporary file and moves it into place, unless the output already has the same content.
+bool output_file_commit(
+    FILE *file,
+    char const *file_path,
+    char const *temp_file_path,
+    bool *was_changed,
+    Arena *arena
+) {
+    if (fclose(file) != 0) {
+        remove(temp_file_path);
+        return false;
+    }
+
+    Arena temp_arena = *arena;
+    String new_content = {0};
+    String old_content = {0};
+    if (
+        file_read_to_string(temp_file_path, &new_content, &temp_arena) &&
+        file_read_to_string(file_path, &old_content, &temp_arena) &&
+        new_content.size == old_content.size &&
+        memcmp(new_content.data, old_content.data, (size_t)new_content.size) == 0
+    ) {
+        *was_changed = false;
+        return remove(temp_file_path) == 0;
+    }
+
+    *was_changed = true;
+    // rename doesn't replace existing files everywhere.
+    remove(file_path);
+    return rename(temp_file_path, file_path) == 0;
+}
+
+bool file_exists(char const *file_path) {
+    FILE *file = fopen(file_path, "rb");
+    if (file == NULL) {
+        return false;
+    }
+    fclose(file);
+    return true;
+}
+
+
+typedef enum {
+    OUTPUT_FILE_C_ARRAY,
+    OUTPUT_FILE_PACKED_C_ARRAY,
+    OUTPUT_FILE_BDF,
+    OUTPUT_FILE_PCF,
+    OUTPUT_FILE_FONT_FILE,
+    OUTPUT_FILE_ATLAS_IMAGE,
+    OUTPUT_FILE_ATLAS_RECTS,
+    OUTPUT_FILE_COLUMNS_C_ARRAY,
+    OUTPUT_FILE_SDF_ATLAS_IMAGE,
+    OUTPUT_FILE_SDF_ATLAS_RECTS,
+    OUTPUT_FILE_GPU_BUFFER,
+    OUTPUT_FILE_GPU_SHADER,
+    OUTPUT_FILE_COUNT,
+} OutputFile;
+
+static u32 const output_file_formats[OUTPUT_FILE_COUNT] = {
+    [OUTPUT_FILE_C_ARRAY] = OUTPUT_FORMAT_C_ARRAY,
+    [OUTPUT_FILE_PACKED_C_ARRAY] = OUTPUT_FORMAT_PACKED_C_ARRAY,
+    [OUTPUT_FILE_BDF] = OUTPUT_FORMAT_BDF,
+    [OUTPUT_FILE_PCF] = OUTPUT_FORMAT_PCF,
+    [OUTPUT_FILE_FONT_FILE] = OUTPUT_FORMAT_FONT_FILE,
+    [OUTPUT_FILE_ATLAS_IMAGE] = OUTPUT_FORMAT_ATLAS,
+    [OUTPUT_FILE_ATLAS_RECTS] = OUTPUT_FORMAT_ATLAS,
+    [OUTPUT_FILE_COLUMNS_C_ARRAY] = OUTPUT_FORMAT_COLUMNS_C_ARRAY,
+    [OUTPUT_FILE_SDF_ATLAS_IMAGE] = OUTPUT_FORMAT_SDF_ATLAS,
+    [OUTPUT_FILE_SDF_ATLAS_RECTS] = OUTPUT_FORMAT_SDF_ATLAS,
+    [OUTPUT_FILE_GPU_BUFFER] = OUTPUT_FORMAT_GPU_BUFFER,
+    [OUTPUT_FILE_GPU_SHADER] = OUTPUT_FORMAT_GPU_BUFFER,
+};
+
+char const *output_file_suffix(FontJob const *job, OutputFile output_file) {
+    switch (output_file) {
+    case OUTPUT_FILE_C_ARRAY: return ".c";
+    case OUTPUT_FILE_PACKED_C_ARRAY: return "_packed.c";
+    case OUTPUT_FILE_BDF: return ".bdf";
+    case OUTPUT_FILE_PCF: return ".pcf";
+    case OUTPUT_FILE_FONT_FILE: return ".f8x8";
+    case OUTPUT_FILE_ATLAS_IMAGE:
+    case OUTPUT_FILE_SDF_ATLAS_IMAGE: {
+        // By the pixel format of the raw files, the PNG goes in place of the default one.
+        static char const *const suffixes[2][PIXEL_FORMAT_COUNT] = {
+            {
+                [PIXEL_FORMAT_DEFAULT] = "_atlas.png",
+                [PIXEL_FORMAT_1BPP] = "_atlas.1bpp",
+                [PIXEL_FORMAT_A8] = "_atlas.a8",
+                [PIXEL_FORMAT_RGB565] = "_atlas.rgb565",
+                [PIXEL_FORMAT_RGBA8888] = "_atlas.rgba",
+                [PIXEL_FORMAT_BGRA8888] = "_atlas.bgra",
+                [PIXEL_FORMAT_ARGB8888_PREMULTIPLIED] = "_atlas.argb",
+            },
+            {
+                [PIXEL_FORMAT_DEFAULT] = "_sdf_atlas.png",
+                [PIXEL_FORMAT_1BPP] = "_sdf_atlas.1bpp",
+                [PIXEL_FORMAT_A8] = "_sdf_atlas.a8",
+                [PIXEL_FORMAT_RGB565] = "_sdf_atlas.rgb565",
+                [PIXEL_FORMAT_RGBA8888] = "_sdf_atlas.rgba",
+                [PIXEL_FORMAT_BGRA8888] = "_sdf_atlas.bgra",
+                [PIXEL_FORMAT_ARGB8888_PREMULTIPLIED] = "_sdf_atlas.argb",
+            },
+        };
+        PixelFormat pixel_format = font_job_atlas_file_format(job) == ATLAS_FILE_PNG
+            ? PIXEL_FORMAT_DEFAULT
+            : font_job_atlas_pixel_format(job);
+        return suffixes[output_file == OUTPUT_FILE_SDF_ATLAS_IMAGE ? 1 : 0][pixel_format];
+    }
+    case OUTPUT_FILE_ATLAS_RECTS: return "_atlas.c";
+    case OUTPUT_FILE_COLUMNS_C_ARRAY: return "_columns.c";
+    case OUTPUT_FILE_SDF_ATLAS_RECTS: return "_sdf_atlas.c";
+    case OUTPUT_FILE_GPU_BUFFER: return "_gpu.c";
+    case OUTPUT_FILE_GPU_SHADER: return "_gpu.glsl";
+    default: UNREACHABLE(); return NULL;
+    }
+}
+
+bool output_file_export(
+    FontJob const *job,
+    OutputFile output_file,
+    Glyph const *glyphs,
+    isize glyph_count,
+    Atlas const *atlas,
+    Atlas const *sdf_atlas,
+    FILE *file,
+    Arena *arena
+) {
+    // The rects of the distance field atlas get their own symbols, so that both can be included.
+    char sdf_name[FONT_JOB_NAME_CAPACITY + 4];
+    snprintf(sdf_name, sizeof(sdf_name), "%s_sdf", job->name);
+
+    switch (output_file) {
+    case OUTPUT_FILE_C_ARRAY: return glyphs_export_as_c_array(job, glyphs, glyph_count, file, arena);
+    case OUTPUT_FILE_PACKED_C_ARRAY: return glyphs_export_as_packed_c_array(job, glyphs, glyph_count, file, arena);
+    case OUTPUT_FILE_BDF: return glyphs_export_as_bdf(job, glyphs, glyph_count, file, arena);
+    case OUTPUT_FILE_PCF: return glyphs_export_as_pcf(job, glyphs, glyph_count, file, arena);
+    case OUTPUT_FILE_FONT_FILE: return glyphs_export_as_font_file(job, glyphs, glyph_count, file, arena);
+    case OUTPUT_FILE_ATLAS_IMAGE:
+        atlas_write(atlas, job, file, arena);
+        return ferror(file) == 0;
+    case OUTPUT_FILE_ATLAS_RECTS: return atlas_export_rects_as_c_array(job->name, atlas, glyphs, glyph_count, file, arena);
+    case OUTPUT_FILE_COLUMNS_C_ARRAY: return glyphs_export_as_columns_c_array(job, glyphs, glyph_count, file, arena);
+    case OUTPUT_FILE_SDF_ATLAS_IMAGE:
+        atlas_write(sdf_atlas, job, file, arena);
+        return ferror(file) == 0;
+    case OUTPUT_FILE_SDF_ATLAS_RECTS: return atlas_export_rects_as_c_array(sdf_name, sdf_atlas, glyphs, glyph_count, file, arena);
+    case OUTPUT_FILE_GPU_BUFFER: return glyphs_export_as_gpu_buffer(job, glyphs, glyph_count, file, arena);
+    case OUTPUT_FILE_GPU_SHADER: return glyphs_export_gpu_shader(job, file, arena);
+    default: UNREACHABLE(); return false;
+    }
+}
+
+bool font_job_make_path(FontJob const *job, char const *suffix, char *path) {
+    int path_size = snprintf(path, OUTPUT_PATH_CAPACITY, "%s/%s%s", job->output_directory, job->name, suffix);
+    return path_size >= 0 && path_size < OUTPUT_PATH_CAPACITY;
+}
+
+u64 time_now_ns(void) {
+    struct timespec time;
+    timespec_get(&time, TIME_UTC);
+    return (u64)time.tv_sec * 1000000000 + (u64)time.tv_nsec;
+}
+
+// Returns the time since the lap start and starts the next lap.
+u64 time_lap_ns(u64 *lap_start_ns) {
+    u64 now_ns = time_now_ns();
+    u64 elapsed_ns = now_ns - *lap_start_ns;
+    *lap_start_ns = now_ns;
+    return elapsed_ns;
+}
+
+typedef enum {
+    JOB_PHASE_READ,
+    JOB_PHASE_CACHE_CHECK,
+    JOB_PHASE_DECODE,
+    JOB_PHASE_EXTRACT,
+    // Sorting, the subset, bitmap dedup and the atlas packing.
+    JOB_PHASE_PREPARE,
+    JOB_PHASE_EXPORT,
+    JOB_PHASE_CACHE_WRITE,
+    JOB_PHASE_COUNT,
+} JobPhase;
+
+static char const *const job_phase_names[JOB_PHASE_COUNT] = {
+    [JOB_PHASE_READ] = "read",
+    [JOB_PHASE_CACHE_CHECK] = "cache_check",
+    [JOB_PHASE_DECODE] = "decode",
+    [JOB_PHASE_EXTRACT] = "extract",
+    [JOB_PHASE_PREPARE] = "prepare",
+    [JOB_PHASE_EXPORT] = "export",
+    [JOB_PHASE_CACHE_WRITE] = "cache_write",
+};
+
+// Filled by font_job_run and printed with --stats.
+typedef struct {
+    bool is_up_to_date;
+    u64 total_ns;
+    u64 phase_ns[JOB_PHASE_COUNT];
+    // The high-water mark of the job arena and everything which was left in it.
+    isize arena_used_size;
+    isize arena_capacity;
+    isize decoder_allocated_size;
+    isize glyph_count;
+    isize bitmap_count;
+    // -1 for the outputs which were not written.
+    isize output_sizes[OUTPUT_FILE_COUNT];
+    u64 output_ns[OUTPUT_FILE_COUNT];
+} FontJobStats;
+
+typedef enum {
+    STATS_FORMAT_NONE,
+    STATS_FORMAT_TEXT,
+    STATS_FORMAT_JSON,
+} StatsFormat;
+
+// Prints all the stats of the job with a single write, so that the workers don't mix their lines.
+// Font names are identifiers, so they go into JSON as they are.
+void font_job_stats_print(FontJob const *job, FontJobStats const *stats, StatsFormat format, Arena *arena) {
+    Arena temp_arena = *arena;
+    BufferedWriter writer = buffered_writer_make_growable(stdout, &temp_arena);
+    f64 const mega = 1024.0 * 1024.0;
+
+    if (format == STATS_FORMAT_JSON) {
+        buffered_writer_write_format(
+            &writer,
+            "{\"font\":\"%s\",\"up_to_date\":%s,\"total_ns\":%llu,\"phases_ns\":{",
+            job->name,
+            stats->is_up_to_date ? "true" : "false",
+            (unsigned long long)stats->total_ns
+        );
+        for (isize i = 0; i < JOB_PHASE_COUNT; i += 1) {
+            buffered_writer_write_format(
+                &writer,
+                "%s\"%s\":%llu",
+                i > 0 ? "," : "",
+                job_phase_names[i],
+                (unsigned long long)stats->phase_ns[i]
+            );
+        }
+        buffered_writer_write_format(
+            &writer,
+            "},\"arena_used\":%ld,\"arena_capacity\":%ld,\"decoder_allocated\":%ld,"
+            "\"glyph_count\":%ld,\"bitmap_count\":%ld,\"outputs\":{",
+            stats->arena_used_size,
+            stats->arena_capacity,
+            stats->decoder_allocated_size,
+            stats->glyph_count,
+            stats->bitmap_count
+        );
+        bool is_first_output = true;
+        for (isize i = 0; i < OUTPUT_FILE_COUNT; i += 1) {
+            if (stats->output_sizes[i] < 0) {
+                continue;
+            }
+            buffered_writer_write_format(
+                &writer,
+                "%s\"%s\":{\"size\":%ld,\"ns\":%llu}",
+                is_first_output ? "" : ",",
+                output_file_suffix(job, (OutputFile)i),
+                stats->output_sizes[i],
+                (unsigned long long)stats->output_ns[i]
+            );
+            is_first_output = false;
+        }
+        buffered_writer_write_cstring(&writer, "}}\n");
+    } else {
+        buffered_writer_write_format(
+            &writer,
+            "%s: %.3f ms%s\n",
+            job->name,
+            (f64)stats->total_ns / 1e6,
+            stats->is_up_to_date ? ", up to date" : ""
+        );
+        for (isize i = 0; i < JOB_PHASE_COUNT; i += 1) {
+            buffered_writer_write_format(&writer, "    %-12s %10.3f ms\n", job_phase_names[i], (f64)stats->phase_ns[i] / 1e6);
+        }
+        buffered_writer_write_format(
+            &writer,
+            "    arena        %10.3f MB of %.1f MB, of which stb_image %.3f MB\n",
+            (f64)stats->arena_used_size / mega,
+            (f64)stats->arena_capacity / mega,
+            (f64)stats->decoder_allocated_size / mega
+        );
+        if (stats->bitmap_count > 0) {
+            buffered_writer_write_format(
+                &writer,
+                "    glyphs       %10ld, %ld distinct bitmaps (%.2f glyphs per bitmap)\n",
+                stats->glyph_count,
+                stats->bitmap_count,
+                (f64)stats->glyph_count / (f64)stats->bitmap_count
+            );
+        }
+        for (isize i = 0; i < OUTPUT_FILE_COUNT; i += 1) {
+            if (stats->output_sizes[i] < 0) {
+                continue;
+            }
+            buffered_writer_write_format(
+                &writer,
+                "    %-12s %10ld bytes in %.3f ms\n",
+                output_file_suffix(job, (OutputFile)i),
+                stats->output_sizes[i],
+                (f64)stats->output_ns[i] / 1e6
+            );
+        }
+    }
+
+    buffered_writer_flush(&writer);
+    fflush(stdout);
+}
+
+typedef struct {
+    i32 width;
+    i32 height;
+    // One byte per pixel.
+    u8 *pixels;
+    // Everything stb_image has allocated while decoding, the pixels included.
+    isize decoder_allocated_size;
+} FontImage;
+
+// Decodes the font image as a single channel, so that each row of a cell is GLYPH_WIDTH consecutive
+// bytes. The pixels are allocated from the arena.
+bool font_image_decode(StringView file_data, FontImage *image, Arena *arena) {
+    int width;
+    int height;
+    int channel_count;
+    u8 *arena_begin = arena->begin;
+    stbi_arena = arena;
+    image->pixels = stbi_load_from_memory(file_data.data, (int)file_data.size, &width, &height, &channel_count, 1);
+    stbi_arena = NULL;
+    if (image->pixels == NULL) {
+        return false;
+    }
+
+    image->width = width;
+    image->height = height;
+    image->decoder_allocated_size = arena->begin - arena_begin;
+    return true;
+}
+
+// Every char besides the whitespace has a cell in the font image, and the whitespace glyph is added on
+// top of them.
+isize font_chars_count_glyphs(StringView font_chars) {
+    isize glyph_count = 0;
+    while (font_chars.size > 0) {
+        u32 char_code;
+        utf8_chop_char(&font_chars, &char_code);
+        if (!char_is_space(char_code)) {
+            glyph_count += 1;
+        }
+    }
+    // +1 for the whitespace character.
+    return glyph_count + 1;
+}
+
+// Assigns the chars to the non-empty cells of the image in the reading order, and fills the glyphs
+// (see font_chars_count_glyphs for the count) and the cache cells of all glyphs but the whitespace,
+// which is the last glyph. The glyphs are not sorted.
+bool glyphs_extract(
+    StringView font_chars,
+    FontImage const *image,
+    i32 scale,
+    u32 ink_color,
+    u32 background_color,
+    Glyph *glyphs,
+    isize glyph_count,
+    GlyphCacheCell *cells,
+    Arena *arena
+) {
+    if (image->width % GLYPH_WIDTH != 0 || image->height % GLYPH_HEIGHT != 0) {
+        LOG_ERROR("Font bitmap dimensions are not divisble by the glyph dimensions.");
+        return false;
+    }
+
+    isize bitmap_size = (GLYPH_WIDTH * scale) * (GLYPH_HEIGHT * scale) * sizeof(u32);
+    Glyph *glyph_iter = glyphs;
+    Glyph *glyphs_end = glyphs + glyph_count;
+    StringView font_char_iter = font_chars;
+
+    for (isize font_grid_y = 0; font_grid_y < image->height; font_grid_y += GLYPH_HEIGHT) {
+        for (isize font_grid_x = 0; font_grid_x < image->width; font_grid_x += GLYPH_WIDTH) {
+            u64 glyph_mask = image_cell_extract_mask(
+                &image->pixels[font_grid_y * image->width + font_grid_x],
+                image->width
+            );
+            if (glyph_mask == 0) {
+                continue;
+            }
+
+            if (glyph_iter == glyphs_end - 1) {
+                LOG_ERROR("There are more glyphs in the bitmap than chars in the text file.");
+                return false;
+            }
+
+            u32 char_code;
+            StringView char_data;
+            do {
+                char_data = utf8_chop_char(&font_char_iter, &char_code);
+            } while (char_is_space(char_code));
+
+            glyph_iter->char_code = char_code;
+
+            cells[glyph_iter - glyphs] = (GlyphCacheCell){
+                .cell_index = (u32)((font_grid_y / GLYPH_HEIGHT) * (image->width / GLYPH_WIDTH) + font_grid_x / GLYPH_WIDTH),
+                .char_code = char_code,
+                .mask = glyph_mask,
+            };
+
+            glyph_iter->char_data = arena_alloc_aligned(arena, char_data.size + 1, 1);
+            memcpy(glyph_iter->char_data, char_data.data, (size_t)char_data.size);
+            glyph_iter->char_data[char_data.size] = 0;
+
+            for (isize glyph_y = 0; glyph_y < GLYPH_HEIGHT; glyph_y += 1) {
+                glyph_iter->rows[glyph_y] = (u8)(glyph_mask >> (glyph_y * 8));
+            }
+
+            glyph_iter->bitmap = arena_alloc_aligned(arena, bitmap_size, 4);
+            glyph_expand_bitmap(glyph_iter, scale, ink_color, background_color);
+
+            glyph_iter += 1;
+        }
+    }
+
+    // Add the whitespace character.
+    glyph_iter->char_code = 0x0020;
+    glyph_iter->char_data = " ";
+    glyph_iter->bitmap = arena_alloc_aligned(arena, bitmap_size, 4);
+    memset(glyph_iter->rows, 0x00, sizeof(glyph_iter->rows));
+    glyph_expand_bitmap(glyph_iter, scale, ink_color, background_color);
+    glyph_iter += 1;
+
+    if (glyph_iter != glyphs_end) {
+        LOG_ERROR("There are more chars in the text file than glyphs in the bitmap.");
+        return false;
+    }
+
+    return true;
+}
+
+bool font_job_read_inputs(FontJob const *job, String *font_chars, String *font_image_file, Arena *arena) {
+    if (!file_read_to_string(job->chars_path, font_chars, arena)) {
+        LOG_ERROR("Failed to load font chars from the file %s.", job->chars_path);
+        return false;
+    }
+    if (!utf8_validate(as_string_view(*font_chars))) {
+        LOG_ERROR("Failed to load font chars due to invalid UTF-8.");
+        return false;
+    }
+
+    if (!file_read_to_string(job->image_path, font_image_file, arena)) {
+        LOG_ERROR("Failed to load font glyphs from the file %s.", job->image_path);
+        return false;
+    }
+    return true;
+}
+
+// Converts a single font. The arena is only used as a scratch space.
+bool font_job_run(FontJob const *job, FontJobStats *stats, Arena *arena) {
+    *stats = (FontJobStats){.arena_capacity = arena->end - arena->begin};
+    for (isize i = 0; i < OUTPUT_FILE_COUNT; i += 1) {
+        stats->output_sizes[i] = -1;
+    }
+    u8 *arena_begin = arena->begin;
+    arena_high_water = arena->begin;
+    u64 start_ns = time_now_ns();
+    u64 lap_start_ns = start_ns;
+
+    String font_chars = {0};
+    String font_image_file = {0};
+    if (!font_job_read_inputs(job, &font_chars, &font_image_file, arena)) {
+        return false;
+    }
+
+    stats->phase_ns[JOB_PHASE_READ] = time_lap_ns(&lap_start_ns);
+
+    char output_file_paths[OUTPUT_FILE_COUNT][OUTPUT_PATH_CAPACITY];
+    for (isize i = 0; i < OUTPUT_FILE_COUNT; i += 1) {
+        if (!font_job_make_path(job, output_file_suffix(job, (OutputFile)i), output_file_paths[i])) {
+            LOG_ERROR("Output file path is too long.");
+            return false;
+        }
+    }
+    char cache_file_path[OUTPUT_PATH_CAPACITY];
+    if (!font_job_make_path(job, GLYPH_CACHE_SUFFIX, cache_file_path)) {
+        LOG_ERROR("Output file path is too long.");
+        return false;
+    }
+
+    u64 input_hash = FNV1A_INITIAL_HASH;
+    input_hash = fnv1a_update(input_hash, font_chars.data, font_chars.size);
+    input_hash = fnv1a_update(input_hash, font_image_file.data, font_image_file.size);
+    input_hash = fnv1a_update(input_hash, (u8 const *)&job->scale, sizeof(job->scale));
+    input_hash = fnv1a_update(input_hash, (u8 const *)&job->output_formats, sizeof(job->output_formats));
+    input_hash = fnv1a_update(input_hash, (u8 const *)&job->pixel_format, sizeof(job->pixel_format));
+    input_hash = fnv1a_update(input_hash, (u8 const *)&job->ink_color, sizeof(job->ink_color));
+    input_hash = fnv1a_update(input_hash, (u8 const *)&job->background_color, sizeof(job->background_color));
+    input_hash = fnv1a_update(input_hash, (u8 const *)&job->styles, sizeof(job->styles));
+    input_hash = fnv1a_update(input_hash, (u8 const *)&job->is_columns_lsb_top, sizeof(job->is_columns_lsb_top));
+    input_hash = fnv1a_update(input_hash, (u8 const *)&job->sdf_scale, sizeof(job->sdf_scale));
+    input_hash = fnv1a_update(input_hash, (u8 const *)&job->sdf_spread, sizeof(job->sdf_spread));
+    input_hash = fnv1a_update(
+        input_hash,
+        (u8 const *)job->subset_ranges,
+        job->subset_range_count * sizeof(CharCodeRange)
+    );
+    input_hash = fnv1a_update(
+        input_hash,
+        (u8 const *)GLYPH_CACHE_GENERATOR_KEY,
+        sizeof(GLYPH_CACHE_GENERATOR_KEY) - 1
+    );
+
+    isize output_file_count = 0;
+    for (isize i = 0; i < OUTPUT_FILE_COUNT; i += 1) {
+        if ((job->output_formats & output_file_formats[i]) != 0) {
+            output_file_count += 1;
+        }
+    }
+
+    GlyphCache old_cache = {0};
+    bool has_old_cache = glyph_cache_read(cache_file_path, &old_cache, arena);
+    if (has_old_cache && old_cache.header.input_hash == input_hash) {
+        bool are_outputs_present = true;
+        for (isize i = 0; i < OUTPUT_FILE_COUNT; i += 1) {
+            if ((job->output_formats & output_file_formats[i]) != 0) {
+                are_outputs_present = are_outputs_present && file_exists(output_file_paths[i]);
+            }
+        }
+        if (are_outputs_present) {
+            printf("%s: Up to date.\n", job->name);
+            stats->phase_ns[JOB_PHASE_CACHE_CHECK] = time_lap_ns(&lap_start_ns);
+            stats->is_up_to_date = true;
+            stats->total_ns = time_now_ns() - start_ns;
+            stats->arena_used_size = arena_high_water - arena_begin;
+            return true;
+        }
+    }
+    stats->phase_ns[JOB_PHASE_CACHE_CHECK] = time_lap_ns(&lap_start_ns);
+
+    FontImage font_image;
+    if (!font_image_decode(as_string_view(font_image_file), &font_image, arena)) {
+        LOG_ERROR("Failed to load font glyphs from the file %s.", job->image_path);
+        return false;
+    }
+    stats->decoder_allocated_size = font_image.decoder_allocated_size;
+    stats->phase_ns[JOB_PHASE_DECODE] = time_lap_ns(&lap_start_ns);
+
+    isize glyph_count = font_chars_count_glyphs(as_string_view(font_chars));
+    Glyph *glyphs = arena_alloc(arena, glyph_count * sizeof(Glyph));
+    Glyph *glyphs_end = glyphs + glyph_count;
+
+    GlyphCache new_cache = {
+        .header = {
+            .magic = GLYPH_CACHE_MAGIC,
+            .version = GLYPH_CACHE_VERSION,
+            .input_hash = input_hash,
+            // Every glyph but the whitespace has a cell.
+            .cell_count = (u64)(glyph_count - 1),
+        },
+        .cells = arena_alloc(arena, glyph_count * sizeof(GlyphCacheCell)),
+    };
+
+    if (!glyphs_extract(as_string_view(font_chars), &font_image, job->scale, job->ink_color, job->background_color, glyphs, glyph_count, new_cache.cells, arena)) {
+        return false;
+    }
+    stats->phase_ns[JOB_PHASE_EXTRACT] = time_lap_ns(&lap_start_ns);
+
+    qsort(glyphs, (size_t)(glyphs_end - glyphs), sizeof(Glyph), glyph_compare);
+    glyphs_end = glyphs + glyphs_select_subset(job, glyphs, glyphs_end - glyphs);
+    stats->glyph_count = glyphs_end - glyphs;
+    stats->bitmap_count = glyphs_dedup_bitmaps(glyphs, glyphs_end - glyphs, arena);
+
+    Atlas atlas = {0};
+    if ((job->output_formats & OUTPUT_FORMAT_ATLAS) != 0) {
+        if (!glyphs_pack_into_atlas(glyphs, glyphs_end - glyphs, job->scale, &atlas, arena)) {
+            LOG_ERROR("Glyphs do not fit into the atlas.");
+            return false;
+        }
+    }
+    Atlas sdf_atlas = {0};
+    if ((job->output_formats & OUTPUT_FORMAT_SDF_ATLAS) != 0) {
+        if (!glyphs_pack_into_sdf_atlas(
+                glyphs, glyphs_end - glyphs, job->ink_color, job->sdf_scale, job->sdf_spread, &sdf_atlas, arena
+            )) {
+            LOG_ERROR("Glyphs do not fit into the distance field atlas.");
+            return false;
+        }
+    }
+    stats->phase_ns[JOB_PHASE_PREPARE] = time_lap_ns(&lap_start_ns);
+
+    isize changed_file_count = 0;
+    for (isize i = 0; i < OUTPUT_FILE_COUNT; i += 1) {
+        if ((job->output_formats & output_file_formats[i]) == 0) {
+            continue;
+        }
+
+        char temp_file_path[OUTPUT_PATH_CAPACITY];
+        FILE *output_file = output_file_open(output_file_paths[i], temp_file_path);
+        if (output_file == NULL) {
+            LOG_ERROR("Failed to open an output file %s.", output_file_paths[i]);
+            return false;
+        }
+        if (!output_file_export(job, (OutputFile)i, glyphs, glyphs_end - glyphs, &atlas, &sdf_atlas, output_file, arena)) {
+            LOG_ERROR("Failed to write the output file %s.", output_file_paths[i]);
+            fclose(output_file);
+            remove(temp_file_path);
+            return false;
+        }
+        stats->output_sizes[i] = ftell(output_file);
+
+        bool was_changed;
+        if (!output_file_commit(output_file, output_file_paths[i], temp_file_path, &was_changed, arena)) {
+            LOG_ERROR("Failed to replace the output file %s.", output_file_paths[i]);
+            return false;
+        }
+        changed_file_count += was_changed ? 1 : 0;
+        stats->output_ns[i] = time_lap_ns(&lap_start_ns);
+        stats->phase_ns[JOB_PHASE_EXPORT] += stats->output_ns[i];
+    }
+
+    if (!glyph_cache_write(cache_file_path, &new_cache)) {
+        LOG_ERROR("Failed to write the glyph cache.");
+        return false;
+    }
+    stats->phase_ns[JOB_PHASE_CACHE_WRITE] = time_lap_ns(&lap_start_ns);
+
+    if (has_old_cache) {
+        printf(
+            "%s: %ld of %ld glyphs changed, %ld of %ld files rewritten.\n",
+            job->name,
+            glyph_cache_count_dirty_cells(&old_cache, &new_cache),
+            (isize)new_cache.header.cell_count,
+            changed_file_count,
+            output_file_count
+        );
+    } else {
+        printf("%s: %ld of %ld files rewritten.\n", job->name, changed_file_count, output_file_count);
+    }
+
+    stats->total_ns = time_now_ns() - start_ns;
+    stats->arena_used_size = arena_high_water - arena_begin;
+    return true;
+}
+
+bool string_view_equals(StringView string, char const *cstring) {
+    isize cstring_size = (isize)strlen(cstring);
+    return string.size == cstring_size && memcmp(string.data, cstring, (size_t)cstring_size) == 0;
+}
+
+// Chops the string up to the delimiter, the delimiter itself is dropped.
+StringView string_view_chop_by(StringView *string, u8 delimiter) {
+    isize size = 0;
+    while (size < string->size && string->data[size] != delimiter) {
+        size += 1;
+    }
+
+    StringView result = {string->data, size};
+    isize chopped_size = size < string->size ? size + 1 : size;
+    string->data += chopped_size;
+    string->size -= chopped_size;
+    return result;
+}
+
+// Chops the next run of non-whitespace characters, skipping the whitespace before it.
+StringView string_view_chop_word(StringView *string) {
+    while (string->size > 0 && (string->data[0] == ' ' || string->data[0] == '\t' || string->data[0] == '\r')) {
+        string->data += 1;
+        string->size -= 1;
+    }
+
+    isize size = 0;
+    while (size < string->size && string->data[size] != ' ' && string->data[size] != '\t' && string->data[size] != '\r') {
+        size += 1;
+    }
+
+    StringView result = {string->data, size};
+    string->data += size;
+    string->size -= size;
+    return result;
+}
+
+bool string_view_parse_i32(StringView string, i32 *value) {
+    if (string.size == 0 || string.size > 9) {
+        return false;
+    }
+
+    *value = 0;
+    for (isize i = 0; i < string.size; i += 1) {
+        if (string.data[i] < '0' || string.data[i] > '9') {
+            return false;
+        }
+        *value = *value * 10 + (string.data[i] - '0');
+    }
+    return true;
+}
+
+bool string_view_copy_to(StringView string, char *buffer, isize capacity) {
+    if (string.size == 0 || string.size >= capacity) {
+        return false;
+    }
+    memcpy(buffer, string.data, (size_t)string.size);
+    buffer[string.size] = 0;
+    return true;
+}
+
+// Names end up in C symbols, so they have to be identifiers.
+bool font_name_is_valid(char const *name) {
+    for (isize i = 0; name[i] != 0; i += 1) {
+        bool is_letter = (name[i] >= 'a' && name[i] <= 'z') || (name[i] >= 'A' && name[i] <= 'Z') || name[i] == '_';
+        bool is_digit = name[i] >= '0' && name[i] <= '9';
+        if (!is_letter && !(is_digit && i > 0)) {
+            return false;
+        }
+    }
+    return name[0] != 0;
+}
+
+bool output_formats_parse(StringView string, u32 *output_formats) {
+    static struct {
+        char const *name;
+        u32 format;
+    } const format_names[] = {
+        {"c", OUTPUT_FORMAT_C_ARRAY},
+        {"packed", OUTPUT_FORMAT_PACKED_C_ARRAY},
+        {"bdf", OUTPUT_FORMAT_BDF},
+        {"pcf", OUTPUT_FORMAT_PCF},
+        {"f8x8", OUTPUT_FORMAT_FONT_FILE},
+        {"atlas", OUTPUT_FORMAT_ATLAS},
+        {"columns", OUTPUT_FORMAT_COLUMNS_C_ARRAY},
+        {"sdf", OUTPUT_FORMAT_SDF_ATLAS},
+        {"gpu", OUTPUT_FORMAT_GPU_BUFFER},
+        {"all", OUTPUT_FORMAT_ALL},
+    };
+
+    *output_formats = 0;
+    while (string.size > 0) {
+        StringView format_name = string_view_chop_by(&string, ',');
+
+        isize i = 0;
+        isize format_name_count = sizeof(format_names) / sizeof(format_names[0]);
+        while (i < format_name_count && !string_view_equals(format_name, format_names[i].name)) {
+            i += 1;
+        }
+        if (i == format_name_count) {
+            return false;
+        }
+        *output_formats |= format_names[i].format;
+    }
+    return *output_formats != 0;
+}
+
+bool string_view_parse_char_code(StringView string, u32 *char_code) {
+    if (string.size > 2 && (string.data[0] == '0' || string.data[0] == 'U') && (string.data[1] == 'x' || string.data[1] == '+')) {
+        string.data += 2;
+        string.size -= 2;
+    }
+    if (string.size == 0 || string.size > 6) {
+        return false;
+    }
+
+    *char_code = 0;
+    for (isize i = 0; i < string.size; i += 1) {
+        u8 c = string.data[i];
+        u32 digit;
+        if (c >= '0' && c <= '9') {
+            digit = (u32)(c - '0');
+        } else if (c >= 'a' && c <= 'f') {
+            digit = (u32)(c - 'a' + 10);
+        } else if (c >= 'A' && c <= 'F') {
+            digit = (u32)(c - 'A' + 10);
+        } else {
+            return false;
+        }
+        *char_code = *char_code * 16 + digit;
+    }
+    return *char_code <= 0x10ffff;
+}
+
+// Comma separated list of block names, hex char codes (0x2190 or U+2190) and their ranges
+// (0x2190-0x21ff), for example "ascii,arrows,0x2588".
+bool subset_parse(StringView string, CharCodeRange *ranges, isize *range_count) {
+    static struct {
+        char const *name;
+        CharCodeRange range;
+    } const blocks[] = {
+        {"ascii", {0x0020, 0x007e}},
+        {"latin", {0x00a0, 0x024f}},
+        {"greek", {0x0370, 0x03ff}},
+        {"cyrillic", {0x0400, 0x04ff}},
+        {"punctuation", {0x2000, 0x206f}},
+        {"arrows", {0x2190, 0x21ff}},
+        {"math", {0x2200, 0x22ff}},
+        // Brackets and media control symbols among others.
+        {"technical", {0x2300, 0x23ff}},
+    };
+
+    *range_count = 0;
+    while (string.size > 0) {
+        if (*range_count == FONT_SUBSET_RANGE_MAX_COUNT) {
+            return false;
+        }
+
+        StringView item = string_view_chop_by(&string, ',');
+        CharCodeRange *range = &ranges[*range_count];
+
+        isize block_count = sizeof(blocks) / sizeof(blocks[0]);
+        isize block_index = 0;
+        while (block_index < block_count && !string_view_equals(item, blocks[block_index].name)) {
+            block_index += 1;
+        }
+
+        if (block_index < block_count) {
+            *range = blocks[block_index].range;
+        } else {
+            StringView first = string_view_chop_by(&item, '-');
+            if (!string_view_parse_char_code(first, &range->first_char_code)) {
+                return false;
+            }
+            range->last_char_code = range->first_char_code;
+            if (item.size > 0 && !string_view_parse_char_code(item, &range->last_char_code)) {
+                return false;
+            }
+            if (range->last_char_code < range->first_char_code) {
+                return false;
+            }
+        }
+        *range_count += 1;
+    }
+    return *range_count > 0;
+}
+
+bool pixel_format_parse(StringView string, PixelFormat *pixel_format) {
+    for (isize i = 0; i < PIXEL_FORMAT_COUNT; i += 1) {
+        if (string_view_equals(string, pixel_format_names[i])) {
+            *pixel_format = (PixelFormat)i;
+            return true;
+        }
+    }
+    return false;
+}
+
+// Parses RRGGBB or RRGGBBAA (like the CSS colors, but without the #, which starts a comment) into the
+// layout of the glyph bitmaps.
+bool color_parse(StringView string, u32 *color) {
+    if (string.size != 6 && string.size != 8) {
+        return false;
+    }
+
+    u32 value = 0;
+    for (isize i = 0; i < string.size; i += 1) {
+        u8 c = string.data[i];
+        u32 digit;
+        if (c >= '0' && c <= '9') {
+            digit = (u32)(c - '0');
+        } else if (c >= 'a' && c <= 'f') {
+            digit = (u32)(c - 'a' + 10);
+        } else if (c >= 'A' && c <= 'F') {
+            digit = (u32)(c - 'A' + 10);
+        } else {
+            return false;
+        }
+        value = value * 16 + digit;
+    }
+    if (string.size == 6) {
+        value = value << 8 | 0xff;
+    }
+
+    u32 red = value >> 24;
+    u32 green = (value >> 16) & 0xff;
+    u32 blue = (value >> 8) & 0xff;
+    u32 alpha = value & 0xff;
+    *color = alpha << 24 | blue << 16 | green << 8 | red;
+    return true;
+}
+
+bool styles_parse(StringView string, u32 *styles) {
+    *styles = 0;
+    while (string.size > 0) {
+        StringView style_name = string_view_chop_by(&string, ',');
+
+        isize i = 0;
+        while (i < GLYPH_STYLE_COUNT && !string_view_equals(style_name, glyph_style_names[i])) {
+            i += 1;
+        }
+        if (i == GLYPH_STYLE_COUNT) {
+            return false;
+        }
+        *styles |= 1u << i;
+    }
+    return *styles != 0;
+}
+
+FontJob font_job_default(void) {
+    FontJob job = {
+        .scale = FONT_SCALE,
+        .output_formats = OUTPUT_FORMAT_ALL,
+        .pixel_format = FONT_PIXEL_FORMAT,
+        .ink_color = FONT_INK_COLOR,
+        .background_color = FONT_BACKGROUND_COLOR,
+        .styles = FONT_STYLES,
+        .is_columns_lsb_top = FONT_COLUMNS_LSB_TOP,
+        .sdf_scale = FONT_SDF_SCALE,
+        .sdf_spread = FONT_SDF_SPREAD,
+    };
+    strcpy(job.name, FONT_NAME);
+    strcpy(job.image_path, FONT_IMAGE_PATH);
+    strcpy(job.chars_path, FONT_CHARS_PATH);
+    strcpy(job.output_directory, FONT_OUTPUT_DIRECTORY);
+    return job;
+}
+
+#define MANIFEST_JOB_MAX_COUNT 4096
+
+// Every non-empty line of the manifest is a job, which is a list of key=value pairs:
+//
+//     # Comment
+//     name=font8x8 image=res/font8x8.png chars=res/font8x8.txt output=out cell=8x8 scales=1,2 formats=c,atlas
+//     name=font8x8_mini image=res/font8x8.png chars=res/font8x8.txt subset=ascii,arrows formats=packed
+//     name=font8x8_lcd image=res/font8x8.png chars=res/font8x8.txt pixels=rgb565 ink=ffb000 background=000000
+//     name=font8x8_term image=res/font8x8.png chars=res/font8x8.txt formats=packed styles=bold,underline
+//     name=font8x8_oled image=res/font8x8.png chars=res/font8x8.txt formats=columns columns=msb
+//     name=font8x8_ui image=res/font8x8.png chars=res/font8x8.txt formats=sdf sdf_scale=8 sdf_spread=6
+//
+// name, image and chars are required, output, scales and formats default to "out", "2" and "all",
+// subset (see subset_parse) defaults to all of the glyphs. pixels is one of pixel_format_names and
+// defaults to the own formats of the outputs, ink and background (see color_parse) default to opaque
+// white and transparent black. styles is a list of glyph_style_names and defaults to none. columns is
+// the bit order of the columns C array, lsb (the top pixel in the least significant bit) or msb.
+// sdf_scale (up to SDF_SCALE_MAX) and sdf_spread (up to SDF_SPREAD_MAX) of the distance field atlas
+// default to FONT_SDF_SCALE and FONT_SDF_SPREAD.
+// A line with several scales turns into a job per scale, named <name>_x<scale>. Paths can't contain
+// spaces. Cells are always 8x8 (the packed formats are built around that), so the cell key is only
+// checked.
+bool manifest_parse(StringView manifest, FontJob **jobs, isize *job_count, Arena *arena) {
+    *jobs = arena_alloc(arena, MANIFEST_JOB_MAX_COUNT * sizeof(FontJob));
+    *job_count = 0;
+
+    for (isize line_number = 1; manifest.size > 0; line_number += 1) {
+        StringView line = string_view_chop_by(&manifest, '\n');
+
+        FontJob job = font_job_default();
+        job.name[0] = 0;
+        job.image_path[0] = 0;
+        job.chars_path[0] = 0;
+
+        i32 scales[FONT_SCALE_MAX];
+        isize scale_count = 0;
+        bool is_empty = true;
+
+        for (StringView word = string_view_chop_word(&line); word.size > 0; word = string_view_chop_word(&line)) {
+            if (word.data[0] == '#') {
+                break;
+            }
+            is_empty = false;
+
+            StringView value = word;
+            StringView key = string_view_chop_by(&value, '=');
+
+            bool is_valid = true;
+            if (string_view_equals(key, "name")) {
+                is_valid = string_view_copy_to(value, job.name, sizeof(job.name));
+            } else if (string_view_equals(key, "image")) {
+                is_valid = string_view_copy_to(value, job.image_path, sizeof(job.image_path));
+            } else if (string_view_equals(key, "chars")) {
+                is_valid = string_view_copy_to(value, job.chars_path, sizeof(job.chars_path));
+            } else if (string_view_equals(key, "output")) {
+                is_valid = string_view_copy_to(value, job.output_directory, sizeof(job.output_directory));
+            } else if (string_view_equals(key, "cell")) {
+                is_valid = string_view_equals(value, "8x8");
+            } else if (string_view_equals(key, "formats")) {
+                is_valid = output_formats_parse(value, &job.output_formats);
+            } else if (string_view_equals(key, "subset")) {
+                is_valid = subset_parse(value, job.subset_ranges, &job.subset_range_count);
+            } else if (string_view_equals(key, "pixels")) {
+                is_valid = pixel_format_parse(value, &job.pixel_format);
+            } else if (string_view_equals(key, "ink")) {
+                is_valid = color_parse(value, &job.ink_color);
+            } else if (string_view_equals(key, "background")) {
+                is_valid = color_parse(value, &job.background_color);
+            } else if (string_view_equals(key, "columns")) {
+                is_valid = string_view_equals(value, "lsb") || string_view_equals(value, "msb");
+                job.is_columns_lsb_top = string_view_equals(value, "lsb");
+            } else if (string_view_equals(key, "sdf_scale")) {
+                is_valid =
+                    string_view_parse_i32(value, &job.sdf_scale) &&
+                    job.sdf_scale >= 1 && job.sdf_scale <= SDF_SCALE_MAX;
+            } else if (string_view_equals(key, "sdf_spread")) {
+                is_valid =
+                    string_view_parse_i32(value, &job.sdf_spread) &&
+                    job.sdf_spread >= 1 && job.sdf_spread <= SDF_SPREAD_MAX;
+            } else if (string_view_equals(key, "styles")) {
+                is_valid = styles_parse(value, &job.styles);
+            } else if (string_view_equals(key, "scales")) {
+                scale_count = 0;
+                while (is_valid && value.size > 0) {
+                    i32 scale;
+                    is_valid =
+                        scale_count < FONT_SCALE_MAX &&
+                        string_view_parse_i32(string_view_chop_by(&value, ','), &scale) &&
+                        scale >= 1 && scale <= FONT_SCALE_MAX;
+                    if (is_valid) {
+                        scales[scale_count] = scale;
+                        scale_count += 1;
+                    }
+                }
+                is_valid = is_valid && scale_count > 0;
+            } else {
+                is_valid = false;
+            }
+
+            if (!is_valid) {
+                LOG_ERROR("Invalid manifest entry \"%.*s\" on line %ld.", (int)word.size, word.data, line_number);
+                return false;
+            }
+        }
+
+        if (is_empty) {
+            continue;
+        }
+        if (job.name[0] == 0 || job.image_path[0] == 0 || job.chars_path[0] == 0) {
+            LOG_ERROR("Manifest job on line %ld needs a name, an image and chars.", line_number);
+            return false;
+        }
+        if (scale_count == 0) {
+            scales[0] = FONT_SCALE;
+            scale_count = 1;
+        }
+
+        for (isize i = 0; i < scale_count; i += 1) {
+            if (*job_count == MANIFEST_JOB_MAX_COUNT) {
+                LOG_ERROR("There are more than %d jobs in the manifest.", MANIFEST_JOB_MAX_COUNT);
+                return false;
+            }
+
+            FontJob *scaled_job = &(*jobs)[*job_count];
+            *scaled_job = job;
+            scaled_job->scale = scales[i];
+            if (scale_count > 1) {
+                int name_size = snprintf(
+                    scaled_job->name,
+                    sizeof(scaled_job->name),
+                    "%s_x%d",
+                    job.name,
+                    scales[i]
+                );
+                if (name_size < 0 || name_size >= (int)sizeof(scaled_job->name)) {
+                    LOG_ERROR("Font name on line %ld is too long.", line_number);
+                    return false;
+                }
+            }
+            if (!font_name_is_valid(scaled_job->name)) {
+                LOG_ERROR("Font name \"%s\" on line %ld is not a C identifier.", scaled_job->name, line_number);
+                return false;
+            }
+
+            // Jobs writing into the same files would race with each other.
+            for (isize j = 0; j < *job_count; j += 1) {
+                if (
+                    strcmp((*jobs)[j].name, scaled_job->name) == 0 &&
+                    strcmp((*jobs)[j].output_directory, scaled_job->output_directory) == 0
+                ) {
+                    LOG_ERROR("Font \"%s\" on line %ld is already in the manifest.", scaled_job->name, line_number);
+                    return false;
+                }
+            }
+
+            *job_count += 1;
+        }
+    }
+
+    return true;
+}
+
+#define WORKER_MAX_COUNT 64
+
+typedef struct {
+    FontJob const *jobs;
+    isize job_count;
+    atomic_long next_job_index;
+    atomic_bool has_failed;
+    StatsFormat stats_format;
+} JobQueue;
+
+typedef struct {
+    JobQueue *queue;
+    // Scratch space, it is reset between the jobs.
+    Arena arena;
+} Worker;
+
+int worker_run(void *argument) {
+    Worker *worker = argument;
+    JobQueue *queue = worker->queue;
+
+    while (true) {
+        isize job_index = atomic_fetch_add(&queue->next_job_index, 1);
+        if (job_index >= queue->job_count) {
+            break;
+        }
+
+        Arena job_arena = worker->arena;
+        FontJobStats stats;
+        if (!font_job_run(&queue->jobs[job_index], &stats, &job_arena)) {
+            LOG_ERROR("Failed to convert the font %s.", queue->jobs[job_index].name);
+            atomic_store(&queue->has_failed, true);
+        } else if (queue->stats_format != STATS_FORMAT_NONE) {
+            font_job_stats_print(&queue->jobs[job_index], &stats, queue->stats_format, &job_arena);
+        }
+        Arena used_arena = arena_used_part(&worker->arena);
+        arena_release_pages(&used_arena);
+    }
+
+    return 0;
+}
+
+// Prints the glyphs of the job (the subset applied) in a grid instead of converting them.
+bool font_job_preview(FontJob const *job, isize column_count, Arena *arena) {
+    String font_chars = {0};
+    String font_image_file = {0};
+    if (!font_job_read_inputs(job, &font_chars, &font_image_file, arena)) {
+        return false;
+    }
+    FontImage font_image;
+    if (!font_image_decode(as_string_view(font_image_file), &font_image, arena)) {
+        LOG_ERROR("Failed to load font glyphs from the file %s.", job->image_path);
+        return false;
+    }
+
+    isize glyph_count = font_chars_count_glyphs(as_string_view(font_chars));
+    Glyph *glyphs = arena_alloc(arena, glyph_count * sizeof(Glyph));
+    GlyphCacheCell *cells = arena_alloc(arena, glyph_count * sizeof(GlyphCacheCell));
+    // The bitmaps aren't shown, so they are made at the smallest scale.
+    if (!glyphs_extract(as_string_view(font_chars), &font_image, 1, job->ink_color, job->background_color, glyphs, glyph_count, cells, arena)) {
+        return false;
+    }
+    qsort(glyphs, (size_t)glyph_count, sizeof(Glyph), glyph_compare);
+    glyph_count = glyphs_select_subset(job, glyphs, glyph_count);
+
+    BufferedWriter writer = buffered_writer_make_growable(stdout, arena);
+    glyphs_preview(glyphs, glyph_count, column_count, &writer);
+    return buffered_writer_flush(&writer);
+}
+
+// Benchmark of the generator stages and the runtime (--bench). Each stage runs over the font of the
+// default job and, where the input size matters, over a synthetic sheet made of BENCH_SHEET_REPEAT_COUNT
+// copies of it stacked vertically (so it has the same glyphs many times over).
+#define BENCH_SHEET_REPEAT_COUNT 64
+#define BENCH_LOOKUP_COUNT (64 * 1024)
+#define BENCH_SURFACE_WIDTH 1024
+#define BENCH_SURFACE_HEIGHT 1024
+#define BENCH_LINE_CHAR_COUNT 64
+#define BENCH_RENDER_CACHE_SIZE (8 * 1024 * 1024)
+// Console grid, of which a few cells change every frame.
+#define BENCH_GRID_COLUMN_COUNT 80
+#define BENCH_GRID_ROW_COUNT 50
+#define BENCH_GRID_CHANGED_CELL_COUNT 16
+
+// Results of the benchmarked code go here, so that the compiler can't drop it.
+static volatile u64 bench_sink;
+
+// Item and byte counts are the totals over all the iterations.
+void bench_report(char const *stage_name, u64 elapsed_ns, isize item_count, isize byte_count) {
+    f64 elapsed = elapsed_ns > 0 ? (f64)elapsed_ns : 1.0;
+    printf(
+        "%-32s %12.2f ns/glyph %12.2f MB/s\n",
+        stage_name,
+        elapsed / (f64)item_count,
+        (f64)byte_count / elapsed * 1000.0
+    );
+}
+
+// Repeats the chars and the image rows of the font, so that the sheet converts into the glyphs of the
+// font repeated the same amount of times.
+bool bench_make_synthetic_sheet(
+    StringView font_chars,
+    FontImage const *font_image,
+    isize repeat_count,
+    String *sheet_chars,
+    String *sheet_image_file,
+    FontImage *sheet_image,
+    Arena *arena
+) {
+    sheet_chars->size = font_chars.size * repeat_count;
+    sheet_chars->capacity = sheet_chars->size;
+    sheet_chars->data = arena_alloc(arena, sheet_chars->size);
+    for (isize i = 0; i < repeat_count; i += 1) {
+        memcpy(sheet_chars->data + i * font_chars.size, font_chars.data, (size_t)font_chars.size);
+    }
+
+    isize image_size = (isize)font_image->width * font_image->height;
+    sheet_image->width = font_image->width;
+    sheet_image->height = (i32)(font_image->height * repeat_count);
+    sheet_image->pixels = arena_alloc(arena, image_size * repeat_count);
+    for (isize i = 0; i < repeat_count; i += 1) {
+        memcpy(sheet_image->pixels + i * image_size, font_image->pixels, (size_t)image_size);
+    }
+
+    // The PNG writer of the atlas is good enough to make the file for the decoder to chew on.
+    Arena temp_arena = *arena;
+    u32 *pixels = arena_alloc(&temp_arena, image_size * repeat_count * sizeof(u32));
+    for (isize i = 0; i < image_size * repeat_count; i += 1) {
+        pixels[i] = 0xff000000 | sheet_image->pixels[i] * 0x00010101u;
+    }
+
+    FILE *file = tmpfile();
+    if (file == NULL) {
+        return false;
+    }
+    png_write_rgba(pixels, sheet_image->width, sheet_image->height, file, &temp_arena);
+    long file_size = ftell(file);
+    if (ferror(file) != 0 || file_size <= 0 || fseek(file, 0, SEEK_SET) != 0) {
+        fclose(file);
+        return false;
+    }
+
+    sheet_image_file->size = file_size;
+    sheet_image_file->capacity = file_size;
+    sheet_image_file->data = arena_alloc(arena, file_size);
+    bool is_read = fread(sheet_image_file->data, 1, (size_t)file_size, file) == (size_t)file_size;
+    fclose(file);
+    return is_read;
+}
+
+void bench_decode(char const *stage_name, StringView file_data, isize glyph_count, isize iteration_count, Arena *arena) {
+    u64 elapsed_ns = 0;
+    for (isize i = 0; i < iteration_count; i += 1) {
+        Arena temp_arena = *arena;
+        FontImage image;
+        u64 start_ns = time_now_ns();
+        bool is_decoded = font_image_decode(file_data, &image, &temp_arena);
+        elapsed_ns += time_now_ns() - start_ns;
+        assert(is_decoded);
+        (void)is_decoded;
+    }
+    bench_report(stage_name, elapsed_ns, glyph_count * iteration_count, file_data.size * iteration_count);
+}
+
+void bench_validate(char const *stage_name, bool (*validate)(StringView), StringView chars, isize iteration_count) {
+    isize char_count = font_chars_count_glyphs(chars) - 1;
+    isize valid_count = 0;
+    u64 start_ns = time_now_ns();
+    for (isize i = 0; i < iteration_count; i += 1) {
+        valid_count += validate(chars) ? 1 : 0;
+    }
+    u64 elapsed_ns = time_now_ns() - start_ns;
+    assert(valid_count == iteration_count);
+    bench_report(stage_name, elapsed_ns, char_count * iteration_count, chars.size * iteration_count);
+}
+
+void bench_extract(
+    char const *stage_name,
+    StringView chars,
+    FontImage const *image,
+    i32 scale,
+    isize iteration_count,
+    Arena *arena
+) {
+    isize glyph_count = font_chars_count_glyphs(chars);
+    u64 elapsed_ns = 0;
+    for (isize i = 0; i < iteration_count; i += 1) {
+        Arena temp_arena = *arena;
+        Glyph *glyphs = arena_alloc(&temp_arena, glyph_count * sizeof(Glyph));
+        GlyphCacheCell *cells = arena_alloc(&temp_arena, glyph_count * sizeof(GlyphCacheCell));
+        u64 start_ns = time_now_ns();
+        bool is_extracted = glyphs_extract(chars, image, scale, FONT_INK_COLOR, FONT_BACKGROUND_COLOR, glyphs, glyph_count, cells, &temp_arena);
+        elapsed_ns += time_now_ns() - start_ns;
+        assert(is_extracted);
+        (void)is_extracted;
+    }
+    bench_report(stage_name, elapsed_ns, glyph_count * iteration_count, (isize)image->width * image->height * iteration_count);
+}
+
+// Leaves the atlas of the last iteration for the export.
+bool bench_sdf(Glyph const *glyphs, isize glyph_count, FontJob const *job, Atlas *atlas, isize iteration_count, Arena *arena) {
+    u64 elapsed_ns = 0;
+    for (isize i = 0; i < iteration_count; i += 1) {
+        bool is_last_iteration = i == iteration_count - 1;
+        Arena temp_arena = *arena;
+        u64 start_ns = time_now_ns();
+        bool is_packed = glyphs_pack_into_sdf_atlas(
+            glyphs,
+            glyph_count,
+            job->ink_color,
+            job->sdf_scale,
+            job->sdf_spread,
+            atlas,
+            is_last_iteration ? arena : &temp_arena
+        );
+        elapsed_ns += time_now_ns() - start_ns;
+        if (!is_packed) {
+            return false;
+        }
+    }
+    isize pixel_count = (isize)atlas->width * atlas->height;
+    bench_report("sdf", elapsed_ns, glyph_count * iteration_count, pixel_count * (isize)sizeof(u32) * iteration_count);
+    return true;
+}
+
+void bench_sort(char const *stage_name, Glyph const *glyphs, isize glyph_count, isize iteration_count, Arena *arena) {
+    Arena temp_arena = *arena;
+    Glyph *sorted_glyphs = arena_alloc(&temp_arena, glyph_count * sizeof(Glyph));
+    u64 elapsed_ns = 0;
+    for (isize i = 0; i < iteration_count; i += 1) {
+        memcpy(sorted_glyphs, glyphs, (size_t)(glyph_count * sizeof(Glyph)));
+        u64 start_ns = time_now_ns();
+        qsort(sorted_glyphs, (size_t)glyph_count, sizeof(Glyph), glyph_compare);
+        elapsed_ns += time_now_ns() - start_ns;
+    }
+    bench_report(stage_name, elapsed_ns, glyph_count * iteration_count, glyph_count * (isize)sizeof(Glyph) * iteration_count);
+}
+
+// The exporters write into a temporary file, which is rewound before every iteration.
+bool bench_export(
+    FontJob const *job,
+    Glyph const *glyphs,
+    isize glyph_count,
+    Atlas const *atlas,
+    Atlas const *sdf_atlas,
+    isize iteration_count,
+    Arena *arena
+) {
+    FILE *file = tmpfile();
+    if (file == NULL) {
+        LOG_ERROR("Failed to open a temporary file.");
+        return false;
+    }
+
+    for (isize i = 0; i < OUTPUT_FILE_COUNT; i += 1) {
+        u64 elapsed_ns = 0;
+        isize byte_count = 0;
+        for (isize j = 0; j < iteration_count; j += 1) {
+            rewind(file);
+            u64 start_ns = time_now_ns();
+            bool is_exported = output_file_export(job, (OutputFile)i, glyphs, glyph_count, atlas, sdf_atlas, file, arena);
+            fflush(file);
+            elapsed_ns += time_now_ns() - start_ns;
+            if (!is_exported) {
+                LOG_ERROR("Failed to export the %s file.", output_file_suffix(job, (OutputFile)i));
+                fclose(file);
+                return false;
+            }
+            byte_count += ftell(file);
+        }
+
+        char stage_name[64];
+        snprintf(stage_name, sizeof(stage_name), "export %s", output_file_suffix(job, (OutputFile)i));
+        bench_report(stage_name, elapsed_ns, glyph_count * iteration_count, byte_count);
+    }
+
+    fclose(file);
+    return true;
+}
+
+// Looks up every char code of the font and as many missing ones, which go to the fallback glyph.
+void bench_lookup(Glyph const *glyphs, isize glyph_count, isize iteration_count, Arena *arena) {
+    Arena temp_arena = *arena;
+    Font8x8Index index = glyphs_build_index(glyphs, glyph_count, &temp_arena);
+    u32 *char_codes = arena_alloc(&temp_arena, BENCH_LOOKUP_COUNT * sizeof(u32));
+    for (isize i = 0; i < BENCH_LOOKUP_COUNT; i += 1) {
+        u32 char_code = glyphs[(i / 2) % glyph_count].char_code;
+        char_codes[i] = i % 2 == 0 ? char_code : char_code + 1;
+    }
+
+    u64 glyph_index_sum = 0;
+    u64 start_ns = time_now_ns();
+    for (isize i = 0; i < iteration_count; i += 1) {
+        for (isize j = 0; j < BENCH_LOOKUP_COUNT; j += 1) {
+            glyph_index_sum += font8x8_glyph_index(&index, char_codes[j]);
+        }
+    }
+    u64 elapsed_ns = time_now_ns() - start_ns;
+    bench_sink = glyph_index_sum;
+
+    bench_report("glyph lookup", elapsed_ns, BENCH_LOOKUP_COUNT * iteration_count, BENCH_LOOKUP_COUNT * (isize)sizeof(u32) * iteration_count);
+}
+
+// Draws all the chars of the font in lines of BENCH_LINE_CHAR_COUNT, the bytes are the pixels written.
+void bench_draw(Glyph const *glyphs, isize glyph_count, i32 scale, Font8x8Format format, isize iteration_count, Arena *arena) {
+    Arena temp_arena = *arena;
+    Font8x8Index index = glyphs_build_index(glyphs, glyph_count, &temp_arena);
+    isize bitmap_count = glyphs_bitmap_count(glyphs, glyph_count);
+    u8 (*bitmap_rows)[GLYPH_HEIGHT] = arena_alloc(&temp_arena, bitmap_count * GLYPH_HEIGHT);
+    u16 *glyph_bitmap_indices = arena_alloc(&temp_arena, glyph_count * sizeof(u16));
+    for (isize i = 0; i < glyph_count; i += 1) {
+        memcpy(bitmap_rows[glyphs[i].bitmap_index], glyphs[i].rows, GLYPH_HEIGHT);
+        glyph_bitmap_indices[i] = (u16)glyphs[i].bitmap_index;
+    }
+    Font8x8 font = {
+        .bitmap_rows = (u8 const (*)[GLYPH_HEIGHT])bitmap_rows,
+        .bitmap_count = bitmap_count,
+        .glyph_bitmap_indices = glyph_bitmap_indices,
+        .glyph_count = glyph_count,
+        .index = &index,
+    };
+
+    BufferedWriter text_writer = buffered_writer_make_growable(NULL, &temp_arena);
+    for (isize i = 0; i < glyph_count; i += 1) {
+        buffered_writer_write_cstring(&text_writer, glyphs[i].char_data);
+        if (i % BENCH_LINE_CHAR_COUNT == BENCH_LINE_CHAR_COUNT - 1) {
+            buffered_writer_write_cstring(&text_writer, "\n");
+        }
+    }
+    StringView text = {text_writer.data, text_writer.size};
+
+    isize pixel_size = format == FONT8X8_FORMAT_A8 ? 1 : 4;
+    Font8x8Surface surface = {
+        .width = BENCH_SURFACE_WIDTH,
+        .height = BENCH_SURFACE_HEIGHT,
+        .stride = BENCH_SURFACE_WIDTH * pixel_size,
+        .format = format,
+    };
+    surface.pixels = arena_alloc(&temp_arena, surface.stride * surface.height);
+    memset(surface.pixels, 0, (size_t)(surface.stride * surface.height));
+
+    u64 start_ns = time_now_ns();
+    for (isize i = 0; i < iteration_count; i += 1) {
+        font8x8_draw_string(surface, &font, text, 0, 0, scale, 0xffffffff, 0xff000000);
+    }
+    u64 elapsed_ns = time_now_ns() - start_ns;
+
+    char stage_name[64];
+    snprintf(stage_name, sizeof(stage_name), "draw string %s %dx", format == FONT8X8_FORMAT_A8 ? "A8" : "RGBA", scale);
+    isize glyph_pixel_count = (isize)(GLYPH_WIDTH * scale) * (GLYPH_HEIGHT * scale);
+    bench_report(stage_name, elapsed_ns, glyph_count * iteration_count, glyph_count * glyph_pixel_count * pixel_size * iteration_count);
+
+    // The same text through the render cache, which misses only on the first iteration.
+    isize cache_memory_size = BENCH_RENDER_CACHE_SIZE;
+    void *cache_memory = arena_alloc_aligned(&temp_arena, cache_memory_size, 8);
+    Font8x8RenderCache cache;
+    if (!font8x8_cache_init(&cache, cache_memory, cache_memory_size, 16)) {
+        return;
+    }
+
+    start_ns = time_now_ns();
+    for (isize i = 0; i < iteration_count; i += 1) {
+        font8x8_cache_draw_string(&cache, surface, &font, text, 0, 0, scale, 0xffffffff, 0xff000000);
+    }
+    elapsed_ns = time_now_ns() - start_ns;
+
+    snprintf(
+        stage_name,
+        sizeof(stage_name),
+        "draw string %s %dx cached",
+        format == FONT8X8_FORMAT_A8 ? "A8" : "RGBA",
+        scale
+    );
+    bench_report(stage_name, elapsed_ns, glyph_count * iteration_count, glyph_count * glyph_pixel_count * pixel_size * iteration_count);
+
+    // A console frame: a few cells change and only those are drawn. The throughput counts the whole
+    // grid, to compare with drawing all of it every frame.
+    isize grid_memory_size = font8x8_grid_memory_size(BENCH_GRID_COLUMN_COUNT, BENCH_GRID_ROW_COUNT);
+    void *grid_memory = arena_alloc_aligned(&temp_arena, grid_memory_size, 8);
+    Font8x8Grid grid;
+    bool is_grid_ok = font8x8_grid_init(
+        &grid,
+        grid_memory,
+        grid_memory_size,
+        &font,
+        BENCH_GRID_COLUMN_COUNT,
+        BENCH_GRID_ROW_COUNT,
+        scale,
+        0,
+        0,
+        0xffffffff,
+        0xff000000
+    );
+    if (!is_grid_ok) {
+        return;
+    }
+    font8x8_grid_draw(&grid, surface);
+
+    isize grid_cell_count = BENCH_GRID_COLUMN_COUNT * BENCH_GRID_ROW_COUNT;
+    u32 cell_seed = 1;
+    start_ns = time_now_ns();
+    for (isize i = 0; i < iteration_count; i += 1) {
+        for (isize j = 0; j < BENCH_GRID_CHANGED_CELL_COUNT; j += 1) {
+            cell_seed = cell_seed * 1103515245 + 12345;
+            i32 cell_index = (i32)((cell_seed >> 8) % (u32)grid_cell_count);
+            font8x8_grid_set_cell(
+                &grid,
+                cell_index % BENCH_GRID_COLUMN_COUNT,
+                cell_index / BENCH_GRID_COLUMN_COUNT,
+                glyphs[(cell_seed >> 4) % (u32)glyph_count].char_code,
+                0xffffffff,
+                0xff000000
+            );
+        }
+        font8x8_grid_draw(&grid, surface);
+    }
+    elapsed_ns = time_now_ns() - start_ns;
+
+    snprintf(
+        stage_name,
+        sizeof(stage_name),
+        "draw grid %s %dx dirty",
+        format == FONT8X8_FORMAT_A8 ? "A8" : "RGBA",
+        scale
+    );
+    bench_report(stage_name, elapsed_ns, grid_cell_count * iteration_count, grid_cell_count * glyph_pixel_count * pixel_size * iteration_count);
+}
+
+bool bench_run(FontJob const *job, isize iteration_count, Arena *arena) {
+    String font_chars = {0};
+    String font_image_file = {0};
+    if (!font_job_read_inputs(job, &font_chars, &font_image_file, arena)) {
+        return false;
+    }
+    FontImage font_image;
+    if (!font_image_decode(as_string_view(font_image_file), &font_image, arena)) {
+        LOG_ERROR("Failed to load font glyphs from the file %s.", job->image_path);
+        return false;
+    }
+
+    String sheet_chars;
+    String sheet_image_file;
+    FontImage sheet_image;
+    if (!bench_make_synthetic_sheet(
+        as_string_view(font_chars),
+        &font_image,
+        BENCH_SHEET_REPEAT_COUNT,
+        &sheet_chars,
+        &sheet_image_file,
+        &sheet_image,
+        arena
+    )) {
+        LOG_ERROR("Failed to make the synthetic sheet.");
+        return false;
+    }
+
+    isize glyph_count = font_chars_count_glyphs(as_string_view(font_chars));
+    Glyph *glyphs = arena_alloc(arena, glyph_count * sizeof(Glyph));
+    GlyphCacheCell *cells = arena_alloc(arena, glyph_count * sizeof(GlyphCacheCell));
+    if (!glyphs_extract(as_string_view(font_chars), &font_image, job->scale, job->ink_color, job->background_color, glyphs, glyph_count, cells, arena)) {
+        return false;
+    }
+    isize sheet_glyph_count = font_chars_count_glyphs(as_string_view(sheet_chars));
+    Glyph *sheet_glyphs = arena_alloc(arena, sheet_glyph_count * sizeof(Glyph));
+    GlyphCacheCell *sheet_cells = arena_alloc(arena, sheet_glyph_count * sizeof(GlyphCacheCell));
+    if (!glyphs_extract(as_string_view(sheet_chars), &sheet_image, job->scale, job->ink_color, job->background_color, sheet_glyphs, sheet_glyph_count, sheet_cells, arena)) {
+        return false;
+    }
+
+    printf(
+        "%ld iterations, the font has %ld glyphs, the synthetic sheet has %ld glyphs (%dx%d).\n",
+        iteration_count,
+        glyph_count,
+        sheet_glyph_count,
+        sheet_image.width,
+        sheet_image.height
+    );
+
+    bench_decode("png decode", as_string_view(font_image_file), glyph_count - 1, iteration_count, arena);
+    bench_decode("png decode (sheet)", as_string_view(sheet_image_file), sheet_glyph_count - 1, iteration_count, arena);
+    bench_validate("utf8_validate", utf8_validate, as_string_view(sheet_chars), iteration_count);
+    bench_validate("utf8_validate_scalar", utf8_validate_scalar, as_string_view(sheet_chars), iteration_count);
+    bench_extract("extract", as_string_view(font_chars), &font_image, job->scale, iteration_count, arena);
+    bench_extract("extract (sheet)", as_string_view(sheet_chars), &sheet_image, job->scale, iteration_count, arena);
+    bench_sort("qsort", glyphs, glyph_count, iteration_count, arena);
+    bench_sort("qsort (sheet)", sheet_glyphs, sheet_glyph_count, iteration_count, arena);
+
+    qsort(glyphs, (size_t)glyph_count, sizeof(Glyph), glyph_compare);
+    glyph_count = glyphs_select_subset(job, glyphs, glyph_count);
+    glyphs_dedup_bitmaps(glyphs, glyph_count, arena);
+    Atlas atlas = {0};
+    if (!glyphs_pack_into_atlas(glyphs, glyph_count, job->scale, &atlas, arena)) {
+        LOG_ERROR("Glyphs do not fit into the atlas.");
+        return false;
+    }
+
+    Atlas sdf_atlas = {0};
+    if (!bench_sdf(glyphs, glyph_count, job, &sdf_atlas, iteration_count, arena)) {
+        LOG_ERROR("Glyphs do not fit into the distance field atlas.");
+        return false;
+    }
+
+    if (!bench_export(job, glyphs, glyph_count, &atlas, &sdf_atlas, iteration_count, arena)) {
+        return false;
+    }
+    bench_lookup(glyphs, glyph_count, iteration_count, arena);
+    bench_draw(glyphs, glyph_count, 1, FONT8X8_FORMAT_RGBA8888, iteration_count, arena);
+    bench_draw(glyphs, glyph_count, job->scale, FONT8X8_FORMAT_RGBA8888, iteration_count, arena);
+    bench_draw(glyphs, glyph_count, job->scale, FONT8X8_FORMAT_A8, iteration_count, arena);
+
+    return true;
+}
+
+void print_usage(char const *program_name) {
+    fprintf(stderr, "Usage: %s [-j <thread count>] [--subset <char codes>] [--stats | --stats-json]\n", program_name);
+    fprintf(stderr, "       [--preview <column count>] [--bench <iteration count>] [<manifest>]\n");
+    fprintf(stderr, "Without a manifest converts " FONT_IMAGE_PATH " and " FONT_CHARS_PATH " into " FONT_OUTPUT_DIRECTORY ".\n");
+    fprintf(stderr, "The subset applies to the jobs without one, for example --subset ascii,arrows,0x2500-0x257f.\n");
+    fprintf(stderr, "The stats show the time of each phase, the memory use and the output sizes of every job.\n");
+    fprintf(stderr, "The preview prints the glyphs of the first job in a grid and writes no outputs.\n");
+    fprintf(stderr, "The benchmark times every stage on the first job and writes no outputs.\n");
+}
+
+int main(int argc, char **argv) {
+    char const *manifest_path = NULL;
+    isize thread_count = hardware_thread_count();
+    CharCodeRange subset_ranges[FONT_SUBSET_RANGE_MAX_COUNT];
+    isize subset_range_count = 0;
+    isize bench_iteration_count = 0;
+    isize preview_column_count = 0;
+    StatsFormat stats_format = STATS_FORMAT_NONE;
+
+    for (int i = 1; i < argc; i += 1) {
+        if (strcmp(argv[i], "-j") == 0 && i + 1 < argc) {
+            i32 parsed_thread_count;
+            StringView argument = {(u8 *)argv[i + 1], (isize)strlen(argv[i + 1])};
+            if (!string_view_parse_i32(argument, &parsed_thread_count) || parsed_thread_count < 1) {
+                print_usage(argv[0]);
+                return 1;
+            }
+            thread_count = parsed_thread_count;
+            i += 1;
+        } else if (strcmp(argv[i], "--subset") == 0 && i + 1 < argc) {
+            StringView argument = {(u8 *)argv[i + 1], (isize)strlen(argv[i + 1])};
+            if (!subset_parse(argument, subset_ranges, &subset_range_count)) {
+                print_usage(argv[0]);
+                return 1;
+            }
+            i += 1;
+        } else if (strcmp(argv[i], "--stats") == 0) {
+            stats_format = STATS_FORMAT_TEXT;
+        } else if (strcmp(argv[i], "--stats-json") == 0) {
+            stats_format = STATS_FORMAT_JSON;
+        } else if (strcmp(argv[i], "--preview") == 0 && i + 1 < argc) {
+            i32 parsed_column_count;
+            StringView argument = {(u8 *)argv[i + 1], (isize)strlen(argv[i + 1])};
+            if (!string_view_parse_i32(argument, &parsed_column_count) || parsed_column_count < 1) {
+                print_usage(argv[0]);
+                return 1;
+            }
+            preview_column_count = parsed_column_count;
+            i += 1;
+        } else if (strcmp(argv[i], "--bench") == 0 && i + 1 < argc) {
+            i32 parsed_iteration_count;
+            StringView argument = {(u8 *)argv[i + 1], (isize)strlen(argv[i + 1])};
+            if (!string_view_parse_i32(argument, &parsed_iteration_count) || parsed_iteration_count < 1) {
+                print_usage(argv[0]);
+                return 1;
+            }
+            bench_iteration_count = parsed_iteration_count;
+            i += 1;
+        } else if (argv[i][0] != '-' && manifest_path == NULL) {
+            manifest_path = argv[i];
+        } else {
+            print_usage(argv[0]);
+            return 1;
+        }
+    }
+
+    // The manifest text and the jobs, the jobs run in arenas of their own.
+    Arena manifest_arena;
+    if (!arena_reserve(&manifest_arena, ARENA_MIN_CAPACITY)) {
+        LOG_ERROR("Failed to allocate the arena.");
+        return 1;
+    }
+
+    FontJob *jobs = NULL;
+    isize job_count = 0;
+    if (manifest_path != NULL) {
+        String manifest = {0};
+        if (!file_read_to_string(manifest_path, &manifest, &manifest_arena)) {
+            LOG_ERROR("Failed to read the manifest %s.", manifest_path);
+            return 1;
+        }
+        if (!manifest_parse(as_string_view(manifest), &jobs, &job_count, &manifest_arena)) {
+            return 1;
+        }
+    } else {
+        jobs = arena_alloc(&manifest_arena, sizeof(FontJob));
+        jobs[0] = font_job_default();
+        job_count = 1;
+    }
+
+    for (isize i = 0; i < job_count; i += 1) {
+        if (jobs[i].subset_range_count == 0) {
+            memcpy(jobs[i].subset_ranges, subset_ranges, (size_t)(subset_range_count * sizeof(CharCodeRange)));
+            jobs[i].subset_range_count = subset_range_count;
+        }
+    }
+
+    if (preview_column_count > 0 || bench_iteration_count > 0) {
+        if (job_count == 0) {
+            return 0;
+        }
+        Arena job_arena;
+        if (!arena_reserve(&job_arena, ARENA_RESERVE_CAPACITY)) {
+            LOG_ERROR("Failed to allocate the arena.");
+            return 1;
+        }
+        if (preview_column_count > 0) {
+            return font_job_preview(&jobs[0], preview_column_count, &job_arena) ? 0 : 1;
+        }
+        return bench_run(&jobs[0], bench_iteration_count, &job_arena) ? 0 : 1;
+    }
+
+    thread_count = thread_count < job_count ? thread_count : job_count;
+    thread_count = thread_count < WORKER_MAX_COUNT ? thread_count : WORKER_MAX_COUNT;
+    if (thread_count == 0) {
+        return 0;
+    }
+
+    JobQueue queue = {.jobs = jobs, .job_count = job_count, .stats_format = stats_format};
+    atomic_init(&queue.next_job_index, 0);
+    atomic_init(&queue.has_failed, false);
+
+    // Runs with fewer workers if the memory runs out (see ARENA_MIN_CAPACITY).
+    Worker workers[WORKER_MAX_COUNT];
+    thrd_t threads[WORKER_MAX_COUNT];
+    isize reserved_worker_count = 0;
+    while (reserved_worker_count < thread_count) {
+        workers[reserved_worker_count].queue = &queue;
+        if (!arena_reserve(&workers[reserved_worker_count].arena, ARENA_RESERVE_CAPACITY)) {
+            break;
+        }
+        reserved_worker_count += 1;
+    }
+    if (reserved_worker_count == 0) {
+        LOG_ERROR("Failed to allocate the arena.");
+        return 1;
+    }
+    thread_count = reserved_worker_count;
+
+    // The calling thread is the worker 0.
+    isize started_thread_count = 1;
+    while (started_thread_count < thread_count) {
+        if (thrd_create(&threads[started_thread_count], worker_run, &workers[started_thread_count]) != thrd_success) {
+            break;
+        }
+        started_thread_count += 1;
+    }
+    worker_run(&workers[0]);
+    for (isize i = 1; i < started_thread_count; i += 1) {
+        thrd_join(threads[i], NULL);
+    }
+
+    return atomic_load(&queue.has_failed) ? 1 : 0;
 }